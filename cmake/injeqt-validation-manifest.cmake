@@ -0,0 +1,39 @@
+#
+# %injeqt copyright begin%
+# Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+# %injeqt copyright end%
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+#
+
+# injeqt_add_validation_manifest (target host output)
+#
+# Runs executable target host at build time to write validation manifest of injector configuration
+# to output file and makes target depend on it. Host must create injector with all modules used by
+# target and write result of injector::validation_manifest() to file passed as its first argument.
+# Invalid configuration makes host throw, so build fails instead of application startup.
+#
+# Target reads output file at runtime (or embeds it as resource) and passes its content to injector
+# constructor, so validation is not repeated on each launch.
+function (injeqt_add_validation_manifest target host output)
+	add_custom_command (
+		OUTPUT ${output}
+		COMMAND ${host} ${output}
+		DEPENDS ${host}
+		COMMENT "Validating injeqt configuration of ${target}"
+	)
+	add_custom_target (${target}-injeqt-validation-manifest DEPENDS ${output})
+	add_dependencies (${target} ${target}-injeqt-validation-manifest)
+endfunction ()
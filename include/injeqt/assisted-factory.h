@@ -0,0 +1,171 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include <memory>
+#include <utility>
+#include <QtCore/QObject>
+
+/**
+ * @file
+ * @brief Contains classes for creating objects that need both injected and runtime arguments.
+ */
+
+namespace injeqt { namespace internal {
+	class assisted_injection_state;
+}}
+
+namespace injeqt { namespace v1 {
+
+/**
+ * @brief Precomputed injection of dependencies into objects of one type.
+ *
+ * Injection is returned by injector::make_assisted_injection(const type &) and is used by
+ * assisted_factory to finish objects created with runtime arguments. Dependencies of type are
+ * extracted and shared ones are resolved once, when injection is created, so inject() only calls
+ * setters and INJEQT_INIT methods.
+ *
+ * Injection must not be used after injector that created it is destroyed. Injection does not
+ * follow later changes of injector configuration (added or removed modules) - new injection
+ * should be created after such change.
+ */
+class INJEQT_API assisted_injection final
+{
+
+public:
+	/**
+	 * @brief Create empty injection.
+	 */
+	assisted_injection();
+
+	/**
+	 * @brief Create injection with given state.
+	 *
+	 * Direct instantiations of this class with this constructor should not be needed in user code.
+	 */
+	explicit assisted_injection(std::shared_ptr<internal::assisted_injection_state> state);
+
+	/**
+	 * @return true if injection is empty
+	 */
+	bool is_empty() const;
+
+	/**
+	 * @pre !is_empty()
+	 * @return type of objects that this injection is valid for
+	 */
+	type object_type() const;
+
+	/**
+	 * @brief Inject dependencies into @p object and call its INJEQT_INIT methods.
+	 * @param object object to inject dependencies into
+	 * @throw instantiation_failed if instantiation of scoped or prototype dependency failed
+	 * @throw no_active_scope if object depends on scoped type and there is no active scope
+	 * @pre !is_empty()
+	 * @pre object != nullptr
+	 * @pre object is of type object_type() and lives in current thread
+	 */
+	void inject(QObject *object) const;
+
+private:
+	std::shared_ptr<internal::assisted_injection_state> _state;
+
+};
+
+/**
+ * @brief Callable creating objects of type T from runtime arguments Args.
+ * @tparam T type of created objects
+ * @tparam Args types of runtime arguments passed to constructor of T
+ *
+ * Factory is returned by injector::make_assisted_factory<T, Args...>(). Each call creates new object
+ * with constructor of T taking Args, then injects its dependencies with precomputed assisted_injection.
+ * Constructor of T does not have to be Q_INVOKABLE. Caller owns created objects - injector never
+ * destroys them and does not call their INJEQT_DONE methods.
+ *
+ * Example:
+ *
+ *     class connection : public QObject
+ *     {
+ *         Q_OBJECT
+ *     public:
+ *         explicit connection(int id) : _id{id} {}
+ *     private slots:
+ *         INJEQT_SET void set_network(network *n) { _network = n; }
+ *     };
+ *
+ *     auto make_connection = injector.make_assisted_factory<connection, int>();
+ *     auto c1 = make_connection(1); // std::unique_ptr<connection> with network set
+ *     auto c2 = make_connection(2);
+ *
+ * Factory must not be used after injector that created it is destroyed.
+ */
+template<typename T, typename ...Args>
+class assisted_factory final
+{
+
+public:
+	/**
+	 * @brief Create empty factory.
+	 */
+	assisted_factory() {}
+
+	/**
+	 * @brief Create factory using given injection.
+	 * @pre injection.is_empty() || injection.object_type() == make_type<T>()
+	 *
+	 * Direct instantiations of this class with this constructor should not be needed in user code.
+	 */
+	explicit assisted_factory(assisted_injection injection) :
+		_injection{std::move(injection)}
+	{
+	}
+
+	/**
+	 * @return true if factory is empty
+	 */
+	bool is_empty() const
+	{
+		return _injection.is_empty();
+	}
+
+	/**
+	 * @brief Create new object of type T with all dependencies injected.
+	 * @param args runtime arguments passed to constructor of T
+	 * @throw instantiation_failed if instantiation of scoped or prototype dependency failed
+	 * @throw no_active_scope if T depends on scoped type and there is no active scope
+	 * @pre !is_empty()
+	 */
+	std::unique_ptr<T> operator () (Args ...args) const
+	{
+		auto result = std::unique_ptr<T>{new T(std::forward<Args>(args)...)};
+		_injection.inject(result.get());
+		return result;
+	}
+
+private:
+	assisted_injection _injection;
+
+};
+
+}}
@@ -0,0 +1,41 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/exception/instantiation-failed.h>
+
+namespace injeqt { namespace v1 { namespace exception {
+
+/**
+ * @brief Exception throw when instantiation of a type requires instance of the same type.
+ *
+ * This can happen when factory of a type is requested from inside of its own construction on the same thread.
+ */
+class INJEQT_API instantiation_cycle : public instantiation_failed
+{
+
+public:
+	explicit instantiation_cycle(std::string what = std::string{});
+	virtual ~instantiation_cycle();
+
+};
+
+}}}
@@ -20,11 +20,19 @@
 
 #pragma once
 
+#include <injeqt/assisted-factory.h>
 #include <injeqt/injeqt.h>
+#include <injeqt/lazy.h>
+#include <injeqt/object-set.h>
 #include <injeqt/type.h>
 
+#include <chrono>
+#include <functional>
+#include <string>
 #include <memory>
 #include <vector>
+#include <QtCore/QFuture>
+#include <QtCore/QFutureInterface>
 #include <QtCore/QObject>
 
 /**
@@ -40,6 +48,19 @@ namespace injeqt { namespace v1 {
 
 class module;
 
+/**
+ * @brief Status of request made with injector::try_get&lt;T&gt;() or injector::try_instantiate&lt;T&gt;().
+ */
+enum class try_status
+{
+	/// object was returned or instantiated
+	ok,
+	/// requested type was not configured in injector
+	unknown_type,
+	/// requested object or one of its dependencies could not be provided, for example its instantiation failed
+	failed
+};
+
 /**
  * @brief Injector is created from set of modules that contains injectable types.
  *
@@ -59,6 +80,13 @@ class module;
  * objects (configured with module::add_ready_object<T>(QObject *) is not managed by injector.
  * For clarity ready objects can be stored in module instances as unique pointers. Injector will own
  * then as it own modules.
+ *
+ * Types configured with module::add_scoped_type<T>() are bound to scopes. Scope is started with
+ * enter_scope() and ended with leave_scope(). Inside each scope only one object of such type is created
+ * and all of them are destroyed together when scope ends.
+ *
+ * Types configured with module::add_prototype<T>() get new object for each request and each injection
+ * point. Injector owns these objects until they are given back with release(QObject *).
  */
 class INJEQT_API injector final
 {
@@ -82,6 +110,7 @@ public:
 	 * @throw invalid_setter if any tagged setter has parameter that is not a QObject-derived pointer
 	 * @throw invalid_setter if any tagged setter has parameter that is a QObject pointer
 	 * @throw invalid_setter if any tagged setter has other number of parameters than one
+	 * @throw dependency_on_scoped_type if type that is not scoped depends on scoped type
 	 *
 	 * Creates injector with all types from modules configured. If combined configuration
 	 * of all modules is invalid an exception is thrown. Configuration is invalid when:
@@ -103,21 +132,162 @@ public:
 	 * @throw invalid_setter if any tagged setter has parameter that is not a QObject-derived pointer
 	 * @throw invalid_setter if any tagged setter has parameter that is a QObject pointer
 	 * @throw invalid_setter if any tagged setter has other number of parameters than one
+	 * @throw dependency_on_scoped_type if type that is not scoped depends on scoped type
 	 *
-	 * Creates injector with all types from modules configured. Also a virtual module consisting of all
-	 * provided types from @p super_injectors is added to module set. If combined configuration
-	 * of all modules is invalid an exception is thrown. Configuration is invalid when:
-	 * * any type is configured in more than one module
-	 * * a dependency exists with type that is non configured in any module
+	 * Creates injector with all types from modules configured. Also all types provided by @p super_injectors
+	 * are available in new injector. If combined configuration of all modules and super injectors is invalid
+	 * an exception is thrown. Configuration is invalid when:
+	 * * any type is configured in more than one module or in module and in one of super injectors
+	 * * any type is provided by more than one of super injectors
+	 * * a dependency exists with type that is non configured in any module nor in any super injector
 	 * * a cycle of factories is found (currently does not throw an exception)
+	 *
+	 * Super injectors are not copied - new injector only analyzes types from @p modules and asks
+	 * @p super_injectors for all other objects, which are never stored in new injector. Because of that
+	 * creating sub injectors is cheap even for large super injectors. All @p super_injectors must
+	 * outlive created injector.
 	 */
 	explicit injector(std::vector<injector *> super_injectors, std::vector<std::unique_ptr<module>> modules);
 
+	/**
+	 * @brief Create new injector from provided modules, skipping validation if @p validation_manifest matches.
+	 * @param modules list of modules
+	 * @param validation_manifest result of validation_manifest() of injector with the same configuration
+	 * @see validation_manifest()
+	 *
+	 * Works like injector(std::vector<std::unique_ptr<module>>). If @p validation_manifest matches configuration
+	 * of @p modules, searches for ambiguous types, unresolvable dependencies, dependencies on scoped types and
+	 * cycles of prototypes are skipped. Otherwise full validation is done and the same exceptions are thrown.
+	 */
+	explicit injector(std::vector<std::unique_ptr<module>> modules, const std::string &validation_manifest);
+
+	/**
+	 * @brief Create new injector from provided modules with set of parent injectors, skipping validation if
+	 * @p validation_manifest matches.
+	 * @param super_injectors list of injectors providing types for this one to use
+	 * @param modules list of modules
+	 * @param validation_manifest result of validation_manifest() of injector with the same configuration
+	 * @see validation_manifest()
+	 *
+	 * Works like injector(std::vector<injector *>, std::vector<std::unique_ptr<module>>). Manifest also covers
+	 * types provided by @p super_injectors.
+	 */
+	explicit injector(std::vector<injector *> super_injectors, std::vector<std::unique_ptr<module>> modules, const std::string &validation_manifest);
+
 	injector(injector &&x);
 	~injector();
 
+	/**
+	 * @brief Set number of threads used to analyze types when injectors are created.
+	 * @param thread_count number of threads including calling one, 0 for number of hardware threads
+	 *
+	 * Creating injector requires analysis of each configured type - scanning its meta methods, validating setters
+	 * and creating providers. These are independent for each type, so with @p thread_count greater than 1
+	 * they are done on many threads at once. Results are merged in the same order as in single-threaded
+	 * analysis, so created injectors and thrown exceptions do not depend on this setting.
+	 *
+	 * Default value is 1. Setting applies to all injectors created after this call.
+	 */
+	static void set_analysis_thread_count(unsigned thread_count);
+
 	injector & operator = (injector &&x);
 
+	/**
+	 * @brief Return validation manifest of configuration of this injector.
+	 *
+	 * Manifest is a short text that identifies configuration of injector: its types with their kinds and
+	 * dependencies and types provided by super injectors. Each injector was validated when it was created, so
+	 * manifest means that configuration is valid. It is the same for each run of the same binary.
+	 *
+	 * Manifest is meant to be created at build time: small host executable creates injector with all modules
+	 * of application and writes manifest to file (see injeqt_add_validation_manifest in
+	 * cmake/injeqt-validation-manifest.cmake). Application passes content of this file to
+	 * injector(std::vector<std::unique_ptr<module>>, const std::string &) and validation is not repeated on
+	 * each launch. When configuration changes, manifest no longer matches and full validation is done again.
+	 *
+	 * Manifest is not signed with any key - it does not protect against intentionally forged files.
+	 *
+	 *     auto injector = injeqt::injector{std::move(modules)};
+	 *     std::ofstream{argv[1]} << injector.validation_manifest();
+	 */
+	std::string validation_manifest() const;
+
+	/**
+	 * @brief Add module to already working injector.
+	 * @param added_module module to add
+	 * @pre added_module != nullptr
+	 * @throw ambiguous_types if one or more types in @p added_module is ambiguous or is already available in injector
+	 * @throw unresolvable_dependencies if a type with unresolvable dependency is found in @p added_module
+	 * @throw unresolvable_dependencies if already configured type depends on interface that would become ambiguous
+	 * @throw dependency_on_self when type depends on self
+	 * @throw dependency_on_subtype when type depends on own supertype
+	 * @throw dependency_on_subtype when type depends on own subtype
+	 * @throw invalid_setter if any tagged setter has invalid parameter or parameters count
+	 * @throw dependency_on_scoped_type if type that is not scoped depends on scoped type
+	 *
+	 * Types of @p added_module become available as if module was passed to constructor. Setters are scanned only
+	 * for these types - dependencies of already configured types are reused. Other steps still go over all
+	 * configured types: types model with interface relations is rebuilt and whole configuration is validated
+	 * again, so cost of this call grows linearly with number of configured types (but is lower than cost of
+	 * creating new injector). Already created objects are kept alive and are not injected again.
+	 *
+	 * If new type shares an interface with already configured type, this interface is no longer available
+	 * (unless some configured type depends on it - then an exception is thrown). If an exception is thrown
+	 * injector is not modified.
+	 *
+	 * Types added to injector are not visible in its sub injectors created before this call.
+	 */
+	void add_module(std::unique_ptr<module> added_module);
+
+	/**
+	 * @brief Remove module from already working injector.
+	 * @param removed_module module to remove, passed to constructor or to add_module(std::unique_ptr<module>)
+	 * @pre removed_module != nullptr
+	 * @pre removed_module was passed to this injector
+	 * @throw unresolvable_dependencies if type that is left in injector depends on type of @p removed_module
+	 *
+	 * Objects created from types of @p removed_module are torn down: INJEQT_DONE methods are called on them
+	 * in reverse dependency order (dependents first) and then these are destroyed together with @p removed_module.
+	 * This includes objects of scoped types in active scopes and prototype objects that were not released.
+	 * Dependents are not torn down transitively - if type that is left depends on removed one with plain, lazy
+	 * or named setter or requires it in constructor, whole call is rejected with an exception. Remove modules
+	 * of dependents first. Objects of other types are not torn down. Objects that received injeqt::set_of<S>
+	 * with removed objects are injected again with new set, without them. If an exception is thrown injector
+	 * is not modified.
+	 *
+	 * Interfaces that were ambiguous only because of types of @p removed_module become available. All pending
+	 * asynchronous requests are canceled. Sub injectors must not use types of @p removed_module after this call.
+	 */
+	void remove_module(module *removed_module);
+
+	/**
+	 * @brief Replace object configured with module::add_ready_object<T>(QObject *) with @p object.
+	 * @tparam T type that object was configured with
+	 * @param object new object, must be of type T or inherit from it
+	 * @throw qobject_type if @tparam T represents QObject
+	 * @throw invalid_qobject if @p object is nullptr or does not have valid QMetaObject
+	 * @throw interface_not_implemented if @p object does not implement @tparam T
+	 * @throw unknown_type if @tparam T was not configured with module::add_ready_object<T>(QObject *)
+	 *
+	 * Use it for configuration changes at runtime. Objects that were already injected with previous object
+	 * are injected with @p object - only their setters are called, they are not created again and INJEQT_INIT
+	 * methods are not called. Other objects are not touched. This also applies to objects passed to
+	 * inject_into(QObject *) that still exist.
+	 *
+	 * Objects of sub injectors (created with this injector as one of super injectors) that were injected with
+	 * previous object are injected with @p object as well.
+	 *
+	 * Previous object is not destroyed - it was not owned by injector. Lazy handles that were already resolved
+	 * keep previous object.
+	 *
+	 *     injector.replace_ready_object<settings>(new_settings.get());
+	 */
+	template<typename T>
+	void replace_ready_object(QObject *object)
+	{
+		replace_ready_object(make_type<T>(), object);
+	}
+
 	/**
 	 * @brief Instantiates object of given type @tparam T
 	 * @tparam T type of object to instantiate
@@ -160,6 +330,222 @@ public:
 		return qobject_cast<T *>(get(make_type<T>()));
 	}
 
+	/**
+	 * @brief Returns pointer to object of given type T or nullptr if T is not configured.
+	 * @tparam T type of object to return
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 * @throw no_active_scope if T is scoped and there is no active scope
+	 *
+	 * Works like get&lt;T&gt;(), but type that is not configured in injector is reported with nullptr instead
+	 * of unknown_type exception. No exception is thrown and no memory is allocated in that case, so this method
+	 * can be used to probe for optional services in tight loops.
+	 */
+	template<typename T>
+	T * try_get()
+	{
+		return qobject_cast<T *>(try_get(make_type<T>()));
+	}
+
+	/**
+	 * @brief Returns pointer to object of given type T or nullptr, reporting reason in @p status.
+	 * @tparam T type of object to return
+	 * @param status set to status of request
+	 *
+	 * Works like try_get&lt;T&gt;(), but failed instantiation is also reported with nullptr and try_status::failed
+	 * instead of an exception.
+	 */
+	template<typename T>
+	T * try_get(try_status &status)
+	{
+		return qobject_cast<T *>(try_get(make_type<T>(), status));
+	}
+
+	/**
+	 * @brief Instantiates object of given type T if it is configured.
+	 * @tparam T type of object to instantiate
+	 * @return false if T is not configured in injector
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 *
+	 * Works like instantiate&lt;T&gt;(), but type that is not configured in injector is reported with false
+	 * instead of unknown_type exception.
+	 */
+	template<typename T>
+	bool try_instantiate()
+	{
+		return try_instantiate(make_type<T>());
+	}
+
+	/**
+	 * @brief Instantiates object of given type T if it is configured, reporting result in @p status.
+	 * @tparam T type of object to instantiate
+	 * @param status set to status of request
+	 * @return true if status was set to try_status::ok
+	 */
+	template<typename T>
+	bool try_instantiate(try_status &status)
+	{
+		return try_instantiate(make_type<T>(), status);
+	}
+
+	/**
+	 * @brief Returns future of object of given type T without blocking.
+	 * @tparam T type of object to return
+	 * @throw qobject_type if T is QObject
+	 * @throw unknown_type if T was not configured in injector
+	 *
+	 * Object is created as with get&lt;T&gt;(), but default constructors of T and of all its not yet created
+	 * dependencies are invoked in parallel on QThreadPool::globalInstance(). Constructed objects are moved
+	 * to the calling thread and all remaining work - factories, setters and INJEQT_INIT methods - is done
+	 * on that thread from its event loop. Result is available when event loop of calling thread processes
+	 * it, so this method must only be called from thread with running event loop. Default constructors of
+	 * configured types must be safe to call from any thread.
+	 *
+	 * If object is already available, returned future is already finished. If instantiation fails or
+	 * injector is destroyed before it finishes, future is canceled - then get&lt;T&gt;() can be used to receive
+	 * the exception. Scoped and prototype types are created immediately.
+	 *
+	 * Example:
+	 *
+	 *     auto watcher = new QFutureWatcher<service *>{};
+	 *     QObject::connect(watcher, &QFutureWatcher<service *>::finished, [=]{ watcher->result()->run(); });
+	 *     watcher->setFuture(injector.get_async<service>());
+	 */
+	template<typename T>
+	QFuture<T *> get_async()
+	{
+		auto result = QFutureInterface<T *>{};
+		result.reportStarted();
+		get_async(make_type<T>(), [result](QObject *object) mutable {
+			if (object)
+				result.reportResult(qobject_cast<T *>(object));
+			else
+				result.reportCanceled();
+			result.reportFinished();
+		});
+		return result.future();
+	}
+
+	/**
+	 * @brief Instantiates object of given type T without blocking.
+	 * @tparam T type of object to instantiate
+	 * @throw qobject_type if T is QObject
+	 * @throw unknown_type if T was not configured in injector
+	 * @see get_async<T>()
+	 */
+	template<typename T>
+	QFuture<void> instantiate_async()
+	{
+		auto result = QFutureInterface<void>{};
+		result.reportStarted();
+		get_async(make_type<T>(), [result](QObject *object) mutable {
+			if (!object)
+				result.reportCanceled();
+			result.reportFinished();
+		});
+		return result.future();
+	}
+
+	/**
+	 * @brief Returns lazy handle to object of given type T.
+	 * @tparam T type of object to return handle to
+	 * @throw qobject_type if T is QObject
+	 * @throw unknown_type if T was not configured in injector
+	 *
+	 * No object is created by this method. Object of type T (with all its dependencies) is created
+	 * on first call to lazy_handle::get() - exactly as with get&lt;T&gt;() - and later calls return the
+	 * same object. Handle must not be used after injector is destroyed.
+	 *
+	 * Example:
+	 *
+	 *     auto s = injector.get_lazy<service>(); // nothing is created yet
+	 *     s.get<service>()->run(); // service is created here
+	 */
+	template<typename T>
+	lazy<T> get_lazy()
+	{
+		return get_lazy(make_type<T>());
+	}
+
+	/**
+	 * @brief Returns set of objects added to set of type S.
+	 * @tparam S type of set
+	 * @throw qobject_type if S is QObject
+	 * @throw instantiation_failed if instantiation of one of members failed
+	 *
+	 * All members are created on first request of set, then the same list is returned from each
+	 * call and injected into each setter with injeqt::set_of<S> parameter. Set that has no members
+	 * is empty.
+	 *
+	 * Example:
+	 *
+	 *     for (auto &&p : injector.get_set<plugin>())
+	 *         qobject_cast<plugin *>(p)->load();
+	 *
+	 * @see module::add_to_set<S, T>()
+	 */
+	template<typename S>
+	set_of<S> get_set()
+	{
+		return get_set(make_type<S>());
+	}
+
+	/**
+	 * @brief Returns factory creating objects of type T from runtime arguments Args.
+	 * @tparam T type of created objects
+	 * @tparam Args types of runtime arguments passed to constructor of T
+	 * @throw qobject_type if T is QObject
+	 * @throw invalid_setter if any tagged setter of T is not valid (the same as in inject_into(QObject *))
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 *
+	 * Type T does not have to be configured in injector. Its dependencies are extracted and resolved once,
+	 * when factory is created, so each call of factory only constructs object with given arguments and calls
+	 * its setters and INJEQT_INIT methods. Objects of scoped and prototype types are still resolved on each
+	 * call. Created objects are owned by caller.
+	 *
+	 * Example:
+	 *
+	 *     auto make_connection = injector.make_assisted_factory<connection, int>();
+	 *     auto c = make_connection(42); // same as new connection{42} followed by inject_into
+	 *
+	 * @see assisted_factory
+	 */
+	template<typename T, typename ...Args>
+	assisted_factory<T, Args...> make_assisted_factory()
+	{
+		return assisted_factory<T, Args...>{make_assisted_injection(make_type<T>())};
+	}
+
+	/**
+	 * @brief Returns pointers to objects of given types in order of @p interface_types.
+	 * @param interface_types types of objects to return
+	 * @throw empty_type if any of interface_types is empty
+	 * @throw qobject_type if any of interface_types represents QObject
+	 * @throw unknown_type if any of @p interface_types was not configured in injector
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 * @throw no_active_scope if any of @p interface_types is scoped and there is no active scope
+	 *
+	 * Result is the same as calling get(const type &) for each type, but dependencies of all requested
+	 * types are computed once and all missing objects are created, injected and initialized in one pass.
+	 * Use it when many types are requested at once, for example when bootstrapping components.
+	 *
+	 *     auto objects = injector.get_all({make_type<service_1>(), make_type<service_2>()});
+	 */
+	std::vector<QObject *> get_all(const std::vector<type> &interface_types);
+
+	/**
+	 * @brief Replace object configured with module::add_ready_object<T>(QObject *) with @p object.
+	 * @param object_type type that object was configured with
+	 * @param object new object, must be of type @p object_type or inherit from it
+	 * @throw empty_type if @p object_type is empty
+	 * @throw qobject_type if @p object_type represents QObject
+	 * @throw invalid_qobject if @p object is nullptr or does not have valid QMetaObject
+	 * @throw interface_not_implemented if @p object does not implement @p object_type
+	 * @throw unknown_type if @p object_type was not configured as ready object
+	 *
+	 * @see replace_ready_object<T>(QObject *)
+	 */
+	void replace_ready_object(const type &object_type, QObject *object);
+
 	/**
 	 * @brief Returns all objects with given @p type_role.
 	 * @throw instantiation_failed if instantiation of one of found types failed
@@ -182,6 +568,73 @@ public:
 	 */
 	void instantiate_all_with_type_role(const std::string &type_role);
 
+	/**
+	 * @brief Instantiate all objects with given @p type_role incrementally from event loop.
+	 * @param type_role type role of objects to instantiate
+	 * @param slice_budget maximum time spent on instantiation before returning to event loop
+	 * @param on_finished function called when all objects were instantiated, may be empty
+	 *
+	 * This is non-blocking version of instantiate_all_with_type_role(const std::string &). Objects are
+	 * instantiated one by one, dependencies first, in slices run from event loop of current thread with
+	 * zero-interval timer. Each slice stops after @p slice_budget is exceeded (it can exceed it by time
+	 * of instantiating one object), so other events - like painting - are processed between slices.
+	 *
+	 * Objects requested with get&lt;T&gt;() during warmup are created immediately with their dependencies
+	 * and are skipped by warmup later. Types that fail to instantiate are skipped as well - requesting them
+	 * with get&lt;T&gt;() reports the error. Starting new warmup stops the previous one.
+	 *
+	 * Example:
+	 *
+	 *     injector.start_warmup_with_type_role("service", std::chrono::milliseconds{4}, []{ qDebug() << "warm"; });
+	 */
+	void start_warmup_with_type_role(const std::string &type_role, std::chrono::milliseconds slice_budget = std::chrono::milliseconds{4},
+		std::function<void()> on_finished = std::function<void()>{});
+
+	/**
+	 * @return true if warmup was started and is not finished yet
+	 */
+	bool is_warming_up() const;
+
+	/**
+	 * @brief Start recording order of first use of types for @p duration from now.
+	 * @param duration length of recording window
+	 *
+	 * First request of each type made with get&lt;T&gt;(), instantiate&lt;T&gt;() or get_async&lt;T&gt;() in recording
+	 * window is recorded with its time. Requests made with get&lt;T&gt;() and instantiate&lt;T&gt;() are marked as
+	 * critical, as caller is blocked by them. Recorded profile can be saved with save_profile(const std::string &)
+	 * and used in next run with start_prewarm_from_profile(const std::string &, std::chrono::milliseconds,
+	 * std::function<void()>).
+	 *
+	 * Example:
+	 *
+	 *     if (!injector.start_prewarm_from_profile(profile_file_name))
+	 *         injector.start_profile_recording(std::chrono::seconds{5});
+	 *     // ... later, after startup
+	 *     injector.save_profile(profile_file_name);
+	 */
+	void start_profile_recording(std::chrono::milliseconds duration);
+
+	/**
+	 * @brief Save profile recorded after start_profile_recording(std::chrono::milliseconds) to @p file_name.
+	 * @param file_name name of file to write profile to
+	 * @return false if file could not be written
+	 */
+	bool save_profile(const std::string &file_name) const;
+
+	/**
+	 * @brief Instantiate types from profile saved in @p file_name incrementally from event loop.
+	 * @param file_name name of file with profile
+	 * @param slice_budget maximum time spent on instantiation before returning to event loop
+	 * @param on_finished function called when all objects were instantiated, may be empty
+	 * @return false if profile could not be read
+	 *
+	 * Works like start_warmup_with_type_role(const std::string &, std::chrono::milliseconds, std::function<void()>),
+	 * but plan is taken from profile: critical types first, in order of first use. Types from profile that are
+	 * no longer configured in injector are skipped, so profile saved with other set of modules is safe to use.
+	 */
+	bool start_prewarm_from_profile(const std::string &file_name, std::chrono::milliseconds slice_budget = std::chrono::milliseconds{4},
+		std::function<void()> on_finished = std::function<void()>{});
+
 	/**
 	 * @brief Returns pointer to object of given type interface_type.
 	 * @param interface_type type of object to return
@@ -189,11 +642,85 @@ public:
 	 * @throw qobject_type if interface_type represents QObject
 	 * @throw unknown_type if @p interface_type was not configured in injector
 	 * @throw instantiation_failed if instantiation of one of required types failed
+	 * @throw no_active_scope if @p interface_type is scoped and there is no active scope
 	 *
 	 * @see T * get<T>()
 	 */
 	QObject * get(const type &interface_type);
 
+	/**
+	 * @brief Returns pointer to object of given type interface_type or nullptr if it is not configured.
+	 * @param interface_type type of object to return
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 * @throw no_active_scope if @p interface_type is scoped and there is no active scope
+	 *
+	 * @see T * try_get<T>()
+	 */
+	QObject * try_get(const type &interface_type);
+
+	/**
+	 * @brief Returns pointer to object of given type interface_type or nullptr, reporting reason in @p status.
+	 * @param interface_type type of object to return
+	 * @param status set to status of request
+	 *
+	 * @see T * try_get<T>(try_status &)
+	 */
+	QObject * try_get(const type &interface_type, try_status &status);
+
+	/**
+	 * @brief Instantiates object of given type interface_type if it is configured.
+	 * @param interface_type type of object to instantiate
+	 * @return false if @p interface_type is not configured in injector
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 *
+	 * @see bool try_instantiate<T>()
+	 */
+	bool try_instantiate(const type &interface_type);
+
+	/**
+	 * @brief Instantiates object of given type interface_type if it is configured, reporting result in @p status.
+	 * @param interface_type type of object to instantiate
+	 * @param status set to status of request
+	 * @return true if status was set to try_status::ok
+	 *
+	 * @see bool try_instantiate<T>(try_status &)
+	 */
+	bool try_instantiate(const type &interface_type, try_status &status);
+
+	/**
+	 * @brief Requests object of given type interface_type without blocking.
+	 * @param interface_type type of object to return
+	 * @param on_ready called with object or with nullptr if instantiation failed or was canceled
+	 * @throw empty_type if interface_type is empty
+	 * @throw qobject_type if interface_type represents QObject
+	 * @throw unknown_type if @p interface_type was not configured in injector
+	 *
+	 * @see QFuture<T *> get_async<T>()
+	 */
+	void get_async(const type &interface_type, std::function<void(QObject *)> on_ready);
+
+	/**
+	 * @brief Returns lazy handle to object of given type interface_type.
+	 * @param interface_type type of object to return handle to
+	 * @throw empty_type if interface_type is empty
+	 * @throw qobject_type if interface_type represents QObject
+	 * @throw unknown_type if @p interface_type was not configured in injector
+	 *
+	 * @see lazy<T> get_lazy<T>()
+	 */
+	lazy_handle get_lazy(const type &interface_type);
+
+	/**
+	 * @brief Returns set of objects added to set of type set_type.
+	 * @param set_type type of set
+	 * @throw empty_type if set_type is empty
+	 * @throw qobject_type if set_type represents QObject
+	 * @throw instantiation_failed if instantiation of one of members failed
+	 *
+	 * @see set_of<S> get_set<S>()
+	 */
+	object_set get_set(const type &set_type);
+
 	/**
 	 * @brief Inject dependencies into @p object.
 	 * @param object object to inject dependencies into.
@@ -210,6 +737,68 @@ public:
 	 */
 	void inject_into(QObject *object);
 
+	/**
+	 * @brief Returns precomputed injection of dependencies into objects of type object_type.
+	 * @param object_type type of objects to inject into
+	 * @throw empty_type if object_type is empty
+	 * @throw qobject_type if object_type represents QObject
+	 * @throw invalid_setter if any tagged setter of object_type is not valid (the same as in inject_into(QObject *))
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 *
+	 * @see assisted_factory<T, Args...> make_assisted_factory<T, Args...>()
+	 */
+	assisted_injection make_assisted_injection(const type &object_type);
+
+	/**
+	 * @brief Start new scope for scoped types.
+	 *
+	 * After this call each object of type configured with module::add_scoped_type<T>() is created once
+	 * for this scope and then returned from all calls to get<T>() and injected into all other scoped
+	 * objects until leave_scope() is called. Scopes can be nested - only the innermost one is used.
+	 *
+	 * Objects of types that are not scoped are not affected by scopes and are shared by all of them.
+	 *
+	 * Example usage:
+	 *
+	 *     injector.enter_scope();
+	 *     auto r1 = injector.get<request>();
+	 *     auto r2 = injector.get<request>(); // r2 == r1
+	 *     injector.leave_scope(); // r1 is destroyed
+	 */
+	void enter_scope();
+
+	/**
+	 * @brief End innermost scope.
+	 * @throw no_active_scope if there is no active scope
+	 *
+	 * All INJEQT_DONE methods of objects created in this scope are called in reverse order of creation.
+	 * Then all these objects are destroyed in one pass. All scopes that are still active are ended when
+	 * injector is destroyed.
+	 */
+	void leave_scope();
+
+	/**
+	 * @brief Give back prototype @p object to injector.
+	 * @param object object of type configured with module::add_prototype<T>() returned by this injector
+	 * @throw invalid_qobject if @p object is nullptr
+	 * @throw invalid_qobject if @p object was not created as prototype by this injector nor by any of super injectors
+	 *
+	 * All methods of @p object tagged with INJEQT_RESET are called and object is put into pool of its type
+	 * to be returned from next get<T>() call or injected into next object without creating it again. Its
+	 * dependencies are not set again and its INJEQT_INIT methods are not called again. If pool is full
+	 * INJEQT_DONE methods are called and @p object is destroyed.
+	 *
+	 * Caller must not use @p object after this call.
+	 *
+	 * Example usage:
+	 *
+	 *     auto b = injector.get<buffer>();
+	 *     // use b
+	 *     injector.release(b);
+	 *     auto c = injector.get<buffer>(); // c == b if pool capacity of buffer is greater than 0
+	 */
+	void release(QObject *object);
+
 private:
 	std::unique_ptr<injeqt::internal::injector_impl> _pimpl;
 
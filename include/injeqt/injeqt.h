@@ -31,6 +31,7 @@
 #ifndef Q_MOC_RUN
 #  define INJEQT_INIT
 #  define INJEQT_DONE
+#  define INJEQT_RESET
 #  define INJEQT_SET
 // depreceated, use INJEQT_SET instead
 #  define INJEQT_SETTER
@@ -39,6 +40,9 @@
 #define INJEQT_TYPE_ROLE_CLASSINFO_NAME "injeqt.type-role"
 #define INJEQT_TYPE_ROLE(N) Q_CLASSINFO(INJEQT_TYPE_ROLE_CLASSINFO_NAME, N)
 
+#define INJEQT_NAMED_CLASSINFO_PREFIX "injeqt.named."
+#define INJEQT_NAMED(S, N) Q_CLASSINFO(INJEQT_NAMED_CLASSINFO_PREFIX #S, N)
+
 namespace injeqt {
 	namespace v1 { }
 	using namespace v1;
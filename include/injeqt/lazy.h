@@ -0,0 +1,134 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include <memory>
+#include <QtCore/QObject>
+
+/**
+ * @file
+ * @brief Contains classes and functions for lazy access to objects.
+ */
+
+namespace injeqt { namespace internal {
+	class lazy_state;
+}}
+
+namespace injeqt { namespace v1 {
+
+/**
+ * @brief Handle to object that is created on first access.
+ *
+ * Lazy handle is returned by injector::get_lazy<T>() and can be injected using setters with
+ * parameter of type injeqt::lazy<T>. Object is not created (nor any of its dependencies) until
+ * get() is called for the first time. All copies of handle share the same object.
+ *
+ * Calls of get() on handles of one injector are serialized: if get() is called from many threads at
+ * once, only one object is created and all threads receive it. Resolving is not synchronized with other
+ * methods of injector, so while any handle can still resolve its object, injector must not be used from
+ * other threads (this is the same rule as for injector itself). Already resolved handles can be used
+ * from any thread. Handle must not be used after injector that created it is destroyed.
+ *
+ * Example of setter accepting lazy handle:
+ *
+ *     class with_lazy_setter : public QObject
+ *     {
+ *         Q_OBJECT
+ *     public:
+ *         void rarely_called() { _service.get<service>()->work(); }
+ *     private slots:
+ *         INJEQT_SET void set_service(injeqt::lazy<service> s) { _service = s; }
+ *     private:
+ *         injeqt::lazy<service> _service;
+ *     };
+ *
+ * Setter parameter must be spelled as injeqt::lazy<T> (or lazy<T> with proper using directive) as Injeqt
+ * reads type T from name of parameter type.
+ */
+class INJEQT_API lazy_handle final
+{
+
+public:
+	/**
+	 * @brief Create empty handle.
+	 */
+	lazy_handle();
+
+	/**
+	 * @brief Create handle with given state.
+	 *
+	 * Direct instantiations of this class with this constructor should not be needed in user code.
+	 */
+	explicit lazy_handle(std::shared_ptr<internal::lazy_state> state);
+
+	/**
+	 * @return true if handle is empty
+	 */
+	bool is_empty() const;
+
+	/**
+	 * @pre !is_empty()
+	 * @return type of object that this handle gives access to
+	 */
+	type object_type() const;
+
+	/**
+	 * @pre !is_empty()
+	 * @return true if object was already created
+	 */
+	bool is_resolved() const;
+
+	/**
+	 * @pre !is_empty()
+	 * @return object, created on first call
+	 * @throw instantiation_failed if instantiation of object or one of its dependencies failed
+	 */
+	QObject * get() const;
+
+	/**
+	 * @pre !is_empty()
+	 * @return object cast to T, created on first call
+	 * @throw instantiation_failed if instantiation of object or one of its dependencies failed
+	 */
+	template<typename T>
+	T * get() const
+	{
+		return qobject_cast<T *>(get());
+	}
+
+private:
+	std::shared_ptr<internal::lazy_state> _state;
+
+};
+
+/**
+ * @brief Lazy handle to object of type T.
+ *
+ * This is an alias of lazy_handle. Type T is only used by Injeqt to read type of injected object
+ * from setter signatures.
+ */
+template<typename T>
+using lazy = lazy_handle;
+
+}}
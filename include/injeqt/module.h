@@ -23,13 +23,17 @@
 #include <injeqt/injeqt.h>
 #include <injeqt/type.h>
 
+#include <cstddef>
 #include <memory>
+#include <string>
 
 /**
  * @file
  * @brief Contains classes and functions for creating modules.
  */
 
+class QThread;
+
 namespace injeqt { namespace internal {
 	class injector_impl;
 	class module_impl;
@@ -52,7 +56,10 @@ namespace injeqt { namespace v1 {
  * is only required for a group of modules passed into injector.
  *
  * Module configuration is done by calling any of add_* method. Currently implemnted are:
- * add_ready_object, add_type, add_factory.
+ * add_ready_object, add_type, add_thread_affine_type, add_scoped_type, add_prototype, add_factory, add_to_set.
+ *
+ * Ready objects and default-constructed types can be also added under name, with add_ready_object<T>(QObject *, const std::string &)
+ * and add_type<T>(const std::string &). These are only injected by setters qualified with INJEQT_NAMED.
  */
 class INJEQT_API module
 {
@@ -122,13 +129,29 @@ protected:
 	 * @brief Add type that can be default-constructed to module.
 	 * @tparam T type added to module (must be inherited from QObject).
 	 * @throw qobject_type when passed type @p T represents QObject
-	 * @throw default_constructor_not_found is @p T does not have default constructor tagged with Q_INVOKABLE
+	 * @throw default_constructor_not_found is @p T does not have default constructor nor injection constructor tagged with Q_INVOKABLE
 	 *
 	 * When an object of that type (or one of inherited types) is requested from injector or
 	 * as a dependency to other objects then default constructor of T is invoked to create it.
 	 * This constructor must be marked with Q_INVOKABLE macro and must not have any parameters
 	 * (even with default values). In other cases this method will throw an exception.
 	 *
+	 * Type without default constructor can have injection constructor instead - Q_INVOKABLE constructor
+	 * that only accepts pointers to other configured types. Objects of these types are created first
+	 * and passed to constructor in one call, so object of T is complete just after construction and
+	 * does not need INJEQT_SET setters for them:
+	 *
+	 *     class injected : public QObject
+	 *     {
+	 *         Q_OBJECT
+	 *     public:
+	 *         Q_INVOKABLE injected(injectable *i) : _i{i} {}
+	 *     private:
+	 *         injectable *_i;
+	 *     };
+	 *
+	 * Types passed to injection constructors can not depend on each other in cycle.
+	 *
 	 * After object of type T is created it will be injected will all required dependencies
 	 * and it will remain in cache until owning injector object exists. Onle one instance of
 	 * T will exist at one time inside injector (this may change when in future scope abstraction
@@ -164,6 +187,175 @@ protected:
 		add_type(make_type<T>());
 	}
 
+	/**
+	 * @brief Add already constructed object to module under given name.
+	 * @tparam T type of added object (must be inherited from QObject).
+	 * @param object added object
+	 * @param name name of binding, must not be empty
+	 * @throw qobject_type when passed type @p T represents QObject
+	 * @throw invalid_qobject when passed @p object is nullptr or does not have valid QMetaObject
+	 * @throw interface_not_implemented when passed @p object does not implements type @p T
+	 *
+	 * Works like add_ready_object<T>(QObject *), but object is not available with injector::get<T>() and is
+	 * not injected into unqualified setters. It is only injected into setters accepting T * that are qualified
+	 * with the same @p name:
+	 *
+	 *     class client : public QObject
+	 *     {
+	 *         Q_OBJECT
+	 *         INJEQT_NAMED(set_pool, "primary")
+	 *     private slots:
+	 *         INJEQT_SET void set_pool(pool *p) { _pool = p; }
+	 *     };
+	 *
+	 * Many objects of the same type can be added under different names. Pair of type and name must be unique
+	 * in injector. Named objects are not visible to sub injectors.
+	 */
+	template<typename T>
+	void add_ready_object(QObject *object, const std::string &name)
+	{
+		add_ready_object(make_type<T>(), object, name);
+	}
+
+	/**
+	 * @brief Add type that can be default-constructed to module under given name.
+	 * @tparam T type added to module (must be inherited from QObject).
+	 * @param name name of binding, must not be empty
+	 * @throw qobject_type when passed type @p T represents QObject
+	 * @throw default_constructor_not_found is @p T does not have default constructor tagged with Q_INVOKABLE
+	 *
+	 * Works like add_type<T>(), but object is only injected into setters qualified with the same @p name,
+	 * see add_ready_object<T>(QObject *, const std::string &). One object is created for each name, when it is
+	 * injected for the first time. Its dependencies are injected and INJEQT_INIT methods are called as
+	 * for other objects. Type T can be added with and without name in the same injector.
+	 */
+	template<typename T>
+	void add_type(const std::string &name)
+	{
+		add_type(make_type<T>(), name);
+	}
+
+	/**
+	 * @brief Add type that is default-constructed on given thread to module.
+	 * @tparam T type added to module (must be inherited from QObject).
+	 * @param thread thread that object of type T will live in
+	 * @throw qobject_type when passed type @p T represents QObject
+	 * @throw default_constructor_not_found is @p T does not have default constructor tagged with Q_INVOKABLE
+	 *
+	 * Works like add_type<T>(), but default constructor of T is invoked on @p thread even if object is
+	 * requested from another one, so object is created with proper thread affinity and does not need to be
+	 * moved later. Its INJEQT_INIT methods are called on @p thread as well. Requesting thread waits until
+	 * both are done.
+	 *
+	 * While @p thread is running it must run an event loop and must not wait for thread requesting object
+	 * of type T. If @p thread is not running object is created on requesting thread and moved to @p thread.
+	 * Module does not take ownership of @p thread.
+	 *
+	 * Example usage:
+	 *
+	 *     class network_service : public QObject
+	 *     {
+	 *         Q_OBJECT
+	 *     public:
+	 *         Q_INVOKABLE network_service() {}
+	 *     };
+	 *
+	 *     class network_module : public module
+	 *     {
+	 *         network_module(QThread *network_thread)
+	 *         {
+	 *              add_thread_affine_type<network_service>(network_thread);
+	 *         }
+	 *     };
+	 */
+	template<typename T>
+	void add_thread_affine_type(QThread *thread)
+	{
+		add_thread_affine_type(make_type<T>(), thread);
+	}
+
+	/**
+	 * @brief Add type that is default-constructed once per scope to module.
+	 * @tparam T type added to module (must be inherited from QObject).
+	 * @throw qobject_type when passed type @p T represents QObject
+	 * @throw default_constructor_not_found is @p T does not have default constructor tagged with Q_INVOKABLE
+	 *
+	 * Works like add_type<T>(), but object of type T is bound to scope started with injector::enter_scope().
+	 * Each scope gets own object of type T, that is destroyed with all other objects of scope when
+	 * injector::leave_scope() is called. Requesting object of type T when no scope is active results in
+	 * no_active_scope exception.
+	 *
+	 * Scoped types can depend on any other types. Types that are not scoped cannot depend on scoped ones,
+	 * as these live shorter - injector will throw dependency_on_scoped_type in that case.
+	 *
+	 * Example usage:
+	 *
+	 *     class request : public QObject
+	 *     {
+	 *         Q_OBJECT
+	 *     public:
+	 *         Q_INVOKABLE request() {}
+	 *     };
+	 *
+	 *     class request_module : public module
+	 *     {
+	 *         request_module()
+	 *         {
+	 *              add_scoped_type<request>();
+	 *         }
+	 *     };
+	 */
+	template<typename T>
+	void add_scoped_type()
+	{
+		add_scoped_type(make_type<T>());
+	}
+
+	/**
+	 * @brief Add type that is default-constructed for each request to module.
+	 * @tparam T type added to module (must be inherited from QObject).
+	 * @param pool_capacity maximum number of released objects of type T kept for reuse
+	 * @throw qobject_type when passed type @p T represents QObject
+	 * @throw default_constructor_not_found is @p T does not have default constructor tagged with Q_INVOKABLE
+	 *
+	 * Works like add_type<T>(), but new object of type T is created for each call to injector::get<T>()
+	 * and for each object that depends on T. Injector owns all these objects until these are given back with
+	 * injector::release(QObject *).
+	 *
+	 * Released objects have all methods tagged with INJEQT_RESET called and up to @p pool_capacity of them
+	 * are kept for reuse. Reused objects are not created, injected and initialized again, so INJEQT_RESET
+	 * methods must bring them back to state just after INJEQT_INIT methods were called.
+	 *
+	 * Prototype types can depend on other prototype types, but not in cycle. As pooled objects keep their
+	 * dependencies, prototype types cannot depend on scoped types.
+	 *
+	 * Example usage:
+	 *
+	 *     class buffer : public QObject
+	 *     {
+	 *         Q_OBJECT
+	 *     public:
+	 *         Q_INVOKABLE buffer() {}
+	 *     private slots:
+	 *         INJEQT_RESET void reset() { _data.clear(); }
+	 *     private:
+	 *         QByteArray _data;
+	 *     };
+	 *
+	 *     class buffer_module : public module
+	 *     {
+	 *         buffer_module()
+	 *         {
+	 *              add_prototype<buffer>(16);
+	 *         }
+	 *     };
+	 */
+	template<typename T>
+	void add_prototype(std::size_t pool_capacity = 0)
+	{
+		add_prototype(make_type<T>(), pool_capacity);
+	}
+
 	/**
 	 * @brief Add type that can be created by factory to module.
 	 * @tparam T type added to module (must be inherited from QObject).
@@ -232,6 +424,51 @@ protected:
 		add_factory(make_type<T>(), make_type<F>());
 	}
 
+	/**
+	 * @brief Add type T to set of type S.
+	 * @tparam S type of set (must be inherited from QObject)
+	 * @tparam T type of member (must implement S)
+	 * @throw qobject_type when passed type @p S represents QObject
+	 * @throw interface_not_implemented when type @p T does not implement type @p S
+	 *
+	 * Sets allow many modules to contribute implementations of one interface, for example plugins. Type T
+	 * is not configured by this call - it must be also added to any module of the same injector with other
+	 * add_* method. Set type S itself does not have to be configured.
+	 *
+	 * Set is created once, when injector::get_set<S>() is called or when it is injected for the first time,
+	 * and is shared by all consumers. Scoped types can not be members of sets.
+	 *
+	 * Example usage:
+	 *
+	 *     class plugin : public QObject
+	 *     {
+	 *         Q_OBJECT
+	 *     };
+	 *
+	 *     class spell_checker_plugin : public plugin
+	 *     {
+	 *         Q_OBJECT
+	 *     public:
+	 *         Q_INVOKABLE spell_checker_plugin() {}
+	 *     };
+	 *
+	 *     class spell_checker_module : public module
+	 *     {
+	 *         spell_checker_module()
+	 *         {
+	 *              add_type<spell_checker_plugin>();
+	 *              add_to_set<plugin, spell_checker_plugin>();
+	 *         }
+	 *     };
+	 *
+	 * @see object_set
+	 */
+	template<typename S, typename T>
+	void add_to_set()
+	{
+		add_to_set(make_type<S>(), make_type<T>());
+	}
+
 private:
 	friend class ::injeqt::internal::injector_impl;
 	std::unique_ptr<injeqt::internal::module_impl> _pimpl;
@@ -248,6 +485,39 @@ private:
 	 */
 	void add_type(type t);
 
+	/**
+	 * @see add_ready_object<T>(QObject *, const std::string &);
+	 * @pre !t.is_empty()
+	 * @pre !name.empty()
+	 */
+	void add_ready_object(type t, QObject *object, const std::string &name);
+
+	/**
+	 * @see add_type<T>(const std::string &);
+	 * @pre !t.is_empty()
+	 * @pre !name.empty()
+	 */
+	void add_type(type t, const std::string &name);
+
+	/**
+	 * @see add_thread_affine_type<T>(QThread *);
+	 * @pre !t.is_empty()
+	 * @pre thread != nullptr
+	 */
+	void add_thread_affine_type(type t, QThread *thread);
+
+	/**
+	 * @see add_scoped_type<T>();
+	 * @pre !t.is_empty()
+	 */
+	void add_scoped_type(type t);
+
+	/**
+	 * @see add_prototype<T>(std::size_t);
+	 * @pre !t.is_empty()
+	 */
+	void add_prototype(type t, std::size_t pool_capacity);
+
 	/**
 	 * @see add_factory<T, F>();
 	 * @pre !t.is_empty()
@@ -255,6 +525,13 @@ private:
 	 */
 	void add_factory(type t, type f);
 
+	/**
+	 * @see add_to_set<S, T>();
+	 * @pre !s.is_empty()
+	 * @pre !t.is_empty()
+	 */
+	void add_to_set(type s, type t);
+
 };
 
 }}
@@ -0,0 +1,136 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include <memory>
+#include <vector>
+#include <QtCore/QObject>
+
+/**
+ * @file
+ * @brief Contains classes and functions for accessing sets of objects contributed by many modules.
+ */
+
+namespace injeqt { namespace v1 {
+
+/**
+ * @brief Shared list of objects that are members of one set.
+ *
+ * Modules add implementations to a set of type S with module::add_to_set<S, T>(). Object set
+ * is returned by injector::get_set<S>() and can be injected using setters with parameter of type
+ * injeqt::set_of<S>. All member objects are created when set is requested for the first time and are
+ * stored in one contiguous list that is shared by all copies of handle, so each consumer receives the
+ * same list without copying it.
+ *
+ * Objects are stored in order of modules and of module::add_to_set calls. Sets of sub injectors
+ * start with members of the same set of super injectors.
+ *
+ * Example of setter accepting set:
+ *
+ *     class plugin_registry : public QObject
+ *     {
+ *         Q_OBJECT
+ *     private slots:
+ *         INJEQT_SET void set_plugins(injeqt::set_of<plugin> plugins) { _plugins = plugins; }
+ *     private:
+ *         injeqt::set_of<plugin> _plugins;
+ *     };
+ *
+ * Setter parameter must be spelled as injeqt::set_of<S> (or set_of<S> with proper using directive) as
+ * Injeqt reads type S from name of parameter type. Handle must not be used after injector that created
+ * it is destroyed.
+ */
+class INJEQT_API object_set final
+{
+
+public:
+	using const_iterator = std::vector<QObject *>::const_iterator;
+
+	/**
+	 * @brief Create empty set.
+	 */
+	object_set();
+
+	/**
+	 * @brief Create set of given type with given objects.
+	 *
+	 * Direct instantiations of this class with this constructor should not be needed in user code.
+	 */
+	object_set(type set_type, std::shared_ptr<const std::vector<QObject *>> objects);
+
+	/**
+	 * @return type of set, empty if set was created with default constructor
+	 */
+	const type & set_type() const;
+
+	/**
+	 * @return all objects of set, in order of configuration
+	 */
+	const std::vector<QObject *> & objects() const;
+
+	/**
+	 * @return number of objects in set
+	 */
+	std::size_t size() const;
+
+	/**
+	 * @return true if set does not contain any objects
+	 */
+	bool empty() const;
+
+	const_iterator begin() const;
+	const_iterator end() const;
+
+	/**
+	 * @pre index < size()
+	 * @return object at @p index
+	 */
+	QObject * at(std::size_t index) const;
+
+	/**
+	 * @pre index < size()
+	 * @return object at @p index cast to T
+	 */
+	template<typename T>
+	T * at(std::size_t index) const
+	{
+		return qobject_cast<T *>(at(index));
+	}
+
+private:
+	type _set_type;
+	std::shared_ptr<const std::vector<QObject *>> _objects;
+
+};
+
+/**
+ * @brief Set of objects implementing T.
+ *
+ * This is an alias of object_set. Type T is only used by Injeqt to read type of injected set
+ * from setter signatures.
+ */
+template<typename T>
+using set_of = object_set;
+
+}}
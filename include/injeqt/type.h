@@ -57,7 +57,7 @@ namespace v1
  * Use convienance free function make_type&lt;T&gt; that also registers type T
  * in Qt meta-type that is required for Injeqt to function properly.
  *
- * Type name can be retrieived by name() member. Original QMetaObject can be read
+ * Type name can be retrieived by name() member or, without allocation, by c_name() member. Original QMetaObject can be read
  * using meta_object() member.
  *
  * Behavior for all methods is undefined if theirs preconditions are not met.
@@ -98,6 +98,15 @@ public:
 	 */
 	std::string name() const;
 
+	/**
+	 * @pre !is_empty()
+	 * @return unique name of type, without copying it
+	 *
+	 * Returned pointer is owned by QMetaObject of type and is valid as long as it - usually until
+	 * process exits.
+	 */
+	const char * c_name() const;
+
 	/**
 	 * Return base QMetaObject type. If type is not valid, result may be nullptr.
 	 */
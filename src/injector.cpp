@@ -21,10 +21,13 @@
 #include <injeqt/injector.h>
 
 #include <injeqt/exception/empty-type.h>
+#include <injeqt/exception/invalid-qobject.h>
 #include <injeqt/exception/qobject-type.h>
 #include <injeqt/module.h>
 
+#include "analysis-threads.h"
 #include "containers.h"
+#include "implementation.h"
 #include "injector-impl.h"
 #include "module-impl.h"
 #include "provider.h"
@@ -51,6 +54,17 @@ injector::injector(std::vector<injector *> super_injectors, std::vector<std::uni
 	_pimpl.reset(new ::injeqt::internal::injector_impl{transform(super_injectors, extract_impl), std::move(modules)});
 }
 
+injector::injector(std::vector<std::unique_ptr<module>> modules, const std::string &validation_manifest) :
+	_pimpl{new ::injeqt::internal::injector_impl{std::vector<injector_impl *>{}, std::move(modules), validation_manifest}}
+{
+}
+
+injector::injector(std::vector<injector *> super_injectors, std::vector<std::unique_ptr<module>> modules, const std::string &validation_manifest)
+{
+	auto extract_impl = std::function<injector_impl*(injector *)>([](injector *i){ return i->_pimpl.get(); });
+	_pimpl.reset(new ::injeqt::internal::injector_impl{transform(super_injectors, extract_impl), std::move(modules), validation_manifest});
+}
+
 injector::injector(injector &&x) :
 	_pimpl{std::move(x._pimpl)}
 {
@@ -60,6 +74,35 @@ injector::~injector()
 {
 }
 
+void injector::set_analysis_thread_count(unsigned thread_count)
+{
+	internal::set_analysis_thread_count(thread_count);
+}
+
+std::string injector::validation_manifest() const
+{
+	return _pimpl->validation_manifest();
+}
+
+void injector::add_module(std::unique_ptr<module> added_module)
+{
+	assert(added_module);
+
+	_pimpl->add_module(std::move(added_module));
+}
+
+void injector::remove_module(module *removed_module)
+{
+	assert(removed_module);
+
+	_pimpl->remove_module(removed_module);
+}
+
+void injector::replace_ready_object(const type &object_type, QObject *object)
+{
+	_pimpl->replace_ready_object(internal::make_implementation(object_type, object));
+}
+
 injector & injector::operator = (injector &&x)
 {
 	_pimpl = std::move(x._pimpl);
@@ -81,6 +124,31 @@ void injector::instantiate_all_with_type_role(const std::string &type_role)
 	_pimpl->instantiate_all_with_type_role(type_role);
 }
 
+void injector::start_warmup_with_type_role(const std::string &type_role, std::chrono::milliseconds slice_budget, std::function<void()> on_finished)
+{
+	_pimpl->start_warmup_with_type_role(type_role, slice_budget, std::move(on_finished));
+}
+
+bool injector::is_warming_up() const
+{
+	return _pimpl->is_warming_up();
+}
+
+void injector::start_profile_recording(std::chrono::milliseconds duration)
+{
+	_pimpl->start_profile_recording(duration);
+}
+
+bool injector::save_profile(const std::string &file_name) const
+{
+	return _pimpl->save_profile(file_name);
+}
+
+bool injector::start_prewarm_from_profile(const std::string &file_name, std::chrono::milliseconds slice_budget, std::function<void()> on_finished)
+{
+	return _pimpl->start_prewarm_from_profile(file_name, slice_budget, std::move(on_finished));
+}
+
 QObject * injector::get(const type &interface_type)
 {
 	assert(!interface_type.is_empty());
@@ -91,6 +159,101 @@ QObject * injector::get(const type &interface_type)
 	return _pimpl->get(interface_type);
 }
 
+QObject * injector::try_get(const type &interface_type)
+{
+	assert(!interface_type.is_empty());
+
+	if (interface_type.is_qobject())
+		return nullptr;
+
+	return _pimpl->try_get(interface_type);
+}
+
+QObject * injector::try_get(const type &interface_type, try_status &status)
+{
+	assert(!interface_type.is_empty());
+
+	try
+	{
+		auto result = try_get(interface_type);
+		status = result ? try_status::ok : try_status::unknown_type;
+		return result;
+	}
+	catch (exception::exception &)
+	{
+		status = try_status::failed;
+		return nullptr;
+	}
+}
+
+bool injector::try_instantiate(const type &interface_type)
+{
+	assert(!interface_type.is_empty());
+
+	if (interface_type.is_qobject())
+		return false;
+
+	return _pimpl->try_instantiate(interface_type);
+}
+
+bool injector::try_instantiate(const type &interface_type, try_status &status)
+{
+	assert(!interface_type.is_empty());
+
+	try
+	{
+		status = try_instantiate(interface_type) ? try_status::ok : try_status::unknown_type;
+	}
+	catch (exception::exception &)
+	{
+		status = try_status::failed;
+	}
+	return status == try_status::ok;
+}
+
+void injector::get_async(const type &interface_type, std::function<void(QObject *)> on_ready)
+{
+	assert(!interface_type.is_empty());
+
+	if (interface_type.is_qobject())
+		throw exception::qobject_type{};
+
+	_pimpl->get_async(interface_type, std::move(on_ready));
+}
+
+lazy_handle injector::get_lazy(const type &interface_type)
+{
+	assert(!interface_type.is_empty());
+
+	if (interface_type.is_qobject())
+		throw exception::qobject_type{};
+
+	return _pimpl->get_lazy(interface_type);
+}
+
+object_set injector::get_set(const type &set_type)
+{
+	if (set_type.is_empty())
+		throw exception::empty_type{};
+	if (set_type.is_qobject())
+		throw exception::qobject_type{};
+
+	return _pimpl->get_set(set_type);
+}
+
+std::vector<QObject *> injector::get_all(const std::vector<type> &interface_types)
+{
+	for (auto &&interface_type : interface_types)
+	{
+		if (interface_type.is_empty())
+			throw exception::empty_type{};
+		if (interface_type.is_qobject())
+			throw exception::qobject_type{};
+	}
+
+	return _pimpl->get_all(interface_types);
+}
+
 std::vector<QObject *> injector::get_all_with_type_role(const std::string &type_role)
 {
 	return _pimpl->get_all_with_type_role(type_role);
@@ -103,4 +266,32 @@ void injector::inject_into(QObject *object)
 	_pimpl->inject_into(object);
 }
 
+assisted_injection injector::make_assisted_injection(const type &object_type)
+{
+	if (object_type.is_empty())
+		throw exception::empty_type{};
+	if (object_type.is_qobject())
+		throw exception::qobject_type{};
+
+	return _pimpl->make_assisted_injection(object_type);
+}
+
+void injector::enter_scope()
+{
+	_pimpl->enter_scope();
+}
+
+void injector::leave_scope()
+{
+	_pimpl->leave_scope();
+}
+
+void injector::release(QObject *object)
+{
+	if (!object)
+		throw exception::invalid_qobject{};
+
+	_pimpl->release(object);
+}
+
 }}
@@ -39,6 +39,11 @@ bool action_method::is_action_done_tag(const std::string& tag)
 	return tag == "INJEQT_DONE";
 }
 
+bool action_method::is_action_reset_tag(const std::string& tag)
+{
+	return tag == "INJEQT_RESET";
+}
+
 bool action_method::validate_action_method(const QMetaMethod &meta_method)
 {
 	auto meta_object = meta_method.enclosingMetaObject();
@@ -48,7 +53,7 @@ bool action_method::validate_action_method(const QMetaMethod &meta_method)
 		throw exception::invalid_action{std::string{"action is signal: "} + meta_object->className() + "::" + meta_method.methodSignature().data()};
 	if (meta_method.methodType() == QMetaMethod::Constructor)
 		throw exception::invalid_action{std::string{"action is constructor: "} + meta_object->className() + "::" + meta_method.methodSignature().data()};
-	if (!is_action_init_tag(meta_method.tag()) && !is_action_done_tag(meta_method.tag()))
+	if (!is_action_init_tag(meta_method.tag()) && !is_action_done_tag(meta_method.tag()) && !is_action_reset_tag(meta_method.tag()))
 		throw exception::invalid_action{std::string{"action does not have valid tag: "} + meta_object->className() + "::" + meta_method.methodSignature().data()};
 	if (meta_method.parameterCount() != 0)
 		throw exception::invalid_action{std::string{"invalid parameter count: "} + meta_object->className() + "::" + meta_method.methodSignature().data()};
@@ -68,6 +68,7 @@ class INJEQT_INTERNAL_API action_method final
 public:
 	static bool is_action_init_tag(const std::string &tag);
 	static bool is_action_done_tag(const std::string &tag);
+	static bool is_action_reset_tag(const std::string &tag);
 
 	static bool validate_action_method(const QMetaMethod &meta_method);
 
@@ -1,6 +1,6 @@
 /*
  * %injeqt copyright begin%
- * Copyright 2015 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
  * %injeqt copyright end%
  *
  * This library is free software; you can redistribute it and/or
@@ -18,30 +18,34 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
-#include "provider-by-parent-injector.h"
+#include "analysis-threads.h"
+
+#include <atomic>
+#include <thread>
 
 namespace injeqt { namespace internal {
 
-provider_by_parent_injector::provider_by_parent_injector(injector_impl *parent_injector, type provided_type) :
-	_parent_injector{parent_injector},
-	_provided_type{std::move(provided_type)}
-{
-	assert(_parent_injector);
-}
+namespace {
+
+std::atomic<unsigned> configured_thread_count{1};
 
-const type & provider_by_parent_injector::provided_type() const
-{
-	return _provided_type;
 }
 
-QObject * provider_by_parent_injector::provide(injector_core &)
+unsigned analysis_thread_count()
 {
-	return _parent_injector->get(_provided_type);
+	auto result = configured_thread_count.load();
+	if (result != 0)
+		return result;
+
+	auto hardware_thread_count = std::thread::hardware_concurrency();
+	return hardware_thread_count != 0
+		? hardware_thread_count
+		: 1;
 }
 
-bool provider_by_parent_injector::require_resolving() const
+void set_analysis_thread_count(unsigned thread_count)
 {
-	return false;
+	configured_thread_count.store(thread_count);
 }
 
 }}
@@ -0,0 +1,49 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+
+#include "internal.h"
+
+/**
+ * @file
+ * @brief Contains functions for configuring number of threads used to analyze types.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @return number of threads used to analyze types and create providers when injector is created
+ * @see injector::set_analysis_thread_count(unsigned)
+ *
+ * Value 0 set with set_analysis_thread_count(unsigned) is returned as std::thread::hardware_concurrency().
+ * Default value is 1, so analysis is done only on calling thread.
+ */
+INJEQT_INTERNAL_API unsigned analysis_thread_count();
+
+/**
+ * @brief Set number of threads used to analyze types and create providers.
+ * @param thread_count number of threads, 0 for number of hardware threads
+ */
+INJEQT_INTERNAL_API void set_analysis_thread_count(unsigned thread_count);
+
+}}
@@ -1,6 +1,6 @@
 /*
  * %injeqt copyright begin%
- * Copyright 2015 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
  * %injeqt copyright end%
  *
  * This library is free software; you can redistribute it and/or
@@ -18,34 +18,38 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
-#include "provider-by-parent-injector-configuration.h"
+#include "assisted-injection-state.h"
 
-#include "provider-by-parent-injector.h"
+#include "probes.h"
 
 #include <cassert>
 
 namespace injeqt { namespace internal {
 
-provider_by_parent_injector_configuration::provider_by_parent_injector_configuration(injector_impl *parent_injector, type object_type) :
-	_parent_injector{parent_injector},
-	_object_type{std::move(object_type)}
+assisted_injection_state::assisted_injection_state(type object_type, std::vector<setter_call> setter_calls, std::vector<action_method> init_actions) :
+	_object_type{std::move(object_type)},
+	_setter_calls{std::move(setter_calls)},
+	_init_actions{std::move(init_actions)}
 {
-	assert(_parent_injector);
 	assert(!_object_type.is_empty());
 }
 
-provider_by_parent_injector_configuration::~provider_by_parent_injector_configuration()
+const type & assisted_injection_state::object_type() const
 {
+	return _object_type;
 }
 
-std::vector<type> provider_by_parent_injector_configuration::types() const
+void assisted_injection_state::inject(QObject *object) const
 {
-	return {_object_type};
-}
-
-std::unique_ptr<provider> provider_by_parent_injector_configuration::create_provider(const types_by_name &) const
-{
-	return std::unique_ptr<provider>{new provider_by_parent_injector{_parent_injector, _object_type}};
+	assert(object);
+
+	for (auto &&setter_call : _setter_calls)
+		setter_call(object);
+	for (auto &&action : _init_actions)
+	{
+		INJEQT_PROBE2(init_action, object, _object_type.c_name());
+		action.invoke(object);
+	}
 }
 
 }}
@@ -0,0 +1,84 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include "action-method.h"
+#include "internal.h"
+
+#include <functional>
+#include <vector>
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing precomputed injection of assisted factories.
+ */
+
+class QObject;
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Shared state of assisted_injection.
+ *
+ * Holds one call for each dependency of object type and list of its INJEQT_INIT methods. Calls for
+ * dependencies that can be resolved in advance already contain resolved objects (or lazy handles and
+ * sets), so injecting into new object does not require any lookups in injector.
+ */
+class INJEQT_INTERNAL_API assisted_injection_state final
+{
+
+public:
+	/**
+	 * @brief Call that sets one dependency on given object.
+	 */
+	using setter_call = std::function<void(QObject *)>;
+
+	/**
+	 * @brief Create new assisted injection state.
+	 * @param object_type type of objects to inject into
+	 * @param setter_calls calls setting all dependencies of object_type
+	 * @param init_actions INJEQT_INIT methods of object_type
+	 * @pre !object_type.is_empty()
+	 */
+	explicit assisted_injection_state(type object_type, std::vector<setter_call> setter_calls, std::vector<action_method> init_actions);
+
+	assisted_injection_state(const assisted_injection_state &) = delete;
+	assisted_injection_state & operator = (const assisted_injection_state &) = delete;
+
+	const type & object_type() const;
+
+	/**
+	 * @brief Call all setter calls and then all init actions on @p object.
+	 * @pre object != nullptr
+	 */
+	void inject(QObject *object) const;
+
+private:
+	type _object_type;
+	std::vector<setter_call> _setter_calls;
+	std::vector<action_method> _init_actions;
+
+};
+
+}}
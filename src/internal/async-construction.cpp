@@ -0,0 +1,181 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "async-construction.h"
+
+#include <cassert>
+#include <mutex>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QEvent>
+#include <QtCore/QObject>
+#include <QtCore/QRunnable>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+
+namespace injeqt { namespace internal {
+
+struct async_construction::state
+{
+	std::mutex mutex;
+	QObject *receiver;
+	QThread *target_thread;
+	std::vector<std::unique_ptr<QObject>> objects;
+	std::vector<std::unique_ptr<QObject>>::size_type remaining;
+	bool finished;
+};
+
+namespace {
+
+QEvent::Type constructed_event_type()
+{
+	static auto result = static_cast<QEvent::Type>(QEvent::registerEventType());
+	return result;
+}
+
+void post_constructed_event(async_construction::state &s)
+{
+	// caller holds s.mutex, so receiver can not be destroyed now
+	if (s.receiver)
+		QCoreApplication::postEvent(s.receiver, new QEvent{constructed_event_type()});
+}
+
+class construction_job final : public QRunnable
+{
+
+public:
+	explicit construction_job(std::shared_ptr<async_construction::state> s, std::size_t index, default_constructor_method constructor) :
+		_state{std::move(s)},
+		_index{index},
+		_constructor{std::move(constructor)}
+	{
+		setAutoDelete(true);
+	}
+
+	virtual void run() override
+	{
+		auto object = std::unique_ptr<QObject>{};
+		try
+		{
+			object = _constructor.invoke();
+		}
+		catch (...)
+		{
+			// object will be created again on target thread, reporting proper error there
+		}
+
+		if (object)
+			object->moveToThread(_state->target_thread);
+
+		std::lock_guard<std::mutex> lock{_state->mutex};
+		_state->objects[_index] = std::move(object);
+		if (--_state->remaining == 0)
+			post_constructed_event(*_state);
+	}
+
+private:
+	std::shared_ptr<async_construction::state> _state;
+	std::size_t _index;
+	default_constructor_method _constructor;
+
+};
+
+class construction_receiver final : public QObject
+{
+
+public:
+	explicit construction_receiver(std::shared_ptr<async_construction::state> s, std::function<void(std::vector<std::unique_ptr<QObject>>)> on_constructed) :
+		_state{std::move(s)},
+		_on_constructed{std::move(on_constructed)}
+	{
+	}
+
+	virtual bool event(QEvent *e) override
+	{
+		if (e->type() != constructed_event_type())
+			return QObject::event(e);
+
+		auto objects = std::vector<std::unique_ptr<QObject>>{};
+		{
+			std::lock_guard<std::mutex> lock{_state->mutex};
+			if (_state->finished)
+				return true;
+			_state->finished = true;
+			objects = std::move(_state->objects);
+		}
+
+		// callback may destroy owning async_construction (e.g. by calling get_async or removing module), so
+		// no members are accessed after it is called; this receiver itself is deleted later from event loop
+		auto on_constructed = std::move(_on_constructed);
+		on_constructed(std::move(objects));
+		return true;
+	}
+
+private:
+	std::shared_ptr<async_construction::state> _state;
+	std::function<void(std::vector<std::unique_ptr<QObject>>)> _on_constructed;
+
+};
+
+}
+
+async_construction::async_construction(std::vector<default_constructor_method> constructors,
+	std::function<void(std::vector<std::unique_ptr<QObject>>)> on_constructed, std::function<void()> on_canceled) :
+		_state{std::make_shared<state>()},
+		_on_canceled{std::move(on_canceled)}
+{
+	_receiver.reset(new construction_receiver{_state, std::move(on_constructed)});
+
+	std::lock_guard<std::mutex> lock{_state->mutex};
+	_state->receiver = _receiver.get();
+	_state->target_thread = QThread::currentThread();
+	_state->objects.resize(constructors.size());
+	_state->remaining = constructors.size();
+	_state->finished = false;
+
+	if (constructors.empty())
+		post_constructed_event(*_state);
+	for (decltype(constructors.size()) i = 0; i < constructors.size(); i++)
+		QThreadPool::globalInstance()->start(new construction_job{_state, i, std::move(constructors[i])});
+}
+
+async_construction::~async_construction()
+{
+	auto finished = false;
+	{
+		std::lock_guard<std::mutex> lock{_state->mutex};
+		_state->receiver = nullptr;
+		finished = _state->finished;
+		_state->finished = true;
+	}
+
+	// receiver may be just running on_constructed that destroyed this object
+	_receiver.release()->deleteLater();
+
+	if (!finished && _on_canceled)
+		_on_canceled();
+}
+
+bool async_construction::is_finished() const
+{
+	std::lock_guard<std::mutex> lock{_state->mutex};
+	return _state->finished;
+}
+
+}}
@@ -0,0 +1,84 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+
+#include "default-constructor-method.h"
+#include "internal.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @file
+ * @brief Contains classes and functions for constructing objects on worker threads.
+ */
+
+class QObject;
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Constructs set of objects with default constructors on worker threads.
+ *
+ * Each constructor is invoked on QThreadPool::globalInstance(). Constructed objects are moved to the thread
+ * that created async_construction. When all objects are constructed, on_constructed callback is called
+ * on that thread from its event loop. Objects that failed to construct are passed as nullptr.
+ *
+ * If async_construction is destroyed before on_constructed is called, on_canceled is called instead and
+ * all objects constructed later are destroyed. It can be also destroyed from inside of on_constructed.
+ */
+class INJEQT_INTERNAL_API async_construction final
+{
+
+public:
+	/**
+	 * @brief Start construction of objects.
+	 * @param constructors list of constructors to invoke
+	 * @param on_constructed called with constructed objects in order of @p constructors
+	 * @param on_canceled called when this object is destroyed before on_constructed
+	 *
+	 * on_constructed is always called from event loop, even if @p constructors is empty.
+	 */
+	explicit async_construction(std::vector<default_constructor_method> constructors,
+		std::function<void(std::vector<std::unique_ptr<QObject>>)> on_constructed, std::function<void()> on_canceled);
+	~async_construction();
+
+	async_construction(const async_construction &) = delete;
+	async_construction & operator = (const async_construction &) = delete;
+
+	/**
+	 * @return true if on_constructed was already called
+	 */
+	bool is_finished() const;
+
+	struct state;
+
+private:
+	std::shared_ptr<state> _state;
+	std::unique_ptr<QObject> _receiver;
+	std::function<void()> _on_canceled;
+
+};
+
+}}
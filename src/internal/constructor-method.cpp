@@ -0,0 +1,161 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "constructor-method.h"
+
+#include <injeqt/exception/unavailable-required-types.h>
+
+#include "wiring-table.h"
+
+#include <cassert>
+#include <QtCore/QMetaObject>
+
+namespace injeqt { namespace internal {
+
+constructor_method::constructor_method() :
+	_constructor_index{-1}
+{
+}
+
+constructor_method::constructor_method(std::vector<type> parameter_types, QMetaMethod meta_method, int constructor_index) :
+	_object_type{meta_method.enclosingMetaObject()},
+	_parameter_types{std::move(parameter_types)},
+	_meta_method{std::move(meta_method)},
+	_constructor_index{constructor_index}
+{
+	assert(_meta_method.methodType() == QMetaMethod::Constructor);
+	assert(_meta_method.parameterCount() == static_cast<int>(_parameter_types.size()));
+	assert(_meta_method.enclosingMetaObject() != nullptr);
+	assert(_constructor_index >= 0);
+}
+
+bool constructor_method::is_empty() const
+{
+	return !_meta_method.isValid();
+}
+
+const type & constructor_method::object_type() const
+{
+	return _object_type;
+}
+
+const std::vector<type> & constructor_method::parameter_types() const
+{
+	return _parameter_types;
+}
+
+const QMetaMethod & constructor_method::meta_method() const
+{
+	return _meta_method;
+}
+
+std::unique_ptr<QObject> constructor_method::invoke(const std::vector<QObject *> &arguments) const
+{
+	assert(!is_empty());
+	assert(arguments.size() == _parameter_types.size());
+
+	// moc reads each argument as pointer to parameter type, QObject is always first base of these
+	auto values = arguments;
+	auto result = static_cast<QObject *>(nullptr);
+	auto argv = std::vector<void *>{&result};
+	argv.reserve(values.size() + 1);
+	for (auto &&value : values)
+		argv.push_back(&value);
+
+	_object_type.meta_object()->static_metacall(QMetaObject::CreateInstance, _constructor_index, argv.data());
+	return std::unique_ptr<QObject>{result};
+}
+
+bool operator == (const constructor_method &x, const constructor_method &y)
+{
+	if (x.object_type() != y.object_type())
+		return false;
+
+	assert(x.meta_method() == y.meta_method());
+
+	return true;
+}
+
+bool operator != (const constructor_method &x, const constructor_method &y)
+{
+	return !(x == y);
+}
+
+namespace {
+
+constructor_method make_constructor_method(const types_by_name &known_types, const type &t, const QMetaMethod &constructor, int constructor_index)
+{
+	if (!constructor.isValid())
+		return constructor_method{};
+
+	auto parameter_types = std::vector<type>{};
+	auto message = std::string{};
+	for (auto &&parameter_type_name : constructor.parameterTypes())
+	{
+		auto parameter_type = type_by_pointer(known_types, parameter_type_name.data());
+		if (parameter_type.is_empty())
+			message.append(t.c_name()).append(": ").append(parameter_type_name.data()).append("\n");
+		parameter_types.push_back(parameter_type);
+	}
+	if (!message.empty())
+		throw exception::unavailable_required_types{message};
+
+	return constructor_method{std::move(parameter_types), constructor, constructor_index};
+}
+
+}
+
+bool is_injection_constructor(const QMetaMethod &constructor)
+{
+	if (constructor.parameterCount() == 0)
+		return false;
+
+	for (auto &&parameter_type : constructor.parameterTypes())
+		if (!parameter_type.endsWith('*') || parameter_type == "QObject*")
+			return false;
+	return true;
+}
+
+constructor_method make_constructor_method(const types_by_name &known_types, const type &t)
+{
+	assert(!t.is_empty());
+	assert(!t.is_qobject());
+
+	// only constructors are checked, there is no need to build whole wiring table
+	auto meta_object = t.meta_object();
+	auto constructor_count = meta_object->constructorCount();
+	for (decltype(constructor_count) i = 0; i < constructor_count; i++)
+	{
+		auto constructor = meta_object->constructor(i);
+		if (constructor.methodType() == QMetaMethod::Constructor && is_injection_constructor(constructor))
+			return make_constructor_method(known_types, t, constructor, i);
+	}
+
+	return constructor_method{};
+}
+
+constructor_method make_constructor_method(const types_by_name &known_types, const wiring_table &table)
+{
+	assert(!table.for_type().is_qobject());
+
+	return make_constructor_method(known_types, table.for_type(), table.injection_constructor(), table.injection_constructor_index());
+}
+
+}}
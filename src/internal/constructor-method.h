@@ -0,0 +1,155 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include "internal.h"
+#include "types-by-name.h"
+
+#include <injeqt/exception/exception.h>
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include <memory>
+#include <vector>
+#include <QtCore/QMetaMethod>
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing constructors that accept dependencies.
+ */
+
+class QObject;
+
+namespace injeqt { namespace internal {
+
+class wiring_table;
+
+/**
+ * @brief Abstraction of constructor that accepts dependencies.
+ *
+ * This class is used for creating objects of types configured with module::add_type<T>() that do not
+ * have default constructor. Injection constructor must be marked with Q_INVOKABLE tag and must only
+ * accept pointers to types known to injector (QObject pointers are not allowed):
+ *
+ *     class with_injection_constructor : public QObject
+ *     {
+ *         Q_OBJECT
+ *     public:
+ *         Q_INVOKABLE with_injection_constructor(service *s, other_service *o) {}
+ *     };
+ *
+ * All parameters are passed in one call, so object is complete just after construction. Constructor
+ * is invoked by its index in QMetaObject, without matching its signature.
+ *
+ * To extract constructor from a type call make_constructor_method(const types_by_name &, const type &).
+ */
+class INJEQT_INTERNAL_API constructor_method final
+{
+
+public:
+	/**
+	 * @brief Create empty constructor_method.
+	 */
+	constructor_method();
+
+	/**
+	 * @brief Create object from QMetaMethod definition.
+	 * @param parameter_types types of parameters of @p meta_method
+	 * @param meta_method Qt meta method that should be an injection constructor
+	 * @param constructor_index index of @p meta_method in its QMetaObject
+	 * @pre meta_method.methodType() == QMetaMethod::Constructor
+	 * @pre meta_method.parameterCount() == parameter_types.size()
+	 * @pre meta_method.enclosingMetaObject() != nullptr
+	 * @pre constructor_index >= 0
+	 */
+	explicit constructor_method(std::vector<type> parameter_types, QMetaMethod meta_method, int constructor_index);
+
+	/**
+	 * @return true if constructor_method is empty and does not represent constructor
+	 */
+	bool is_empty() const;
+
+	/**
+	 * @return Type of objects created by constructor.
+	 */
+	const type & object_type() const;
+
+	/**
+	 * @return Types of parameters of constructor, in order of parameters.
+	 */
+	const std::vector<type> & parameter_types() const;
+
+	/**
+	 * @return Qt representation of constructor.
+	 *
+	 * May return empty value if object is empty.
+	 */
+	const QMetaMethod & meta_method() const;
+
+	/**
+	 * @return New instance of type of constructor.
+	 * @param arguments objects passed as parameters, in order of parameters
+	 * @pre !is_empty()
+	 * @pre arguments.size() == parameter_types().size()
+	 * @pre each argument implements its parameter type
+	 */
+	std::unique_ptr<QObject> invoke(const std::vector<QObject *> &arguments) const;
+
+private:
+	type _object_type;
+	std::vector<type> _parameter_types;
+	QMetaMethod _meta_method;
+	int _constructor_index;
+
+};
+
+INJEQT_INTERNAL_API bool operator == (const constructor_method &x, const constructor_method &y);
+INJEQT_INTERNAL_API bool operator != (const constructor_method &x, const constructor_method &y);
+
+/**
+ * @brief Extract injection constructor method from given type @p t.
+ * @param known_types list of all types known to injector
+ * @param t type to extract constructor from
+ * @throw unavailable_required_types if any parameter of injection constructor is not in @p known_types
+ * @pre !t.is_empty() && !t.is_qobject()
+ *
+ * This method returns constructor_method based on first Q_INVOKABLE constructor of type @p t that only
+ * accepts pointers to QObject-derived types. If no such constructor is found - empty constructor_method
+ * is returned.
+ */
+INJEQT_INTERNAL_API constructor_method make_constructor_method(const types_by_name &known_types, const type &t);
+
+/**
+ * @brief Extract injection constructor method using already built wiring table.
+ * @param known_types list of all types known to injector
+ * @param table wiring table of type to extract constructor from
+ * @see make_constructor_method(const types_by_name &, const type &)
+ */
+INJEQT_INTERNAL_API constructor_method make_constructor_method(const types_by_name &known_types, const wiring_table &table);
+
+/**
+ * @return true if @p constructor has parameters and all of these are pointers to QObject-derived types
+ *
+ * Constructors with QObject * parameter (like usual parent parameter) are not injection constructors.
+ */
+INJEQT_INTERNAL_API bool is_injection_constructor(const QMetaMethod &constructor);
+
+}}
@@ -23,7 +23,11 @@
 #include "internal.h"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <functional>
+#include <memory>
+#include <thread>
 #include <vector>
 
 /**
@@ -48,6 +52,62 @@ inline std::vector<T> transform(const std::vector<S> &source, std::function<T(S)
 	return result;
 }
 
+/**
+ * @brief Functional interface to std::transform that calls @p f on many threads.
+ * @tparam S type of source items
+ * @tparam T type of result items
+ * @param source source data
+ * @param f transforming function, must be safe to call from many threads at once
+ * @param thread_count maximum number of threads to use, including calling one
+ *
+ * Result is the same as result of transform(const std::vector<S> &, std::function<T(S)>) - items are
+ * in order of @p source. If @p f throws for one or more items, exception thrown for first of these
+ * items is rethrown after all threads are finished, as it would be in serial version.
+ */
+template<typename S, typename T>
+inline std::vector<T> parallel_transform(const std::vector<S> &source, std::function<T(const S &)> f, unsigned thread_count)
+{
+	auto result = std::vector<T>{};
+	result.reserve(source.size());
+
+	if (thread_count < 2 || source.size() < 2)
+	{
+		for (auto &&item : source)
+			result.push_back(f(item));
+		return result;
+	}
+
+	auto results = std::vector<std::unique_ptr<T>>(source.size());
+	auto errors = std::vector<std::exception_ptr>(source.size());
+	std::atomic<typename std::vector<S>::size_type> next{0};
+	auto work = [&]{
+		for (auto i = next++; i < source.size(); i = next++)
+			try
+			{
+				results[i].reset(new T(f(source[i])));
+			}
+			catch (...)
+			{
+				errors[i] = std::current_exception();
+			}
+	};
+
+	auto threads = std::vector<std::thread>{};
+	auto thread_limit = std::min<typename std::vector<S>::size_type>(thread_count, source.size());
+	for (decltype(thread_limit) i = 1; i < thread_limit; i++)
+		threads.emplace_back(work);
+	work();
+	for (auto &&thread : threads)
+		thread.join();
+
+	for (auto &&error : errors)
+		if (error)
+			std::rethrow_exception(error);
+	for (auto &&item : results)
+		result.push_back(std::move(*item));
+	return result;
+}
+
 /**
  * @brief Extract data from multiple vectors into one vector.
  * @tparam S type of source items
@@ -20,7 +20,10 @@
 
 #include "default-constructor-method.h"
 
+#include "wiring-table.h"
+
 #include <cassert>
+#include <QtCore/QMetaObject>
 
 namespace injeqt { namespace internal {
 
@@ -79,19 +82,27 @@ default_constructor_method make_default_constructor_method(const type &t)
 	assert(!t.is_empty());
 	assert(!t.is_qobject());
 
+	// only constructors are checked, there is no need to build whole wiring table
 	auto meta_object = t.meta_object();
 	auto constructor_count = meta_object->constructorCount();
 	for (decltype(constructor_count) i = 0; i < constructor_count; i++)
 	{
 		auto constructor = meta_object->constructor(i);
-		if (constructor.methodType() != QMetaMethod::Constructor)
-			continue;
-		if (constructor.parameterCount() != 0)
-			continue;
-		return default_constructor_method{constructor};
+		if (constructor.methodType() == QMetaMethod::Constructor && constructor.parameterCount() == 0)
+			return default_constructor_method{constructor};
 	}
 
 	return default_constructor_method{};
 }
 
+default_constructor_method make_default_constructor_method(const wiring_table &table)
+{
+	assert(!table.for_type().is_qobject());
+
+	auto &constructor = table.default_constructor();
+	return constructor.isValid()
+		? default_constructor_method{constructor}
+		: default_constructor_method{};
+}
+
 }}
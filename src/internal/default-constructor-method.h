@@ -38,6 +38,8 @@ class QObject;
 
 namespace injeqt { namespace internal {
 
+class wiring_table;
+
 /**
  * @brief Abstraction of default constructor.
  *
@@ -120,4 +122,11 @@ INJEQT_INTERNAL_API bool operator != (const default_constructor_method &x, const
  */
 INJEQT_INTERNAL_API default_constructor_method make_default_constructor_method(const type &t);
 
+/**
+ * @brief Extract default constructor method using already built wiring table.
+ * @param table wiring table of type to extract constructor from
+ * @see make_default_constructor_method(const type &)
+ */
+INJEQT_INTERNAL_API default_constructor_method make_default_constructor_method(const wiring_table &table);
+
 }}
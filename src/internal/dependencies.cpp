@@ -32,6 +32,7 @@
 #include "interfaces-utils.h"
 #include "setter-method.h"
 #include "type-relations.h"
+#include "wiring-table.h"
 
 #include <QtCore/QMetaMethod>
 #include <algorithm>
@@ -44,8 +45,7 @@ namespace {
 
 std::vector<setter_method> extract_setters(const types_by_name &known_types, const type &for_type)
 {
-	assert(!for_type.is_empty());
-
+	// only setters are checked, there is no need to build whole wiring table
 	auto result = std::vector<setter_method>{};
 
 	auto meta_object = for_type.meta_object();
@@ -54,20 +54,27 @@ std::vector<setter_method> extract_setters(const types_by_name &known_types, con
 	{
 		auto maybe_setter = meta_object->method(i);
 		if (setter_method::is_setter_tag(maybe_setter.tag()))
-			result.emplace_back(make_setter_method(known_types, maybe_setter));
+			result.emplace_back(make_setter_method(known_types, maybe_setter, setter_method::qualifier_of(meta_object, maybe_setter)));
 	}
 
 	return result;
 }
 
+std::vector<setter_method> extract_setters(const types_by_name &known_types, const wiring_table &table)
+{
+	auto &setters = table.setters();
+	auto &qualifiers = table.setter_qualifiers();
+	auto result = std::vector<setter_method>{};
+	result.reserve(setters.size());
+	for (decltype(setters.size()) i = 0; i < setters.size(); i++)
+		result.emplace_back(make_setter_method(known_types, setters[i], qualifiers[i]));
+
+	return result;
 }
 
-dependencies extract_dependencies(const types_by_name &known_types, const type &for_type)
+dependencies make_dependencies(const type &for_type, const std::vector<setter_method> &setters)
 {
-	assert(!for_type.is_empty());
-
 	auto interfaces = extract_interfaces(for_type);
-	auto setters = extract_setters(known_types, for_type);
 	for (auto &&setter : setters)
 	{
 		auto parameter_type = setter.parameter_type();
@@ -88,4 +95,18 @@ dependencies extract_dependencies(const types_by_name &known_types, const type &
 	return dependencies{result};
 }
 
+}
+
+dependencies extract_dependencies(const types_by_name &known_types, const type &for_type)
+{
+	assert(!for_type.is_empty());
+
+	return make_dependencies(for_type, extract_setters(known_types, for_type));
+}
+
+dependencies extract_dependencies(const types_by_name &known_types, const wiring_table &table)
+{
+	return make_dependencies(table.for_type(), extract_setters(known_types, table));
+}
+
 }}
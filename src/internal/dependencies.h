@@ -34,6 +34,8 @@
 
 namespace injeqt { namespace internal {
 
+class wiring_table;
+
 /**
  * @brief Extract type from dependency for storting purposes.
  * @brief Identity function.
@@ -81,4 +83,13 @@ using dependencies = sorted_unique_vector<dependency, dependency, dependency_fro
  */
 INJEQT_INTERNAL_API dependencies extract_dependencies(const types_by_name &known_types, const type &for_type);
 
+/**
+ * @brief Extract set of dependencies from already built wiring table.
+ * @param table wiring table of type to extract dependencies from.
+ * @see extract_dependencies(const types_by_name &, const type &)
+ *
+ * Used by injector_core, that keeps wiring tables of its types, to not scan meta object again.
+ */
+INJEQT_INTERNAL_API dependencies extract_dependencies(const types_by_name &known_types, const wiring_table &table);
+
 }}
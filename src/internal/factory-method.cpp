@@ -21,25 +21,30 @@
 #include "factory-method.h"
 
 #include "interfaces-utils.h"
+#include "type-name.h"
+#include "wiring-table.h"
 
 #include <cassert>
+#include <QtCore/QMetaObject>
 
 namespace injeqt { namespace internal {
 
-factory_method::factory_method()
+factory_method::factory_method() :
+	_method_index{-1}
 {
 }
 
 factory_method::factory_method(type result_type, QMetaMethod meta_method) :
 	_object_type{meta_method.enclosingMetaObject()},
 	_result_type{std::move(result_type)},
-	_meta_method{std::move(meta_method)}
+	_meta_method{std::move(meta_method)},
+	_method_index{_meta_method.methodIndex()}
 {
 	assert(meta_method.methodType() == QMetaMethod::Method || meta_method.methodType() == QMetaMethod::Slot);
 	assert(meta_method.parameterCount() == 0);
 	assert(meta_method.enclosingMetaObject() != nullptr);
 	assert(!_result_type.is_empty());
-	assert(_result_type.name() + "*" == std::string{meta_method.typeName()});
+	assert(is_pointer_name_of(meta_method.typeName(), _result_type));
 }
 
 bool factory_method::is_empty() const
@@ -68,8 +73,11 @@ std::unique_ptr<QObject> factory_method::invoke(QObject *on) const
 	assert(on != nullptr);
 	assert(meta_method().enclosingMetaObject() == on->metaObject());
 
+	// same call as QMetaMethod::invoke with Qt::DirectConnection does, but without comparing return type name
+	// that was already checked in constructor
 	QObject *result = nullptr;
-	_meta_method.invoke(on, QReturnArgument<QObject *>((_result_type.name() + "*").c_str(), result)); // TODO: check for false result
+	void *arguments[] = {&result};
+	QMetaObject::metacall(on, QMetaObject::InvokeMetaMethod, _method_index, arguments);
 	return std::unique_ptr<QObject>{result};
 }
 
@@ -89,6 +97,28 @@ bool operator != (const factory_method &x, const factory_method &y)
 	return !(x == y);
 }
 
+namespace {
+
+void add_factory_method(std::vector<factory_method> &factory_methods, const types_by_name &known_types, const type &t, const QMetaMethod &method)
+{
+	auto return_type = type_by_pointer(known_types, method.typeName());
+	if (return_type.is_empty())
+		return;
+	auto interfaces = extract_interfaces(return_type);
+	if (interfaces.contains(t))
+		factory_methods.emplace_back(return_type, method);
+}
+
+factory_method unique_factory_method(const std::vector<factory_method> &factory_methods)
+{
+	if (factory_methods.size() == 1)
+		return factory_methods.front();
+	else
+		return factory_method{};
+}
+
+}
+
 factory_method make_factory_method(const types_by_name &known_types, const type &t, const type &f)
 {
 	assert(!t.is_empty());
@@ -96,27 +126,31 @@ factory_method make_factory_method(const types_by_name &known_types, const type
 	assert(!f.is_empty());
 	assert(!f.is_qobject());
 
+	// only methods without parameters are checked, there is no need to build whole wiring table
 	auto meta_object = f.meta_object();
 	auto method_count = meta_object->methodCount();
 	auto factory_methods = std::vector<factory_method>{};
-
 	for (decltype(method_count) i = 0; i < method_count; i++)
 	{
 		auto method = meta_object->method(i);
-		if (method.parameterCount() != 0)
-			continue;
-		auto return_type = type_by_pointer(known_types, method.typeName());
-		if (return_type.is_empty())
-			continue;
-		auto interfaces = extract_interfaces(return_type);
-		if (interfaces.contains(t))
-			factory_methods.emplace_back(return_type, method);
+		if (method.parameterCount() == 0)
+			add_factory_method(factory_methods, known_types, t, method);
 	}
 
-	if (factory_methods.size() == 1)
-		return factory_methods.front();
-	else
-		return factory_method{};
+	return unique_factory_method(factory_methods);
+}
+
+factory_method make_factory_method(const types_by_name &known_types, const type &t, const wiring_table &factory_table)
+{
+	assert(!t.is_empty());
+	assert(!t.is_qobject());
+	assert(!factory_table.for_type().is_qobject());
+
+	auto factory_methods = std::vector<factory_method>{};
+	for (auto &&method : factory_table.factory_candidates())
+		add_factory_method(factory_methods, known_types, t, method);
+
+	return unique_factory_method(factory_methods);
 }
 
 }}
@@ -39,6 +39,8 @@ class QObject;
 
 namespace injeqt { namespace internal {
 
+class wiring_table;
+
 /**
  * @brief Abstraction of factory method.
  *
@@ -90,7 +92,7 @@ public:
 	 * @pre meta_method.parameterCount() == 0
 	 * @pre meta_method.enclosingMetaObject() != nullptr
 	 * @pre !result_type.is_empty()
-	 * @pre result_type.name() + "*" == std::string{result_type.typeName()}
+	 * @pre is_pointer_name_of(meta_method.typeName(), result_type)
 	 */
 	explicit factory_method(type result_type, QMetaMethod meta_method);
 
@@ -126,6 +128,9 @@ public:
 	 * This method can be only called on valid objects with @p on parameter being
 	 * the same type as object_type() returns. Invalid invocation with result
 	 * in undefined behavior.
+	 *
+	 * Method is called directly in current thread by its index cached at construction, without
+	 * matching return type name on each call. Returns nullptr if factory method returned nullptr.
 	 */
 	std::unique_ptr<QObject> invoke(QObject *on) const;
 
@@ -133,6 +138,7 @@ private:
 	type _object_type;
 	type _result_type;
 	QMetaMethod _meta_method;
+	int _method_index;
 
 };
 
@@ -153,4 +159,11 @@ INJEQT_INTERNAL_API bool operator != (const factory_method &x, const factory_met
  */
 INJEQT_INTERNAL_API factory_method make_factory_method(const types_by_name &known_types, const type &t, const type &f);
 
+/**
+ * @brief Extract factory method using already built wiring table of factory type.
+ * @param factory_table wiring table of factory type
+ * @see make_factory_method(const types_by_name &, const type &, const type &)
+ */
+INJEQT_INTERNAL_API factory_method make_factory_method(const types_by_name &known_types, const type &t, const wiring_table &factory_table);
+
 }}
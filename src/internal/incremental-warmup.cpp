@@ -0,0 +1,138 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "incremental-warmup.h"
+
+#include <injeqt/exception/exception.h>
+
+#include <cassert>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QTimerEvent>
+
+namespace injeqt { namespace internal {
+
+namespace {
+
+class warmup_timer final : public QObject
+{
+
+public:
+	explicit warmup_timer(incremental_warmup &warmup) :
+		_warmup(warmup),
+		_timer_id{startTimer(0)}
+	{
+	}
+
+	virtual ~warmup_timer()
+	{
+		if (_timer_id)
+			killTimer(_timer_id);
+	}
+
+protected:
+	virtual void timerEvent(QTimerEvent *) override
+	{
+		if (!_timer_id)
+			return;
+
+		// warmup can be destroyed with this timer by its on_finished function
+		auto guard = QPointer<QObject>{this};
+		auto finished = _warmup.is_finished() || _warmup.run_slice();
+		if (guard && finished)
+		{
+			killTimer(_timer_id);
+			_timer_id = 0;
+		}
+	}
+
+private:
+	incremental_warmup &_warmup;
+	int _timer_id;
+
+};
+
+}
+
+incremental_warmup::incremental_warmup(std::vector<type> plan, std::function<void(const type &)> instantiate,
+	std::chrono::milliseconds slice_budget, std::function<void()> on_finished) :
+		_plan{std::move(plan)},
+		_next{0},
+		_instantiate{std::move(instantiate)},
+		_slice_budget{slice_budget},
+		_on_finished{std::move(on_finished)}
+{
+	assert(_instantiate);
+}
+
+incremental_warmup::~incremental_warmup()
+{
+}
+
+void incremental_warmup::start()
+{
+	if (!_timer && !is_finished())
+		_timer.reset(new warmup_timer{*this});
+}
+
+bool incremental_warmup::run_slice()
+{
+	if (is_finished())
+		return true;
+
+	auto slice_end = std::chrono::steady_clock::now() + _slice_budget;
+	do
+	{
+		auto &t = _plan[_next++];
+		try
+		{
+			_instantiate(t);
+		}
+		catch (exception::exception &)
+		{
+			_failed_types.push_back(t);
+		}
+	}
+	while (!is_finished() && std::chrono::steady_clock::now() < slice_end);
+
+	if (!is_finished())
+		return false;
+
+	if (_on_finished)
+		_on_finished();
+	return true;
+}
+
+bool incremental_warmup::is_finished() const
+{
+	return _next == _plan.size();
+}
+
+std::size_t incremental_warmup::remaining() const
+{
+	return _plan.size() - _next;
+}
+
+const std::vector<type> & incremental_warmup::failed_types() const
+{
+	return _failed_types;
+}
+
+}}
@@ -0,0 +1,109 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include "internal.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @file
+ * @brief Contains classes and functions for instantiating objects in time-budgeted slices.
+ */
+
+class QObject;
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Instantiates list of types in slices driven by event loop.
+ *
+ * Plan is a list of types in order of instantiation, with dependencies before types that require them,
+ * so that each step usually creates only one object. Each call to run_slice() instantiates types from plan
+ * until it is done or until slice budget is exceeded. Budget is checked after each step, so one slice can
+ * take longer than budget by the time of one step.
+ *
+ * After start() is called slices are run from event loop of current thread using zero-interval timer, so
+ * other events are processed between slices. Types that fail to instantiate are skipped and reported by
+ * failed_types().
+ */
+class INJEQT_INTERNAL_API incremental_warmup final
+{
+
+public:
+	/**
+	 * @brief Create warmup for given @p plan.
+	 * @param plan list of types to instantiate in order
+	 * @param instantiate function that instantiates one type, it must do nothing if type is already instantiated
+	 * @param slice_budget maximum time of one slice
+	 * @param on_finished function called after last slice, may be empty
+	 */
+	explicit incremental_warmup(std::vector<type> plan, std::function<void(const type &)> instantiate,
+		std::chrono::milliseconds slice_budget, std::function<void()> on_finished);
+	~incremental_warmup();
+
+	incremental_warmup(const incremental_warmup &) = delete;
+	incremental_warmup & operator = (const incremental_warmup &) = delete;
+
+	/**
+	 * @brief Start running slices from event loop of current thread.
+	 */
+	void start();
+
+	/**
+	 * @brief Instantiate types from plan until budget is exceeded.
+	 * @return true if all types from plan were processed
+	 */
+	bool run_slice();
+
+	/**
+	 * @return true if all types from plan were processed
+	 */
+	bool is_finished() const;
+
+	/**
+	 * @return number of types from plan that were not processed yet
+	 */
+	std::size_t remaining() const;
+
+	/**
+	 * @return list of types which instantiation failed
+	 */
+	const std::vector<type> & failed_types() const;
+
+private:
+	std::vector<type> _plan;
+	std::vector<type>::size_type _next;
+	std::function<void(const type &)> _instantiate;
+	std::chrono::milliseconds _slice_budget;
+	std::function<void()> _on_finished;
+	std::vector<type> _failed_types;
+	std::unique_ptr<QObject> _timer;
+
+};
+
+}}
@@ -21,87 +21,1144 @@
 #include "injector-core.h"
 
 #include <injeqt/exception/ambiguous-types.h>
+#include <injeqt/exception/dependency-on-scoped-type.h>
+#include <injeqt/exception/invalid-dependency.h>
+#include <injeqt/exception/invalid-qobject.h>
+#include <injeqt/exception/no-active-scope.h>
 #include <injeqt/exception/unavailable-required-types.h>
 #include <injeqt/exception/unknown-type.h>
+#include <injeqt/exception/unresolvable-dependencies.h>
 #include <injeqt/module.h>
 
 #include "action-method.h"
+#include "analysis-threads.h"
+#include "assisted-injection-state.h"
+#include "async-construction.h"
 #include "containers.h"
+#include "incremental-warmup.h"
 #include "interfaces-utils.h"
+#include "lazy-state.h"
+#include "named-bindings.h"
+#include "probes.h"
 #include "provided-object.h"
 #include "provider-by-default-constructor.h"
+#include "provider-prototype.h"
 #include "provider-ready.h"
 #include "provider.h"
 #include "module-impl.h"
 #include "required-to-satisfy.h"
 #include "resolve-dependencies.h"
 #include "resolved-dependency.h"
+#include "thread-invoke.h"
 #include "type-role.h"
+#include "validation-manifest.h"
+#include "wiring-table.h"
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
+#include <set>
 
 namespace injeqt { namespace internal {
 
-injector_core::injector_core()
+namespace {
+
+std::string duplicated_types_message(const std::vector<std::unique_ptr<provider>> &all_providers)
+{
+	auto provided_types = std::vector<type>{};
+	std::transform(std::begin(all_providers), std::end(all_providers), std::back_inserter(provided_types), type_from_provider);
+	std::sort(std::begin(provided_types), std::end(provided_types));
+
+	auto message = std::string{};
+	for (auto it = std::adjacent_find(std::begin(provided_types), std::end(provided_types)); it != std::end(provided_types);
+		it = std::adjacent_find(it, std::end(provided_types)))
+	{
+		message.append(it->c_name());
+		message.append("\n");
+		it = std::upper_bound(it, std::end(provided_types), *it);
+	}
+	return message;
+}
+
+}
+
+injector_core::injector_core() :
+	_lazy_mutex{std::make_shared<std::recursive_mutex>()}
+{
+}
+
+injector_core::injector_core(types_by_name known_types, std::vector<std::unique_ptr<provider>> &&all_providers) :
+	injector_core{std::vector<injector_core *>{}, std::move(known_types), std::move(all_providers)}
+{
+}
+
+injector_core::injector_core(std::vector<injector_core *> super_cores, types_by_name known_types, std::vector<std::unique_ptr<provider>> &&all_providers) :
+	injector_core{std::move(super_cores), std::move(known_types), std::move(all_providers), std::string{}}
+{
+}
+
+injector_core::injector_core(std::vector<injector_core *> super_cores, types_by_name known_types, std::vector<std::unique_ptr<provider>> &&all_providers,
+		const std::string &validation_manifest) :
+	injector_core{std::move(super_cores), std::move(known_types), std::move(all_providers), validation_manifest, wiring_tables{}}
+{
+}
+
+injector_core::injector_core(std::vector<injector_core *> super_cores, types_by_name known_types, std::vector<std::unique_ptr<provider>> &&all_providers,
+		const std::string &validation_manifest, wiring_tables tables) :
+	_super_cores{std::move(super_cores)},
+	_known_types{std::move(known_types)},
+	_lazy_mutex{std::make_shared<std::recursive_mutex>()},
+	_wiring_tables{std::move(tables)}
+{
+	auto duplicated_types = duplicated_types_message(all_providers);
+	if (!duplicated_types.empty())
+		throw exception::ambiguous_types{duplicated_types};
+	_available_providers = providers{std::move(all_providers)};
+
+	// dependencies are extracted once, both for checking manifest and for types model
+	auto all_dependencies = types_dependencies{extract_all_dependencies(_known_types, dependent_types())};
+	auto validate = validation_manifest.empty() || validation_manifest != this->validation_manifest(all_dependencies.content());
+	if (validate)
+		validate_super_cores();
+
+	_types_model = create_types_model(all_dependencies.content(), validate);
+	_scoped_types = find_types_with(&provider::is_scoped);
+	_prototype_types = find_types_with(&provider::is_prototype);
+
+	find_super_owners();
+	if (validate)
+	{
+		validate_required_types();
+		validate_scoped_dependencies();
+		validate_prototype_dependencies();
+	}
+
+	track_ready_objects();
+}
+
+injector_core::~injector_core()
+{
+	_warmup.reset();
+	_async_constructions.clear();
+
+	while (!_scopes.empty())
+		leave_scope();
+
+	for (auto &&prototype_object : _prototype_objects)
+		call_done_methods(prototype_object.first);
+	for (auto &&p : _available_providers)
+		if (p->is_prototype())
+			for (auto &&pooled_object : static_cast<provider_prototype *>(p.get())->pool())
+				call_done_methods(pooled_object.get());
+
+	for (auto id = 0; id < _named_bindings.size(); id++)
+	{
+		auto &binding = _named_bindings.at(id);
+		if (binding.object && binding.binding_provider->require_resolving())
+			call_done_methods(binding.object);
+	}
+
+	for (auto &&resolved_object : _resolved_objects)
+		call_done_methods(resolved_object.object());
+}
+
+void injector_core::add_providers(types_by_name known_types, std::vector<std::unique_ptr<provider>> &&new_providers)
+{
+	add_providers(std::move(known_types), std::move(new_providers), current_named_bindings());
+}
+
+void injector_core::add_providers(types_by_name known_types, std::vector<std::unique_ptr<provider>> &&new_providers, std::vector<named_binding> named)
+{
+	auto new_types = std::vector<type>{};
+	auto need_dependencies = std::vector<type>{};
+	for (auto &&p : new_providers)
+	{
+		new_types.push_back(p->provided_type());
+		if (p->require_resolving())
+		{
+			auto interfaces = extract_interfaces(p->provided_type());
+			std::copy(std::begin(interfaces), std::end(interfaces), std::back_inserter(need_dependencies));
+		}
+	}
+
+	auto message = duplicated_types_message(new_providers);
+	if (!message.empty())
+		throw exception::ambiguous_types{message};
+
+	auto added_providers = providers{std::move(new_providers)};
+	for (auto &&t : new_types)
+		if (_types_model.knows(t))
+		{
+			message.append(t.c_name());
+			message.append("\n");
+		}
+	if (!message.empty())
+		throw exception::ambiguous_types{message};
+
+	auto all_types = new_types;
+	std::transform(std::begin(_available_providers), std::end(_available_providers), std::back_inserter(all_types), type_from_provider);
+	auto added_tables = add_missing_wiring_tables(need_dependencies);
+	auto new_types_model = types_model{};
+	try
+	{
+		new_types_model = extend_types_model(_types_model, all_types, extract_all_dependencies(known_types, need_dependencies));
+	}
+	catch (...)
+	{
+		_wiring_tables.remove(added_tables);
+		throw;
+	}
+
+	// validation below uses state of whole core, so new state is applied and reverted on failure
+	auto old_known_types = _known_types;
+	auto old_types_model = _types_model;
+	auto old_scoped_types = _scoped_types;
+	auto old_prototype_types = _prototype_types;
+
+	_known_types = std::move(known_types);
+	_types_model = std::move(new_types_model);
+	_available_providers.merge(std::move(added_providers));
+	_scoped_types = find_types_with(&provider::is_scoped);
+	_prototype_types = find_types_with(&provider::is_prototype);
+
+	auto prepared_named_bindings = named_bindings{};
+	auto named_ids = named_id_map{};
+	try
+	{
+		validate_required_types();
+		validate_scoped_dependencies();
+		validate_prototype_dependencies();
+		prepared_named_bindings = prepare_named_bindings(std::move(named));
+		named_ids = map_named_dependencies(prepared_named_bindings, _types_model);
+	}
+	catch (...)
+	{
+		for (auto &&t : new_types)
+			_available_providers.remove(t);
+		_known_types = std::move(old_known_types);
+		_types_model = std::move(old_types_model);
+		_scoped_types = std::move(old_scoped_types);
+		_prototype_types = std::move(old_prototype_types);
+		_wiring_tables.remove(added_tables);
+		throw;
+	}
+
+	apply_named_bindings(std::move(prepared_named_bindings), std::move(named_ids));
+
+	// interfaces that became ambiguous are not available anymore
+	auto objects = std::vector<implementation>{};
+	for (auto &&object : _objects)
+		if (_types_model.available_types().contains_key(object.interface_type()))
+			objects.push_back(object);
+	_objects = implementations{objects};
+
+	_super_owners.clear();
+	find_super_owners();
+	track_ready_objects();
+}
+
+void injector_core::validate_required_types() const
+{
+	auto required_types = std::vector<type>{};
+	for (auto &&p : _available_providers)
+		for (auto &&r : p->required_types())
+			required_types.push_back(r);
+
+	auto message = std::string{};
+	for (auto &&t : types{required_types})
+		if (!_types_model.contains(t))
+		{
+			message.append(t.c_name());
+			message.append("\n");
+		}
+	if (!message.empty())
+		throw exception::unavailable_required_types{message};
+
+	// depth-first search for cycles, for example of injection constructors accepting each other
+	auto visited = std::map<type, bool>{}; // true when all required types were visited
+	std::function<void(const type &)> visit = [&](const type &implementation_type){
+		auto visited_it = visited.find(implementation_type);
+		if (visited_it != std::end(visited))
+		{
+			if (!visited_it->second && message.empty())
+				message = std::string{"required types cycle: "} + implementation_type.c_name();
+			return;
+		}
+
+		visited.insert({implementation_type, false});
+		for (auto &&r : (*_available_providers.get(implementation_type))->required_types())
+		{
+			// types of super cores can not require own types
+			auto implementation_it = _types_model.available_types().get(r);
+			if (implementation_it != std::end(_types_model.available_types()))
+				visit(implementation_it->implementation_type());
+		}
+		visited[implementation_type] = true;
+	};
+
+	for (auto &&p : _available_providers)
+		if (!p->required_types().empty())
+			visit(p->provided_type());
+
+	if (!message.empty())
+		throw exception::invalid_dependency{message};
+}
+
+std::vector<type> injector_core::dependent_types() const
+{
+	auto result = std::vector<type>{};
+	for (auto &&p : _available_providers)
+		if (p->require_resolving())
+		{
+			auto interfaces = extract_interfaces(p->provided_type());
+			std::copy(std::begin(interfaces), std::end(interfaces), std::back_inserter(result));
+		}
+	return result;
+}
+
+types_model injector_core::create_types_model(const std::vector<type_dependencies> &all_dependencies, bool validate) const
+{
+	auto all_types = std::vector<type>{};
+	std::transform(std::begin(_available_providers), std::end(_available_providers), std::back_inserter(all_types), type_from_provider);
+	auto super_models = std::vector<const types_model *>{};
+	for (auto &&super_core : _super_cores)
+		super_models.push_back(&super_core->_types_model);
+
+	return make_types_model(all_types, all_dependencies, super_models, validate);
+}
+
+std::string injector_core::validation_manifest() const
+{
+	return validation_manifest(_types_model.mapped_dependencies().content());
+}
+
+std::string injector_core::validation_manifest(const std::vector<type_dependencies> &all_dependencies) const
+{
+	auto super_types = std::vector<type>{};
+	for (auto &&super_core : _super_cores)
+	{
+		auto provided = super_core->provided_types();
+		std::copy(std::begin(provided), std::end(provided), std::back_inserter(super_types));
+	}
+
+	return make_validation_manifest(_available_providers, all_dependencies, super_types);
+}
+
+std::vector<type> injector_core::teardown_order(const types &removed_types) const
+{
+	auto result = std::vector<type>{};
+
+	// depth-first search, so each type is placed after all its dependencies
+	auto visited = std::set<type>{};
+	std::function<void(const type &)> visit = [&](const type &implementation_type){
+		if (!removed_types.contains_key(implementation_type) || !visited.insert(implementation_type).second)
+			return;
+
+		auto provider_it = _available_providers.get(implementation_type);
+		assert(provider_it != std::end(_available_providers));
+		for (auto &&r : (*provider_it)->required_types())
+			visit(_types_model.implementation_type(r));
+		for (auto &&d : implementation_type_dependencies(implementation_type))
+			visit(_types_model.implementation_type(d.required_type()));
+		result.push_back(implementation_type);
+	};
+
+	for (auto &&t : removed_types)
+		visit(t);
+
+	return result;
+}
+
+void injector_core::validate_super_cores() const
+{
+	if (_super_cores.size() < 2)
+		return;
+
+	auto all_provided_types = std::vector<type>{};
+	for (auto &&super_core : _super_cores)
+	{
+		auto provided = super_core->provided_types();
+		std::copy(std::begin(provided), std::end(provided), std::back_inserter(all_provided_types));
+	}
+
+	auto message = std::string{};
+	std::sort(std::begin(all_provided_types), std::end(all_provided_types));
+	for (auto it = std::adjacent_find(std::begin(all_provided_types), std::end(all_provided_types)); it != std::end(all_provided_types);
+		it = std::adjacent_find(it + 1, std::end(all_provided_types)))
+	{
+		message.append(it->c_name());
+		message.append("\n");
+	}
+	if (!message.empty())
+		throw exception::ambiguous_types{message};
+}
+
+void injector_core::remove_providers(types_by_name known_types, const std::vector<type> &removed_types)
+{
+	remove_providers(std::move(known_types), removed_types, current_named_bindings());
+}
+
+void injector_core::remove_providers(types_by_name known_types, const std::vector<type> &removed_types, std::vector<named_binding> named)
+{
+	auto removed = types{removed_types};
+	auto is_removed = [&](const type &interface_type){
+		return removed.contains_key(_types_model.implementation_type(interface_type));
+	};
+
+	auto message = std::string{};
+	auto all_types = std::vector<type>{};
+	auto need_dependencies = std::vector<type>{};
+	for (auto &&p : _available_providers)
+	{
+		if (removed.contains_key(p->provided_type()))
+			continue;
+
+		for (auto &&r : p->required_types())
+			if (is_removed(r))
+				message.append(p->provided_type().c_name()).append(": ").append(r.c_name()).append("\n");
+		// sets are injected again below and qualified setters are checked against new named bindings
+		for (auto &&d : implementation_type_dependencies(p->provided_type()))
+			if (!d.setter().is_set() && d.setter().qualifier().empty() && is_removed(d.required_type()))
+				message.append(p->provided_type().c_name()).append(": ").append(d.setter().signature()).append("\n");
+
+		all_types.push_back(p->provided_type());
+		if (p->require_resolving())
+		{
+			auto interfaces = extract_interfaces(p->provided_type());
+			std::copy(std::begin(interfaces), std::end(interfaces), std::back_inserter(need_dependencies));
+		}
+	}
+	assert(all_types.size() + removed.size() == _available_providers.size());
+	if (!message.empty())
+		throw exception::unresolvable_dependencies{message};
+
+	auto new_types_model = reduce_types_model(_types_model, all_types, need_dependencies);
+	auto prepared_named_bindings = prepare_named_bindings(std::move(named));
+	auto named_ids = map_named_dependencies(prepared_named_bindings, new_types_model);
+	auto order = teardown_order(removed);
+
+	// results of pending requests could be adopted by removed providers
+	_async_constructions.clear();
+
+	// named objects can depend on removed ones, but not the other way
+	apply_named_bindings(std::move(prepared_named_bindings), std::move(named_ids));
+
+	// dependents first, so each object can still use its dependencies in INJEQT_DONE
+	auto removed_objects = std::set<QObject *>{};
+	for (auto i = order.rbegin(), e = order.rend(); i != e; ++i)
+	{
+		for (auto &&s : _scopes)
+		{
+			auto scoped_object = s.get(*i);
+			if (!scoped_object)
+				continue;
+			auto &resolved = s.resolved_objects();
+			if (std::find(std::begin(resolved), std::end(resolved), scoped_object) != std::end(resolved))
+				call_done_methods(scoped_object);
+			s.remove(scoped_object);
+		}
+
+		for (auto prototype_it = std::begin(_prototype_objects); prototype_it != std::end(_prototype_objects);)
+			if (type{prototype_it->first->metaObject()} == *i)
+			{
+				call_done_methods(prototype_it->first);
+				removed_objects.insert(prototype_it->first);
+				prototype_it = _prototype_objects.erase(prototype_it);
+			}
+			else
+				++prototype_it;
+
+		auto &p = *_available_providers.get(*i);
+		if (p->is_ready())
+			_reverse_dependencies.untrack(static_cast<provider_ready *>(p.get())->ready_implementation().object());
+		if (p->is_prototype())
+			for (auto &&pooled_object : static_cast<provider_prototype *>(p.get())->pool())
+			{
+				call_done_methods(pooled_object.get());
+				removed_objects.insert(pooled_object.get());
+			}
+
+		auto resolved_it = _resolved_objects.get(*i);
+		if (resolved_it != std::end(_resolved_objects))
+			call_done_methods(resolved_it->object());
+
+		auto object_it = _objects.get(*i);
+		if (object_it != std::end(_objects))
+			removed_objects.insert(object_it->object());
+	}
+
+	auto resolved_objects = std::vector<implementation>{};
+	std::copy_if(std::begin(_resolved_objects), std::end(_resolved_objects), std::back_inserter(resolved_objects),
+		[&removed_objects](const implementation &i){ return removed_objects.find(i.object()) == std::end(removed_objects); });
+	_resolved_objects = implementations{resolved_objects};
+
+	// objects are owned by providers
+	for (auto i = order.rbegin(), e = order.rend(); i != e; ++i)
+		_available_providers.remove(*i);
+	// meta objects of removed types can be unloaded together with their module
+	_wiring_tables.remove(removed_types);
+
+	_known_types = std::move(known_types);
+	_types_model = std::move(new_types_model);
+	_scoped_types = find_types_with(&provider::is_scoped);
+	_prototype_types = find_types_with(&provider::is_prototype);
+
+	// interfaces that are no longer ambiguous become available for objects left
+	auto objects = std::vector<implementation>{};
+	for (auto &&p : _available_providers)
+	{
+		auto object_it = _objects.get(p->provided_type());
+		if (object_it != std::end(_objects))
+			objects.push_back(*object_it);
+	}
+	_objects = implementations{objects_to_store(objects)};
+
+	// objects that received sets with removed objects would keep dangling pointers, so new sets are injected into them
+	auto changed_sets = std::vector<type>{};
+	for (auto &&s : _sets)
+		if (std::any_of(std::begin(s.second), std::end(s.second), [&removed_objects](QObject *o){ return removed_objects.count(o) > 0; }))
+			changed_sets.push_back(s.first);
+	_set_members.erase(std::remove_if(std::begin(_set_members), std::end(_set_members),
+		[&removed](const implemented_by &m){ return removed.contains_key(m.implementation_type()); }), std::end(_set_members));
+	_sets.clear();
+
+	_super_owners.clear();
+	find_super_owners();
+
+	if (!changed_sets.empty())
+		inject_sets_again(types{changed_sets});
+}
+
+void injector_core::inject_sets_again(const types &set_types)
+{
+	auto inject_sets = [&](QObject *object, const dependencies &object_dependencies){
+		for (auto &&d : object_dependencies)
+			if (d.setter().is_set() && set_types.contains_key(d.required_type()))
+				d.setter().invoke(object, get_set(d.required_type()));
+	};
+
+	// objects are collected first, as getting sets can create new objects
+	auto injected_objects = std::vector<implementation>{std::begin(_resolved_objects), std::end(_resolved_objects)};
+	for (auto &&s : _scopes)
+		for (auto &&scoped_object : s.resolved_objects())
+			injected_objects.emplace_back(type{scoped_object->metaObject()}, scoped_object);
+	for (auto &&prototype_object : _prototype_objects)
+		injected_objects.emplace_back(type{prototype_object.first->metaObject()}, prototype_object.first);
+	for (auto &&p : _available_providers)
+		if (p->is_prototype())
+			for (auto &&pooled_object : static_cast<provider_prototype *>(p.get())->pool())
+				injected_objects.emplace_back(p->provided_type(), pooled_object.get());
+
+	for (auto &&i : injected_objects)
+		inject_sets(i.object(), implementation_type_dependencies(i.interface_type()));
+	for (auto id = 0; id < _named_bindings.size(); id++)
+	{
+		auto &binding = _named_bindings.at(id);
+		if (binding.object && binding.binding_provider->require_resolving())
+			inject_sets(binding.object, binding.binding_dependencies);
+	}
+}
+
+void injector_core::configure_named_bindings(std::vector<named_binding> named)
+{
+	auto prepared_named_bindings = prepare_named_bindings(std::move(named));
+	auto named_ids = map_named_dependencies(prepared_named_bindings, _types_model);
+	apply_named_bindings(std::move(prepared_named_bindings), std::move(named_ids));
+}
+
+std::vector<named_binding> injector_core::current_named_bindings() const
+{
+	auto result = std::vector<named_binding>{};
+	result.reserve(_named_bindings.size());
+	for (auto id = 0; id < _named_bindings.size(); id++)
+		result.emplace_back(_named_bindings.at(id).binding_type, _named_bindings.at(id).name, std::unique_ptr<provider>{});
+	return result;
+}
+
+named_bindings injector_core::prepare_named_bindings(std::vector<named_binding> named) const
+{
+	auto result = named_bindings{std::move(named)};
+	for (auto id = 0; id < result.size(); id++)
+	{
+		auto &binding = result.at(id);
+		auto configured_id = _named_bindings.id_of(binding.binding_type, binding.name);
+		if (configured_id >= 0)
+		{
+			binding.binding_dependencies = _named_bindings.at(configured_id).binding_dependencies;
+			continue;
+		}
+
+		assert(binding.binding_provider);
+		if (binding.binding_provider->require_resolving())
+		{
+			auto &provided_type = binding.binding_provider->provided_type();
+			auto merged_known_types = types_by_name{};
+			binding.binding_dependencies = extract_dependencies(known_types_for(provided_type, merged_known_types), wiring_table_of(provided_type));
+		}
+	}
+	return result;
+}
+
+injector_core::named_id_map injector_core::map_named_dependencies(const named_bindings &bindings, const types_model &model) const
+{
+	auto result = named_id_map{};
+	auto message = std::string{};
+	auto map_dependency = [&](const char *dependent_name, const dependency &d){
+		if (d.setter().qualifier().empty())
+			return;
+		auto id = bindings.id_of(d.required_type(), d.setter().qualifier());
+		if (id < 0)
+			message.append(dependent_name).append(": ").append(d.setter().signature()).append(" named ").append(d.setter().qualifier()).append("\n");
+		else
+			result.insert({std::make_pair(d.setter().meta_method().enclosingMetaObject(), d.setter().meta_method().methodIndex()), id});
+	};
+
+	for (auto &&mapped_type_dependencies : model.mapped_dependencies())
+		for (auto &&d : mapped_type_dependencies.dependency_list())
+			map_dependency(mapped_type_dependencies.dependent_type().c_name(), d);
+
+	for (auto id = 0; id < bindings.size(); id++)
+	{
+		auto &binding = bindings.at(id);
+		for (auto &&d : binding.binding_dependencies)
+		{
+			map_dependency(binding.binding_type.c_name(), d);
+			if (d.setter().is_eager() && !model.contains(d.required_type()))
+				message.append(binding.binding_type.c_name()).append(" named ").append(binding.name).append(": ").append(d.setter().signature()).append("\n");
+		}
+	}
+
+	if (!message.empty())
+		throw exception::unresolvable_dependencies{message};
+	return result;
+}
+
+void injector_core::apply_named_bindings(named_bindings bindings, named_id_map named_ids)
+{
+	for (auto id = _named_bindings.size() - 1; id >= 0; id--)
+	{
+		auto &configured = _named_bindings.at(id);
+		auto new_id = bindings.id_of(configured.binding_type, configured.name);
+		if (new_id >= 0)
+		{
+			auto &binding = bindings.at(new_id);
+			binding.binding_provider = std::move(configured.binding_provider);
+			binding.object = configured.object;
+		}
+		else if (configured.object && configured.binding_provider->require_resolving())
+			call_done_methods(configured.object);
+	}
+
+	// providers of bindings that are no longer configured are destroyed with their objects
+	_named_bindings = std::move(bindings);
+	_named_ids = std::move(named_ids);
+}
+
+int injector_core::named_id_for(const setter_method &setter)
+{
+	auto key = std::make_pair(setter.meta_method().enclosingMetaObject(), setter.meta_method().methodIndex());
+	auto id_it = _named_ids.find(key);
+	if (id_it != std::end(_named_ids))
+		return id_it->second;
+
+	auto id = _named_bindings.id_of(setter.parameter_type(), setter.qualifier());
+	if (id < 0)
+		throw exception::unknown_type{std::string{setter.parameter_type().c_name()} + " named " + setter.qualifier()};
+	_named_ids.insert({key, id});
+	return id;
+}
+
+QObject * injector_core::get_named(int id)
+{
+	auto &binding = _named_bindings.at(id);
+	if (binding.object)
+		return binding.object;
+
+	for (auto &&r : binding.binding_provider->required_types())
+		instantiate_interface(r);
+	// object is stored before its setters are called, so named objects can depend on each other
+	binding.object = invoke_provider(*binding.binding_provider);
+	if (binding.binding_provider->require_resolving())
+	{
+		for (auto &&d : binding.binding_dependencies)
+			inject_dependency(binding.object, d);
+		call_init_methods(binding.object);
+	}
+	return binding.object;
+}
+
+void injector_core::configure_sets(std::vector<implemented_by> set_members)
+{
+	for (auto &&set_member : set_members)
+		assert(_types_model.contains(set_member.implementation_type()));
+
+	// sets injected again by remove_providers are kept, so objects share them with get_set
+	if (set_members == _set_members)
+		return;
+
+	_set_members = std::move(set_members);
+	_sets.clear();
+}
+
+QObject * injector_core::replace_ready_object(const implementation &ready_implementation)
+{
+	auto provider_it = _available_providers.get(ready_implementation.interface_type());
+	if (provider_it == std::end(_available_providers) || !(*provider_it)->is_ready())
+		throw exception::unknown_type{std::string{"type is not configured as ready object: "} + ready_implementation.interface_type().c_name()};
+
+	auto p = static_cast<provider_ready *>(provider_it->get());
+	auto old_object = p->ready_implementation().object();
+	auto new_object = ready_implementation.object();
+	if (old_object == new_object)
+		return nullptr;
+
+	p->set_ready_implementation(ready_implementation);
+
+	// object is only stored if it was already requested
+	if (_objects.contains_key(ready_implementation.interface_type()))
+	{
+		auto new_objects = objects_to_store({ready_implementation});
+		for (auto &&i : new_objects)
+			_objects.remove(i.interface_type());
+		_objects.merge(implementations{new_objects});
+	}
+
+	rebind_ready_object(old_object, new_object);
+	return old_object;
+}
+
+void injector_core::rebind_ready_object(QObject *old_object, QObject *new_object)
+{
+	assert(new_object);
+
+	if (_reverse_dependencies.is_tracked(old_object))
+		for (auto &&d : _reverse_dependencies.rebind(old_object, new_object))
+			resolved_dependency{implementation{d.setter.parameter_type(), new_object}, d.setter}.apply_on(d.object);
+
+	// sets with previous object are created again on next request, objects that received them keep old ones
+	for (auto set_it = std::begin(_sets); set_it != std::end(_sets);)
+		if (std::find(std::begin(set_it->second), std::end(set_it->second), old_object) != std::end(set_it->second))
+			set_it = _sets.erase(set_it);
+		else
+			++set_it;
+}
+
+void injector_core::track_ready_objects()
+{
+	// objects of super cores are injected into own objects, so these are replaced in sub cores too
+	std::function<void(const injector_core &)> track = [&](const injector_core &core){
+		for (auto &&p : core._available_providers)
+			if (p->is_ready())
+				_reverse_dependencies.track(static_cast<provider_ready *>(p.get())->ready_implementation().object());
+		for (auto &&super_core : core._super_cores)
+			track(*super_core);
+	};
+	track(*this);
+}
+
+void injector_core::find_super_owners()
+{
+	if (_super_cores.empty())
+		return;
+
+	for (auto &&p : _available_providers)
+		for (auto &&r : p->required_types())
+			super_owner_for(r);
+	for (auto &&mapped_type_dependencies : _types_model.mapped_dependencies())
+		for (auto &&d : mapped_type_dependencies.dependency_list())
+			super_owner_for(d.required_type());
+}
+
+injector_core * injector_core::super_owner_for(const type &interface_type)
+{
+	if (_super_cores.empty())
+		return nullptr;
+
+	auto owner_it = _super_owners.find(interface_type);
+	if (owner_it != std::end(_super_owners))
+		return owner_it->second;
+
+	auto owner_model = _types_model.owner_of(interface_type);
+	if (!owner_model || owner_model == &_types_model)
+		return nullptr;
+
+	auto owner = static_cast<injector_core *>(nullptr);
+	for (auto &&super_core : _super_cores)
+		if ((owner = super_core->core_with_model(owner_model)))
+			break;
+
+	assert(owner);
+	_super_owners.insert({interface_type, owner});
+	return owner;
+}
+
+injector_core * injector_core::core_with_model(const types_model *model)
+{
+	if (&_types_model == model)
+		return this;
+
+	for (auto &&super_core : _super_cores)
+	{
+		auto result = super_core->core_with_model(model);
+		if (result)
+			return result;
+	}
+
+	return nullptr;
+}
+
+types injector_core::find_types_with(bool (provider::*predicate)() const) const
+{
+	auto implementation_types = std::vector<type>{};
+	for (auto &&p : _available_providers)
+		if (((*p).*predicate)())
+			implementation_types.push_back(p->provided_type());
+	if (implementation_types.empty())
+		return types{};
+
+	auto matching_implementation_types = types{implementation_types};
+	auto result = std::vector<type>{};
+	for (auto &&i : _types_model.available_types())
+		if (matching_implementation_types.contains(i.implementation_type()))
+			result.push_back(i.interface_type());
+	return types{result};
+}
+
+types injector_core::shared_types(const types &to_filter) const
+{
+	if (_scoped_types.empty() && _prototype_types.empty())
+		return to_filter;
+
+	auto result = std::vector<type>{};
+	for (auto &&t : to_filter)
+		if (!_scoped_types.contains(t) && !_prototype_types.contains(t))
+			result.push_back(t);
+	return types{result};
+}
+
+bool injector_core::is_scoped(const type &interface_type)
+{
+	auto owner = super_owner_for(interface_type);
+	return owner
+		? owner->is_scoped(interface_type)
+		: _scoped_types.contains(interface_type);
+}
+
+bool injector_core::is_prototype(const type &interface_type)
+{
+	auto owner = super_owner_for(interface_type);
+	return owner
+		? owner->is_prototype(interface_type)
+		: _prototype_types.contains(interface_type);
+}
+
+void injector_core::validate_scoped_dependencies()
+{
+	auto message = std::string{};
+	for (auto &&p : _available_providers)
+		for (auto &&r : p->required_types())
+			if (is_scoped(r))
+			{
+				message.append(p->provided_type().c_name());
+				message.append("\n");
+			}
+
+	for (auto &&mapped_type_dependencies : _types_model.mapped_dependencies())
+	{
+		if (is_scoped(mapped_type_dependencies.dependent_type()))
+			continue;
+		for (auto &&d : mapped_type_dependencies.dependency_list())
+			if (!d.setter().is_set() && d.setter().qualifier().empty() && is_scoped(d.required_type()))
+			{
+				message.append(mapped_type_dependencies.dependent_type().c_name());
+				message.append("\n");
+				break;
+			}
+	}
+
+	if (!message.empty())
+		throw exception::dependency_on_scoped_type{message};
+}
+
+void injector_core::enter_scope()
+{
+	_scopes.emplace_back();
+}
+
+void injector_core::leave_scope()
+{
+	if (_scopes.empty())
+		throw exception::no_active_scope{};
+
+	auto &resolved_objects = _scopes.back().resolved_objects();
+	for (auto i = resolved_objects.rbegin(), e = resolved_objects.rend(); i != e; ++i)
+		call_done_methods(*i);
+
+	// all objects of scope are destroyed in one pass
+	_scopes.pop_back();
+}
+
+QObject * injector_core::get_scoped(const type &interface_type)
+{
+	if (_scopes.empty())
+		throw exception::no_active_scope{interface_type.c_name()};
+
+	auto &current_scope = _scopes.back();
+	auto object = current_scope.get(interface_type);
+	if (object)
+		return object;
+
+	instantiate_scoped(implementation_for(interface_type), current_scope);
+	return current_scope.get(interface_type);
+}
+
+void injector_core::instantiate_scoped(const type &implementation_type, scope &in_scope)
+{
+	auto types_to_instantiate = std::vector<type>{implementation_type};
+	for (decltype(types_to_instantiate.size()) i = 0; i < types_to_instantiate.size(); i++)
+		for (auto &&d : implementation_type_dependencies(types_to_instantiate[i]))
+		{
+			if (!d.setter().is_eager() || !_scoped_types.contains(d.required_type()) || in_scope.get(d.required_type()))
+				continue;
+			auto required_implementation_type = implementation_for(d.required_type());
+			if (std::find(std::begin(types_to_instantiate), std::end(types_to_instantiate), required_implementation_type) == std::end(types_to_instantiate))
+				types_to_instantiate.push_back(required_implementation_type);
+		}
+
+	auto objects = std::vector<implementation>{};
+	objects.reserve(types_to_instantiate.size());
+	for (auto &&provider : providers_for(types_to_instantiate))
+	{
+		auto object = std::unique_ptr<QObject>{invoke_provider(*provider)};
+		auto i = make_implementation(provider->provided_type(), object.get());
+		in_scope.add(std::move(object), objects_to_store({i}));
+		objects.push_back(i);
+	}
+
+	for (auto &&object : objects)
+		for (auto &&d : implementation_type_dependencies(object.interface_type()))
+			inject_dependency(object.object(), d);
+
+	for (auto &&object : objects)
+	{
+		call_init_methods(object.object());
+		in_scope.mark_resolved(object.object());
+	}
+}
+
+void injector_core::inject_dependency(QObject *object, const dependency &d)
 {
+	if (d.setter().is_lazy())
+		d.setter().invoke(object, get_lazy(d.required_type()));
+	else if (d.setter().is_set())
+		d.setter().invoke(object, get_set(d.required_type()));
+	else if (!d.setter().qualifier().empty())
+		d.setter().invoke(object, get_named(named_id_for(d.setter())));
+	else
+	{
+		auto dependency_object = get(d.required_type());
+		d.setter().invoke(object, dependency_object);
+		_reverse_dependencies.add(dependency_object, object, d.setter());
+	}
 }
 
-injector_core::injector_core(types_by_name known_types, std::vector<std::unique_ptr<provider>> &&all_providers) :
-	_known_types{std::move(known_types)}
+void injector_core::validate_prototype_dependencies() const
 {
-	auto all_providers_size = all_providers.size();
-	_available_providers = providers{std::move(all_providers)};
+	if (_prototype_types.empty())
+		return;
 
-	// some types were removed, because of duplication
-	if (_available_providers.size() != all_providers_size)
-		throw exception::ambiguous_types{}; // TODO: find a way to extract type names
+	// depth-first search for cycles in graph of prototype implementation types
+	auto visited = std::map<type, bool>{}; // true when all dependencies were visited
+	auto message = std::string{};
+	std::function<void(const type &)> visit = [&](const type &implementation_type){
+		auto visited_it = visited.find(implementation_type);
+		if (visited_it != std::end(visited))
+		{
+			if (!visited_it->second && message.empty())
+				message = std::string{"prototype dependency cycle: "} + implementation_type.c_name();
+			return;
+		}
 
-	_types_model = create_types_model();
+		visited.insert({implementation_type, false});
+		for (auto &&d : implementation_type_dependencies(implementation_type))
+			if (d.setter().is_eager() && _prototype_types.contains(d.required_type()))
+				visit(implementation_for(d.required_type()));
+		visited[implementation_type] = true;
+	};
 
-	auto required_types = std::vector<type>{};
 	for (auto &&p : _available_providers)
-		for (auto &&r : p->required_types())
-			required_types.push_back(r);
+		if (p->is_prototype())
+			visit(p->provided_type());
+
+	if (!message.empty())
+		throw exception::invalid_dependency{message};
+}
 
-	auto unavailable_required_types = match(types{required_types}, _types_model.available_types()).unmatched_1;
-	if (!unavailable_required_types.empty())
+QObject * injector_core::get_prototype(const type &interface_type)
+{
+	auto implementation_type = implementation_for(interface_type);
+	auto p = static_cast<provider_prototype *>(_available_providers.get(implementation_type)->get());
+	auto object = p->take_from_pool();
+	if (!object)
 	{
-		auto message = std::string{};
-		for (auto &&t : unavailable_required_types)
-		{
-			message.append(t.name());
-			message.append("\n");
-		}
-		throw exception::unavailable_required_types{message};
+		// pooled objects already have all dependencies set
+		object.reset(invoke_provider(*p));
+		for (auto &&d : implementation_type_dependencies(implementation_type))
+			inject_dependency(object.get(), d);
+		call_init_methods(object.get());
 	}
+
+	auto result = object.get();
+	_prototype_objects.insert(std::make_pair(result, std::move(object)));
+	return result;
 }
 
-injector_core::~injector_core()
+void injector_core::release(QObject *object)
 {
-	for (auto &&resolved_object : _resolved_objects)
-		call_done_methods(resolved_object.object());
+	assert(object);
+
+	if (!try_release(object))
+		throw exception::invalid_qobject{std::string{"object is not a prototype: "} + object->metaObject()->className()};
 }
 
-types_model injector_core::create_types_model() const
+bool injector_core::try_release(QObject *object)
 {
-	auto all_types = std::vector<type>{};
-	auto need_dependencies = std::vector<type>{};
-	for (auto &&p : _available_providers)
+	auto object_it = _prototype_objects.find(object);
+	if (object_it == std::end(_prototype_objects))
 	{
-		all_types.push_back(p->provided_type());
-		if (p->require_resolving())
-		{
-			auto interfaces = extract_interfaces(p->provided_type());
-			std::copy(std::begin(interfaces), std::end(interfaces), std::back_inserter(need_dependencies));
-		}
+		for (auto &&super_core : _super_cores)
+			if (super_core->try_release(object))
+				return true;
+		return false;
+	}
+
+	auto released = std::move(object_it->second);
+	_prototype_objects.erase(object_it);
+
+	for (auto &&action : wiring_table_of(type{object->metaObject()}).reset_actions())
+		action.invoke(object);
+
+	auto p = static_cast<provider_prototype *>(_available_providers.get(type{object->metaObject()})->get());
+	auto not_pooled = p->put_to_pool(std::move(released));
+	if (not_pooled)
+		call_done_methods(not_pooled.get());
+
+	return true;
+}
+
+const types_by_name & injector_core::known_types() const
+{
+	return _known_types;
+}
+
+const types_model & injector_core::model() const
+{
+	return _types_model;
+}
+
+std::vector<const types_by_name *> injector_core::known_types_chain() const
+{
+	auto result = std::vector<const types_by_name *>{&_known_types};
+	for (auto &&super_core : _super_cores)
+	{
+		auto super_chain = super_core->known_types_chain();
+		std::copy(std::begin(super_chain), std::end(super_chain), std::back_inserter(result));
+	}
+	return result;
+}
+
+const types_by_name & injector_core::known_types_for(const type &for_type, types_by_name &merged_known_types) const
+{
+	return known_types_for(_known_types, for_type, merged_known_types);
+}
+
+const types_by_name & injector_core::known_types_for(const types_by_name &own_known_types, const type &for_type, types_by_name &merged_known_types) const
+{
+	if (_super_cores.empty())
+		return own_known_types;
+
+	auto super_known_types = std::vector<const types_by_name *>{};
+	for (auto &&super_core : _super_cores)
+	{
+		auto super_chain = super_core->known_types_chain();
+		std::copy(std::begin(super_chain), std::end(super_chain), std::back_inserter(super_known_types));
+	}
+
+	auto referenced = referenced_types(std::vector<type>{for_type}, own_known_types, super_known_types);
+	if (referenced.empty())
+		return own_known_types;
+
+	merged_known_types = own_known_types;
+	merged_known_types.merge(types_by_name{referenced});
+	return merged_known_types;
+}
+
+const wiring_tables & injector_core::tables() const
+{
+	return _wiring_tables;
+}
+
+std::vector<type> injector_core::add_wiring_tables(const std::vector<type> &for_types)
+{
+	return _wiring_tables.add(for_types);
+}
+
+std::vector<type> injector_core::add_missing_wiring_tables(const std::vector<type> &for_types) const
+{
+	auto missing = std::vector<type>{};
+	std::copy_if(std::begin(for_types), std::end(for_types), std::back_inserter(missing),
+		[this](const type &t){ return find_wiring_table(t) == nullptr; });
+	return _wiring_tables.add(missing);
+}
+
+void injector_core::remove_wiring_tables(const std::vector<type> &removed_types)
+{
+	_wiring_tables.remove(removed_types);
+}
+
+const wiring_table * injector_core::find_wiring_table(const type &for_type) const
+{
+	auto table = _wiring_tables.find(for_type);
+	if (table)
+		return table;
+
+	for (auto &&super_core : _super_cores)
+	{
+		table = super_core->find_wiring_table(for_type);
+		if (table)
+			return table;
 	}
-	return make_types_model(_known_types, all_types, need_dependencies);
+
+	return nullptr;
+}
+
+const wiring_table & injector_core::wiring_table_of(const type &for_type) const
+{
+	auto table = find_wiring_table(for_type);
+	return table ? *table : wiring_table_of(for_type);
+}
+
+std::vector<type_dependencies> injector_core::extract_all_dependencies(const types_by_name &known_types, const std::vector<type> &need_dependencies) const
+{
+	// tables are built before analysis, as the cache can not be modified from many threads
+	add_missing_wiring_tables(need_dependencies);
+
+	auto make_dependencies = std::function<type_dependencies(const type &)>{[&](const type &t){
+		auto merged_known_types = types_by_name{};
+		return type_dependencies{t, extract_dependencies(known_types_for(known_types, t, merged_known_types), *find_wiring_table(t))};
+	}};
+	return parallel_transform(need_dependencies, make_dependencies, analysis_thread_count());
 }
 
 std::vector<type> injector_core::provided_types() const
 {
 	auto result = std::vector<type>{};
 	std::transform(std::begin(_available_providers), std::end(_available_providers), std::back_inserter(result), type_from_provider);
+	for (auto &&super_core : _super_cores)
+	{
+		auto super_provided_types = super_core->provided_types();
+		std::copy(std::begin(super_provided_types), std::end(super_provided_types), std::back_inserter(result));
+	}
 	return result;
 }
 
@@ -117,6 +1174,9 @@ void injector_core::instantiate(const type &interface_type)
 
 void injector_core::instantiate_all_with_type_role(const std::string &type_role)
 {
+	for (auto &&super_core : _super_cores)
+		super_core->instantiate_all_with_type_role(type_role);
+
 	for (auto &&provider : _available_providers)
 	{
 		auto type = provider->provided_type();
@@ -125,18 +1185,312 @@ void injector_core::instantiate_all_with_type_role(const std::string &type_role)
 	}
 }
 
+void injector_core::start_warmup(const std::string &type_role, std::chrono::milliseconds slice_budget, std::function<void()> on_finished)
+{
+	start_warmup(warmup_plan(type_role), slice_budget, std::move(on_finished));
+}
+
+void injector_core::start_warmup(std::vector<type> plan, std::chrono::milliseconds slice_budget, std::function<void()> on_finished)
+{
+	_warmup.reset(new incremental_warmup{std::move(plan), [this](const type &interface_type){
+		instantiate(interface_type);
+	}, slice_budget, std::move(on_finished)});
+	_warmup->start();
+}
+
+bool injector_core::is_warming_up() const
+{
+	return _warmup && !_warmup->is_finished();
+}
+
+void injector_core::start_profile_recording(std::chrono::milliseconds duration)
+{
+	_startup_profile.start_recording(duration);
+}
+
+void injector_core::record_first_use(const type &interface_type, bool critical)
+{
+	if (_startup_profile.is_recording())
+		_startup_profile.record(interface_type.c_name(), critical);
+}
+
+const startup_profile & injector_core::recorded_profile() const
+{
+	return _startup_profile;
+}
+
+bool injector_core::start_prewarm_from_profile(const std::string &file_name, std::chrono::milliseconds slice_budget, std::function<void()> on_finished)
+{
+	auto profile = startup_profile{};
+	if (!profile.load(file_name))
+		return false;
+
+	start_warmup(prewarm_plan(profile), slice_budget, std::move(on_finished));
+	return true;
+}
+
+std::vector<type> injector_core::prewarm_plan(const startup_profile &profile)
+{
+	auto entries = profile.entries();
+	std::stable_sort(std::begin(entries), std::end(entries), [](const startup_profile_entry &x, const startup_profile_entry &y){
+		return x.critical != y.critical
+			? x.critical
+			: x.offset < y.offset;
+	});
+
+	auto result = std::vector<type>{};
+	auto chain = known_types_chain();
+	for (auto &&e : entries)
+		for (auto &&known_types : chain)
+		{
+			auto t = type_by_pointer(*known_types, e.type_name + "*");
+			if (t.is_empty())
+				continue;
+			// profile may come from run with other configuration
+			if (_types_model.contains(t) && !is_scoped(t) && !_prototype_types.contains(t))
+				result.push_back(t);
+			break;
+		}
+
+	return result;
+}
+
+std::vector<type> injector_core::warmup_plan(const std::string &type_role)
+{
+	auto result = std::vector<type>{};
+	for (auto &&super_core : _super_cores)
+		for (auto &&t : super_core->warmup_plan(type_role))
+			result.push_back(t);
+
+	// depth-first search, so each type is placed after all its dependencies
+	auto visited = std::set<type>{};
+	std::function<void(const type &)> visit = [&](const type &interface_type){
+		if (!visited.insert(interface_type).second)
+			return;
+		if (super_owner_for(interface_type))
+		{
+			result.push_back(interface_type);
+			return;
+		}
+		if (_scoped_types.contains(interface_type) || _prototype_types.contains(interface_type))
+			return;
+
+		auto implementation_type = implementation_for(interface_type);
+		auto provider_it = _available_providers.get(implementation_type);
+		if (provider_it != std::end(_available_providers))
+			for (auto &&r : (*provider_it)->required_types())
+				visit(r);
+		for (auto &&d : implementation_type_dependencies(implementation_type))
+			if (d.setter().is_eager())
+				visit(d.required_type());
+		result.push_back(interface_type);
+	};
+
+	for (auto &&provider : _available_providers)
+		if (has_type_role(provider->provided_type(), type_role))
+			visit(provider->provided_type());
+
+	return result;
+}
+
 QObject * injector_core::get(const type &interface_type)
 {
 	assert(!interface_type.is_empty());
 	assert(!interface_type.is_qobject());
 
-	instantiate(interface_type);
+	auto object_it = _objects.get(interface_type);
+	if (object_it != end(_objects))
+		return object_it->object();
+
+	auto owner = super_owner_for(interface_type);
+	if (owner)
+		return owner->get(interface_type);
+
+	if (_scoped_types.contains(interface_type))
+		return get_scoped(interface_type);
+	if (_prototype_types.contains(interface_type))
+		return get_prototype(interface_type);
+
+	instantiate_interface(interface_type);
 	return _objects.get(interface_type)->object();
 }
 
+QObject * injector_core::try_get(const type &interface_type)
+{
+	assert(!interface_type.is_empty());
+	assert(!interface_type.is_qobject());
+
+	auto object_it = _objects.get(interface_type);
+	if (object_it != end(_objects))
+		return object_it->object();
+
+	if (!_types_model.contains(interface_type))
+		return nullptr;
+
+	return get(interface_type);
+}
+
+bool injector_core::try_instantiate(const type &interface_type)
+{
+	assert(!interface_type.is_empty());
+	assert(!interface_type.is_qobject());
+
+	if (!_types_model.contains(interface_type))
+		return false;
+
+	instantiate(interface_type);
+	return true;
+}
+
+lazy_handle injector_core::get_lazy(const type &interface_type)
+{
+	assert(!interface_type.is_empty());
+	assert(!interface_type.is_qobject());
+
+	if (!_types_model.contains(interface_type))
+		throw exception::unknown_type{interface_type.c_name()};
+
+	auto mutex = _lazy_mutex;
+	return lazy_handle{std::make_shared<lazy_state>(interface_type, std::move(mutex), [this, interface_type]{
+		return get(interface_type);
+	})};
+}
+
+object_set injector_core::get_set(const type &set_type)
+{
+	assert(!set_type.is_empty());
+	assert(!set_type.is_qobject());
+
+	auto set_it = _sets.find(set_type);
+	if (set_it != std::end(_sets))
+		return set_it->second;
+
+	auto objects = std::vector<QObject *>{};
+	for (auto &&super_core : _super_cores)
+	{
+		auto super_set = super_core->get_set(set_type);
+		std::copy(std::begin(super_set), std::end(super_set), std::back_inserter(objects));
+	}
+
+	auto member_types = std::vector<type>{};
+	for (auto &&set_member : _set_members)
+		if (set_member.interface_type() == set_type)
+			member_types.push_back(set_member.implementation_type());
+	auto members = get_all(member_types);
+	std::copy(std::begin(members), std::end(members), std::back_inserter(objects));
+
+	auto result = object_set{set_type, std::make_shared<const std::vector<QObject *>>(std::move(objects))};
+	// members may be injected with the same set while they are created
+	set_it = _sets.find(set_type);
+	if (set_it != std::end(_sets))
+		return set_it->second;
+	_sets.insert({set_type, result});
+	return result;
+}
+
+void injector_core::get_async(const type &interface_type, std::function<void(QObject *)> on_ready)
+{
+	assert(!interface_type.is_empty());
+	assert(!interface_type.is_qobject());
+
+	_async_constructions.erase(std::remove_if(std::begin(_async_constructions), std::end(_async_constructions),
+		[](const std::unique_ptr<async_construction> &c){ return c->is_finished(); }), std::end(_async_constructions));
+
+	auto object_it = _objects.get(interface_type);
+	if (object_it != end(_objects))
+	{
+		on_ready(object_it->object());
+		return;
+	}
+
+	auto owner = super_owner_for(interface_type);
+	if (owner)
+	{
+		owner->get_async(interface_type, std::move(on_ready));
+		return;
+	}
+
+	if (_scoped_types.contains(interface_type) || _prototype_types.contains(interface_type))
+	{
+		on_ready(get(interface_type));
+		return;
+	}
+
+	auto implementation_type = implementation_for(interface_type);
+	auto types_to_instantiate = shared_types(required_to_satisfy(implementation_type_dependencies(implementation_type), _types_model, _objects));
+	types_to_instantiate.add(implementation_type);
+
+	auto default_constructed = std::vector<provider_by_default_constructor *>{};
+	auto constructors = std::vector<default_constructor_method>{};
+	for (auto &&p : providers_for(non_instantiated(types_to_instantiate)))
+		if (p->is_default_constructed() && !static_cast<provider_by_default_constructor *>(p)->thread())
+		{
+			// thread-affine objects are constructed on own threads when instantiated later
+			default_constructed.push_back(static_cast<provider_by_default_constructor *>(p));
+			constructors.push_back(default_constructed.back()->constructor());
+		}
+
+	auto on_constructed = [this, interface_type, default_constructed, on_ready](std::vector<std::unique_ptr<QObject>> objects){
+		for (decltype(objects.size()) i = 0; i < objects.size(); i++)
+			if (objects[i])
+				default_constructed[i]->adopt(std::move(objects[i])); // not adopted objects are destroyed
+
+		auto result = static_cast<QObject *>(nullptr);
+		try
+		{
+			result = get(interface_type);
+		}
+		catch (exception::exception &)
+		{
+			// caller can repeat request with get(const type &) to receive exception
+		}
+		on_ready(result);
+	};
+	_async_constructions.emplace_back(new async_construction{std::move(constructors), on_constructed, [on_ready]{ on_ready(nullptr); }});
+}
+
+std::vector<QObject *> injector_core::get_all(const std::vector<type> &interface_types)
+{
+	auto batch_dependencies = dependencies{};
+	auto types_to_instantiate = types{};
+	for (auto &&interface_type : interface_types)
+	{
+		assert(!interface_type.is_empty());
+		assert(!interface_type.is_qobject());
+
+		if (_objects.get(interface_type) != end(_objects))
+			continue;
+		// these are handled by get(const type &) one by one
+		if (super_owner_for(interface_type) || _scoped_types.contains(interface_type) || _prototype_types.contains(interface_type))
+			continue;
+
+		auto implementation_type = implementation_for(interface_type);
+		batch_dependencies.merge(implementation_type_dependencies(implementation_type));
+		types_to_instantiate.add(implementation_type);
+	}
+
+	if (!types_to_instantiate.empty())
+	{
+		types_to_instantiate.merge(shared_types(required_to_satisfy(batch_dependencies, _types_model, _objects)));
+		instantiate_all(types_to_instantiate);
+	}
+
+	auto result = std::vector<QObject *>{};
+	result.reserve(interface_types.size());
+	for (auto &&interface_type : interface_types)
+		result.push_back(get(interface_type));
+	return result;
+}
+
 std::vector<QObject *> injector_core::get_all_with_type_role(const std::string &type_role)
 {
 	auto result = std::vector<QObject *>{};
+	for (auto &&super_core : _super_cores)
+	{
+		auto super_result = super_core->get_all_with_type_role(type_role);
+		std::copy(std::begin(super_result), std::end(super_result), std::back_inserter(result));
+	}
+
 	for (auto &&provider : _available_providers)
 	{
 		auto type = provider->provided_type();
@@ -152,7 +1506,15 @@ void injector_core::instantiate_interface(const type &interface_type)
 	assert(!interface_type.is_empty());
 	assert(!interface_type.is_qobject());
 
-	instantiate_implementation(implementation_for(interface_type));
+	auto owner = super_owner_for(interface_type);
+	if (owner)
+		owner->instantiate(interface_type);
+	else if (_scoped_types.contains(interface_type))
+		get_scoped(interface_type);
+	else if (_prototype_types.contains(interface_type))
+		return; // prototype objects are only created when requested
+	else
+		instantiate_implementation(implementation_for(interface_type));
 }
 
 type injector_core::implementation_for(const type &interface_type) const
@@ -162,7 +1524,7 @@ type injector_core::implementation_for(const type &interface_type) const
 
 	auto implementation_type_it = _types_model.available_types().get(interface_type);
 	if (implementation_type_it == end(_types_model.available_types()))
-		throw exception::unknown_type{interface_type.name()};
+		throw exception::unknown_type{interface_type.c_name()};
 	return implementation_type_it->implementation_type();
 }
 
@@ -171,7 +1533,7 @@ void injector_core::instantiate_implementation(const type &implementation_type)
 	assert(!implementation_type.is_empty());
 	assert(!implementation_type.is_qobject());
 
-	auto types_to_instantiate = required_to_satisfy(implementation_type_dependencies(implementation_type), _types_model, _objects);
+	auto types_to_instantiate = shared_types(required_to_satisfy(implementation_type_dependencies(implementation_type), _types_model, _objects));
 	types_to_instantiate.add(implementation_type);
 	instantiate_all(types_to_instantiate);
 }
@@ -218,7 +1580,7 @@ std::vector<provided_object> injector_core::provide_objects(const std::vector<pr
 	result.reserve(providers.size());
 	for (auto &&provider : providers)
 	{
-		auto instance = provider->provide(*this);
+		auto instance = invoke_provider(*provider);
 		auto i = make_implementation(provider->provided_type(), instance);
 		result.push_back(provided_object{provider, i});
 	}
@@ -269,45 +1631,132 @@ void injector_core::resolve_objects(const std::vector<implementation> &objects)
 	_resolved_objects.merge(implementations{objects});
 }
 
-void injector_core::resolve_object(const implementation &object) const
+void injector_core::resolve_object(const implementation &object)
 {
 	auto object_dependencies = implementation_type_dependencies(object.interface_type());
 	resolve_object(object_dependencies, object);
 }
 
-void injector_core::resolve_object(const dependencies &object_dependencies, const implementation &object) const
+void injector_core::resolve_object(const dependencies &object_dependencies, const implementation &object)
 {
 	auto resolved_dependencies = resolve_dependencies(object_dependencies, _objects);
-	assert(resolved_dependencies.unresolved.empty());
 
 	for (auto &&resolved : resolved_dependencies.resolved)
 	{
 		assert(implements(object.interface_type(), resolved.setter().object_type()));
 		resolved.apply_on(object.object());
+		_reverse_dependencies.add(resolved.resolved_with().object(), object.object(), resolved.setter());
 	}
+
+	// remaining dependencies are owned by super cores, are scoped, are prototypes or are lazy
+	for (auto &&unresolved : resolved_dependencies.unresolved)
+		inject_dependency(object.object(), unresolved);
 }
 
 void injector_core::inject_into(QObject *object)
 {
+	INJEQT_PROBE2(inject_into_start, object, object->metaObject()->className());
+
 	auto object_implementation = implementation{type{object->metaObject()}, object};
-	auto dependencies = extract_dependencies(_known_types, object_implementation.interface_type());
-	auto types_to_instantiate = required_to_satisfy(dependencies, _types_model, _objects);
+	auto merged_known_types = types_by_name{};
+	auto dependencies = extract_dependencies(known_types_for(object_implementation.interface_type(), merged_known_types),
+		wiring_table_of(object_implementation.interface_type()));
+	auto types_to_instantiate = shared_types(required_to_satisfy(dependencies, _types_model, _objects));
 	instantiate_all(types_to_instantiate);
 	resolve_object(dependencies, object_implementation);
 	call_init_methods(object);
+
+	INJEQT_PROBE2(inject_into_end, object, object->metaObject()->className());
+}
+
+assisted_injection injector_core::make_assisted_injection(const type &object_type)
+{
+	assert(!object_type.is_empty());
+	assert(!object_type.is_qobject());
+
+	auto merged_known_types = types_by_name{};
+	auto object_dependencies = extract_dependencies(known_types_for(object_type, merged_known_types), wiring_table_of(object_type));
+	instantiate_all(shared_types(required_to_satisfy(object_dependencies, _types_model, _objects)));
+
+	auto setter_calls = std::vector<assisted_injection_state::setter_call>{};
+	setter_calls.reserve(object_dependencies.size());
+	for (auto &&d : object_dependencies)
+	{
+		auto setter = d.setter();
+		if (setter.is_lazy())
+		{
+			auto handle = get_lazy(d.required_type());
+			setter_calls.push_back([setter, handle](QObject *object){ setter.invoke(object, handle); });
+		}
+		else if (setter.is_set())
+		{
+			auto set = get_set(d.required_type());
+			setter_calls.push_back([setter, set](QObject *object){ setter.invoke(object, set); });
+		}
+		else if (!setter.qualifier().empty())
+		{
+			auto dependency_object = get_named(named_id_for(setter));
+			setter_calls.push_back([setter, dependency_object](QObject *object){ setter.invoke(object, dependency_object); });
+		}
+		else if (is_scoped(d.required_type()) || is_prototype(d.required_type()))
+		{
+			// new object for each scope or each injection
+			auto dependency = d;
+			setter_calls.push_back([this, dependency](QObject *object){ inject_dependency(object, dependency); });
+		}
+		else
+		{
+			auto dependency_object = get(d.required_type());
+			setter_calls.push_back([this, setter, dependency_object](QObject *object){
+				setter.invoke(object, dependency_object);
+				_reverse_dependencies.add(dependency_object, object, setter);
+			});
+		}
+	}
+
+	auto init_actions = wiring_table_of(object_type).init_actions();
+	return assisted_injection{std::make_shared<assisted_injection_state>(object_type, std::move(setter_calls), std::move(init_actions))};
+}
+
+QThread * injector_core::affine_thread_of(QObject *object) const
+{
+	auto provider_it = _available_providers.get(type{object->metaObject()});
+	if (provider_it == std::end(_available_providers) || !(*provider_it)->is_default_constructed())
+		return nullptr;
+	return static_cast<provider_by_default_constructor *>(provider_it->get())->thread();
 }
 
 void injector_core::call_init_methods(QObject *object) const
 {
-	for (auto action : extract_actions("INJEQT_INIT", type{object->metaObject()}))
-		action.invoke(object);
+	auto &actions = wiring_table_of(type{object->metaObject()}).init_actions();
+	if (actions.empty())
+		return;
+
+	invoke_on_thread(affine_thread_of(object), [&actions, object]{
+		for (auto &&action : actions)
+		{
+			INJEQT_PROBE2(init_action, object, object->metaObject()->className());
+			action.invoke(object);
+		}
+	});
 }
 
 void injector_core::call_done_methods(QObject *object) const
 {
-	auto done_actions = extract_actions("INJEQT_DONE", type{object->metaObject()});
+	auto &done_actions = wiring_table_of(type{object->metaObject()}).done_actions();
 	for (auto i = done_actions.rbegin(), e = done_actions.rend(); i != e; ++i)
+	{
+		INJEQT_PROBE2(done_action, object, object->metaObject()->className());
 		i->invoke(object);
+	}
+}
+
+QObject * injector_core::invoke_provider(provider &p)
+{
+	INJEQT_PROBE1(provide_start, p.provided_type().c_name());
+	auto result = p.provide(*this);
+	INJEQT_PROBE2(provide_end, p.provided_type().c_name(), result);
+	return result;
 }
 
 }}
@@ -20,14 +20,31 @@
 
 #pragma once
 
+#include <injeqt/assisted-factory.h>
 #include <injeqt/injeqt.h>
+#include <injeqt/lazy.h>
+#include <injeqt/object-set.h>
 #include <injeqt/type.h>
 
+#include "async-construction.h"
+#include "implemented-by.h"
 #include "implementations.h"
+#include "incremental-warmup.h"
+#include "named-bindings.h"
 #include "providers.h"
+#include "reverse-dependencies.h"
+#include "scope.h"
+#include "startup-profile.h"
 #include "types-by-name.h"
 #include "types-model.h"
+#include "wiring-table.h"
 
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 #include <QtCore/QObject>
 
@@ -53,6 +70,49 @@ class provided_object;
  * Injector keeps list of all configured providers and of all already created objects.
  * Two methods objects_with(implementations, const type &) and objects_with(implementations, const types &)
  * are used to update list of already created objects with new ones.
+ *
+ * Injector core can be layered on top of super cores (of parent injectors). Its types_model then only
+ * contains own types and is layered on top of types models of super cores. Objects of types that are only
+ * available in super cores are requested from them and are not stored in this core. This means that
+ * creating sub injector costs only as much as analyzing its own providers.
+ *
+ * Super cores are not asked level by level. For each type available only in super cores the owning core
+ * (the one that has the type in own model, possibly many levels up) is found once and remembered, so all
+ * later requests go directly to the owner. Owners of all types used by own dependencies are found in
+ * constructor.
+ *
+ * Objects of scoped types (provided by providers with provider::is_scoped()) are not stored with other
+ * objects. Injector core keeps stack of scopes and stores these objects in the innermost one. When scope
+ * ends all its objects are destroyed at once.
+ *
+ * Objects of prototype types (provided by providers with provider::is_prototype()) are created for each
+ * request and each injection point. Injector core owns them until they are released with release(QObject *),
+ * then these are reset and returned to pool of provider for reuse.
+ *
+ * Dependencies injected with injeqt::lazy<T> setters are not instantiated together with objects that
+ * require them. Lazy handles are passed instead and objects are created on first access. Resolving of lazy
+ * handles is serialized with one mutex per injector core, so handles can be resolved from many threads at
+ * once. That mutex does not guard other methods of injector core, so these must not be called concurrently
+ * with resolving.
+ *
+ * Setter calls with objects of ready providers (provider::is_ready()) are recorded in reverse_dependencies
+ * index. When such object is replaced with replace_ready_object(const implementation &) only recorded setters
+ * are called again.
+ *
+ * Objects can be also requested asynchronously with get_async(const type &, std::function<void(QObject *)>).
+ * Then default constructors of all required types are invoked on worker threads and the rest of the work
+ * (factories, setters, INJEQT_INIT methods) is done on thread of injector core from its event loop.
+ *
+ * Objects with given type role can be instantiated incrementally with start_warmup(const std::string &,
+ * std::chrono::milliseconds, std::function<void()>). Then types are instantiated in small time-budgeted
+ * slices from event loop, dependencies first.
+ *
+ * Injector core can record order of first use of types in startup_profile. Profile saved in one run
+ * can be used in next one to instantiate these types in slices before they are requested.
+ *
+ * Objects of named_bindings are only injected by setters qualified with INJEQT_NAMED. Each time named bindings
+ * or types change all qualified setters of own types are mapped to dense ids of bindings, so injecting named
+ * objects only costs one lookup by meta object and method index. Named bindings are not shared with sub cores.
  */
 class INJEQT_API injector_core final
 {
@@ -85,6 +145,60 @@ public:
 	 */
 	explicit injector_core(types_by_name known_types, std::vector<std::unique_ptr<provider>> &&all_providers);
 
+	/**
+	 * @brief Create injector configured with set of providers on top of set of super cores.
+	 * @param super_cores list of cores providing types for this one to use, must outlive this object
+	 * @param known_types list of all known types, must contain all types of super cores used by @p all_providers
+	 * @param all_providers set of all own providers available to injector
+	 * @throw ambiguous_types if one or more types in @p providers is ambiguous
+	 * @throw ambiguous_types if one or more types in @p providers is also available in @p super_cores
+	 * @throw ambiguous_types if one type is provided by more than one of @p super_cores
+	 * @throw unresolvable_dependencies if a type with unresolvable dependency is found in @p providers
+	 * @throw dependency_on_self when type depends on self
+	 * @throw dependency_on_subtype when type depends on own supertype
+	 * @throw dependency_on_subtype when type depends on own subtype
+	 * @throw invalid_setter if any tagged setter has parameter that is not a QObject-derived pointer
+	 * @throw invalid_setter if any tagged setter has parameter that is a QObject pointer
+	 * @throw invalid_setter if any tagged setter has parameter that is a QObject-derived pointer of not configured type
+	 * @throw invalid_setter if any tagged setter has other number of parameters than one
+	 * @throw dependency_on_scoped_type if type that is not scoped depends on scoped type
+	 *
+	 * Types model of super cores is not copied. With only one super core cost of this constructor
+	 * depends only on size of @p all_providers.
+	 */
+	explicit injector_core(std::vector<injector_core *> super_cores, types_by_name known_types, std::vector<std::unique_ptr<provider>> &&all_providers);
+
+	/**
+	 * @brief Create injector configured with set of providers on top of set of super cores.
+	 * @param super_cores list of cores providing types for this one to use, must outlive this object
+	 * @param known_types list of all known types, must contain all types of super cores used by @p all_providers
+	 * @param all_providers set of all own providers available to injector
+	 * @param validation_manifest manifest returned by validation_manifest() for the same configuration, may be empty
+	 * @see injector_core(std::vector<injector_core *>, types_by_name, std::vector<std::unique_ptr<provider>> &&)
+	 *
+	 * If @p validation_manifest matches this configuration, passes that only look for errors are skipped:
+	 * ambiguous and unresolvable types, types available in many super cores, unavailable required types,
+	 * dependencies on scoped types and cycles of prototypes. Otherwise this constructor works and throws
+	 * exactly like the one without manifest.
+	 */
+	explicit injector_core(std::vector<injector_core *> super_cores, types_by_name known_types, std::vector<std::unique_ptr<provider>> &&all_providers,
+		const std::string &validation_manifest);
+
+	/**
+	 * @brief Create injector configured with set of providers on top of set of super cores, reusing wiring tables.
+	 * @param super_cores list of cores providing types for this one to use, must outlive this object
+	 * @param known_types list of all known types, must contain all types of super cores used by @p all_providers
+	 * @param all_providers set of all own providers available to injector
+	 * @param validation_manifest manifest returned by validation_manifest() for the same configuration, may be empty
+	 * @param tables wiring tables already built for configured types, for example to create @p all_providers
+	 * @see injector_core(std::vector<injector_core *>, types_by_name, std::vector<std::unique_ptr<provider>> &&, const std::string &)
+	 *
+	 * Tables from @p tables are used for analysis of dependencies, so meta objects of configured types are not
+	 * scanned again. Tables of other types are built when needed. Tables of super cores are reused too.
+	 */
+	explicit injector_core(std::vector<injector_core *> super_cores, types_by_name known_types, std::vector<std::unique_ptr<provider>> &&all_providers,
+		const std::string &validation_manifest, wiring_tables tables);
+
 	injector_core(const injector_core &) = delete;
 	injector_core(injector_core &&) = default;
 
@@ -94,10 +208,151 @@ public:
 	/**
 	 * @brief Destroy injector_core.
 	 *
+	 * Warmup is stopped, all pending asynchronous requests are canceled and all active scopes are left before other
+	 * objects are destroyed. Then INJEQT_DONE methods are called
+	 * on all prototype objects, including ones kept in pools.
+	 *
 	 * TODO: add note about INJEQT_DONE
 	 */
 	~injector_core();
 
+	/**
+	 * @brief Start new scope for scoped objects.
+	 * @see injector::enter_scope()
+	 */
+	void enter_scope();
+
+	/**
+	 * @brief End innermost scope and destroy all its objects.
+	 * @throw no_active_scope if there is no active scope
+	 * @see injector::leave_scope()
+	 *
+	 * INJEQT_DONE methods are called on all objects from scope in reverse order of creation, then all
+	 * objects are destroyed in one pass.
+	 */
+	void leave_scope();
+
+	/**
+	 * @brief Add new providers to live injector_core.
+	 * @param known_types list of all known types, including types of @p new_providers
+	 * @param new_providers providers to add
+	 * @throw ambiguous_types if one or more types in @p new_providers is ambiguous or is already available
+	 * @throw unresolvable_dependencies if a type with unresolvable dependency is found in @p new_providers
+	 * @throw unresolvable_dependencies if already configured type depends on interface that would become ambiguous
+	 * @throw unavailable_required_types if one of @p new_providers requires type that is not available
+	 * @throw dependency_on_scoped_type if type that is not scoped depends on scoped type
+	 * @throw invalid_dependency if prototype types depend on each other in cycle
+	 * @see injector::add_module(std::unique_ptr<module>)
+	 *
+	 * Only types of @p new_providers are analyzed, dependencies of already configured types are reused.
+	 * Already created objects are kept. Interfaces that become ambiguous are no longer available - objects
+	 * stay available with other interfaces. If an exception is thrown this object is not modified.
+	 */
+	void add_providers(types_by_name known_types, std::vector<std::unique_ptr<provider>> &&new_providers);
+
+	/**
+	 * @brief Add new providers to live injector_core and replace its named bindings.
+	 * @param known_types list of all known types, including types of @p new_providers and @p named
+	 * @param new_providers providers to add
+	 * @param named new list of all named bindings
+	 * @throw ambiguous_types if the same pair of type and name is used more than once in @p named
+	 * @throw unresolvable_dependencies if qualified setter or named object depends on binding or type that is not available
+	 * @see add_providers(types_by_name, std::vector<std::unique_ptr<provider>> &&)
+	 * @see configure_named_bindings(std::vector<named_binding>)
+	 *
+	 * Throws all exceptions of add_providers(types_by_name, std::vector<std::unique_ptr<provider>> &&). If an exception
+	 * is thrown this object is not modified.
+	 */
+	void add_providers(types_by_name known_types, std::vector<std::unique_ptr<provider>> &&new_providers, std::vector<named_binding> named);
+
+	/**
+	 * @brief Remove providers from live injector_core.
+	 * @param known_types list of all known types that are left
+	 * @param removed_types types of providers to remove
+	 * @throw unresolvable_dependencies if type that is left depends on or requires one of @p removed_types
+	 * @pre all @p removed_types are provided by this core
+	 * @see injector::remove_module(module *)
+	 *
+	 * Dependents of @p removed_types are not torn down transitively - such removal is rejected instead. Qualified
+	 * setters are checked against named bindings that are left. Only set setters may still refer to removed
+	 * types, as set can lose members.
+	 *
+	 * Objects of @p removed_types are torn down - INJEQT_DONE methods are called on them with dependents
+	 * first, then these are destroyed together with providers. This includes objects from active scopes
+	 * and prototype objects not yet released. Other objects are kept, only objects that received set with
+	 * removed objects are injected again with new set. Members of sets of @p removed_types are dropped. Interfaces
+	 * that are no longer ambiguous become available. Pending asynchronous requests are canceled. Cached
+	 * wiring tables of @p removed_types are dropped. If an exception is thrown this object is not modified.
+	 */
+	void remove_providers(types_by_name known_types, const std::vector<type> &removed_types);
+
+	/**
+	 * @brief Remove providers from live injector_core and replace its named bindings.
+	 * @param known_types list of all known types that are left
+	 * @param removed_types types of providers to remove
+	 * @param named new list of all named bindings
+	 * @throw unresolvable_dependencies if type that is left depends on or requires one of @p removed_types
+	 * @throw unresolvable_dependencies if qualified setter or named object depends on binding or type that is not available
+	 * @pre all @p removed_types are provided by this core
+	 * @see remove_providers(types_by_name, const std::vector<type> &)
+	 * @see configure_named_bindings(std::vector<named_binding>)
+	 *
+	 * Objects of named bindings that are not in @p named are torn down before objects of @p removed_types. If an exception
+	 * is thrown this object is not modified.
+	 */
+	void remove_providers(types_by_name known_types, const std::vector<type> &removed_types, std::vector<named_binding> named);
+
+	/**
+	 * @brief Replace named bindings.
+	 * @param named new list of all named bindings
+	 * @throw ambiguous_types if the same pair of type and name is used more than once in @p named
+	 * @throw unresolvable_dependencies if qualified setter or named object depends on binding or type that is not available
+	 * @throw invalid_setter if any tagged setter of named type is not valid
+	 * @see module::add_type<T>(const std::string &)
+	 *
+	 * Bindings with type and name that were already configured keep their providers and objects, providers
+	 * from @p named are dropped for them. Objects of bindings that are no longer configured are torn down. Then
+	 * all qualified setters are mapped to ids of bindings. If an exception is thrown this object is not modified.
+	 */
+	void configure_named_bindings(std::vector<named_binding> named);
+
+	/**
+	 * @brief Replace memberships of sets.
+	 * @param set_members memberships with set type as interface type and member type as implementation type
+	 * @pre all member types are available in this core
+	 * @see module::add_to_set<S, T>()
+	 *
+	 * Sets that were already created are dropped from this core, objects that received them keep
+	 * old sets. Nothing is dropped when @p set_members are the same as current ones.
+	 */
+	void configure_sets(std::vector<implemented_by> set_members);
+
+	/**
+	 * @brief Replace object of type configured with ready object.
+	 * @param ready_implementation new object with type it replaces
+	 * @throw unknown_type if ready_implementation.interface_type() is not configured as ready object in this core
+	 * @see injector::replace_ready_object(const type &, QObject *)
+	 *
+	 * All objects that were injected with previous object are injected with new one. These are found in
+	 * index of reverse dependencies, so only their setters are called. No other objects are created or
+	 * injected and INJEQT_INIT methods are not called again.
+	 *
+	 * Objects of sub cores are not changed - caller must call rebind_ready_object(QObject *, QObject *)
+	 * on each of them with returned object.
+	 *
+	 * @return previous object or nullptr if @p ready_implementation was already used
+	 */
+	QObject * replace_ready_object(const implementation &ready_implementation);
+
+	/**
+	 * @brief Inject @p new_object into all objects of this core that were injected with @p old_object.
+	 * @pre new_object != nullptr
+	 *
+	 * Used by replace_ready_object(const implementation &) and called on sub cores when ready object of one of
+	 * super cores is replaced. Sets containing @p old_object are created again on next request.
+	 */
+	void rebind_ready_object(QObject *old_object, QObject *new_object);
+
 	/**
 	 * @brief Returns list of all configured types.
 	 *
@@ -106,6 +361,49 @@ public:
 	 */
 	std::vector<type> provided_types() const;
 
+	/**
+	 * @brief Return validation manifest of configuration of this core.
+	 * @see make_validation_manifest(const providers &, const std::vector<type_dependencies> &, const std::vector<type> &)
+	 *
+	 * Dependencies are taken from model(), so meta objects are not analyzed again.
+	 */
+	std::string validation_manifest() const;
+
+	/**
+	 * @return list of all known types
+	 */
+	const types_by_name & known_types() const;
+
+	/**
+	 * @return wiring tables built by this core, without ones of super cores
+	 */
+	const wiring_tables & tables() const;
+
+	/**
+	 * @brief Build wiring tables of these of @p for_types that were not built by this core yet.
+	 * @return types whose tables were built
+	 *
+	 * Used to build tables of types of new modules once, before their providers are created with tables().
+	 */
+	std::vector<type> add_wiring_tables(const std::vector<type> &for_types);
+
+	/**
+	 * @brief Drop wiring tables of @p removed_types built by this core.
+	 *
+	 * Used to undo add_wiring_tables(const std::vector<type> &) when types were not configured after all.
+	 */
+	void remove_wiring_tables(const std::vector<type> &removed_types);
+
+	/**
+	 * @return model of own types of this core
+	 */
+	const types_model & model() const;
+
+	/**
+	 * @brief Return list of known types of this core and all super cores, starting with this one.
+	 */
+	std::vector<const types_by_name *> known_types_chain() const;
+
 	/**
 	 * @brief Instantiates object of given type @p interface_type
 	 * @param interface_type type of object to instantiate.
@@ -123,23 +421,164 @@ public:
 	 */
 	void instantiate_all_with_type_role(const std::string &type_role);
 
+	/**
+	 * @brief Start instantiating all objects with given @p type_role in slices from event loop.
+	 * @param type_role type role of objects to instantiate
+	 * @param slice_budget maximum time of one slice
+	 * @param on_finished function called when all objects were instantiated, may be empty
+	 * @see injector::start_warmup_with_type_role(const std::string &, std::chrono::milliseconds, std::function<void()>)
+	 *
+	 * Plan of warmup is computed at once: it contains all types with @p type_role and their dependencies,
+	 * with dependencies first. Types instantiated in the meantime by other requests are skipped. Previous
+	 * warmup, if any, is stopped.
+	 */
+	void start_warmup(const std::string &type_role, std::chrono::milliseconds slice_budget, std::function<void()> on_finished);
+
+	/**
+	 * @return true if warmup was started and is not finished yet
+	 */
+	bool is_warming_up() const;
+
+	/**
+	 * @brief Start recording first use of types for @p duration from now.
+	 * @see injector::start_profile_recording(std::chrono::milliseconds)
+	 */
+	void start_profile_recording(std::chrono::milliseconds duration);
+
+	/**
+	 * @brief Record request of @p interface_type if profile is recording.
+	 * @param interface_type requested type
+	 * @param critical true if caller is blocked by request
+	 */
+	void record_first_use(const type &interface_type, bool critical);
+
+	/**
+	 * @return profile recorded by this core
+	 */
+	const startup_profile & recorded_profile() const;
+
+	/**
+	 * @brief Start warmup of types from profile saved in @p file_name.
+	 * @param file_name name of file with profile
+	 * @param slice_budget maximum time of one slice
+	 * @param on_finished function called when all objects were instantiated, may be empty
+	 * @return false if profile could not be read
+	 * @see injector::start_prewarm_from_profile(const std::string &, std::chrono::milliseconds, std::function<void()>)
+	 *
+	 * Critical types are instantiated first, in order of first use. Types from profile that are no
+	 * longer configured in this core or any of super cores, and scoped and prototype types, are skipped.
+	 */
+	bool start_prewarm_from_profile(const std::string &file_name, std::chrono::milliseconds slice_budget, std::function<void()> on_finished);
+
 	/**
 	 * @brief Returns pointer to object of given type @p interface_type
 	 * @param interface_type type of object to return.
 	 * @throw unknown_type if @p interface_type was not configured in injector
 	 * @throw instantiation_failed if instantiation of one of required types failed
+	 * @throw no_active_scope if @p interface_type is scoped and there is no active scope
 	 * @pre !interface_type.is_empty()
 	 * @pre !interface_type.is_qobject()
 	 * @see injector::get<T>()
 	 */
 	QObject * get(const type &interface_type);
 
+	/**
+	 * @brief Returns pointer to object of given type @p interface_type or nullptr if it is not configured.
+	 * @param interface_type type of object to return.
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 * @throw no_active_scope if @p interface_type is scoped and there is no active scope
+	 * @pre !interface_type.is_empty()
+	 * @pre !interface_type.is_qobject()
+	 *
+	 * Unlike get(const type &) this method does not throw and does not build any strings when @p interface_type
+	 * is not configured in injector.
+	 */
+	QObject * try_get(const type &interface_type);
+
+	/**
+	 * @brief Instantiates object of given type @p interface_type if it is configured.
+	 * @return false if @p interface_type is not configured in injector
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 * @pre !interface_type.is_empty()
+	 * @pre !interface_type.is_qobject()
+	 */
+	bool try_instantiate(const type &interface_type);
+
+	/**
+	 * @brief Returns pointers to objects of given @p interface_types in the same order.
+	 * @param interface_types types of objects to return
+	 * @throw unknown_type if any of @p interface_types was not configured in injector
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 * @throw no_active_scope if any of @p interface_types is scoped and there is no active scope
+	 * @pre all of interface_types are not empty and are not QObject
+	 * @see injector::get_all(const std::vector<type> &)
+	 *
+	 * Types required by all of @p interface_types are computed once and instantiated together with
+	 * one instantiate_all(const types &) call, so all their INJEQT_INIT methods are called in one batch
+	 * after all setters were called.
+	 */
+	std::vector<QObject *> get_all(const std::vector<type> &interface_types);
+
 	/**
 	 * @brief Returns all objects with given @p type_role.
 	 * @throw instantiation_failed if instantiation of one of found types failed
 	 */
 	std::vector<QObject *> get_all_with_type_role(const std::string &type_role);
 
+	/**
+	 * @brief Request object of given type @p interface_type without blocking.
+	 * @param interface_type type of object to return
+	 * @param on_ready called with object or with nullptr if instantiation failed or was canceled
+	 * @throw unknown_type if @p interface_type was not configured in injector
+	 * @pre !interface_type.is_empty()
+	 * @pre !interface_type.is_qobject()
+	 * @see injector::get_async<T>()
+	 *
+	 * If object is already available @p on_ready is called immediately. Otherwise default constructors
+	 * of @p interface_type and all its not yet created dependencies are invoked on worker threads and
+	 * @p on_ready is called later from event loop of current thread, after all setters and INJEQT_INIT
+	 * methods were called on this thread. Scoped and prototype types are always created immediately.
+	 */
+	void get_async(const type &interface_type, std::function<void(QObject *)> on_ready);
+
+	/**
+	 * @brief Returns lazy handle to object of given type @p interface_type
+	 * @param interface_type type of object to return handle to.
+	 * @throw unknown_type if @p interface_type was not configured in injector
+	 * @pre !interface_type.is_empty()
+	 * @pre !interface_type.is_qobject()
+	 * @see injector::get_lazy<T>()
+	 *
+	 * No object is created by this method. Handle calls get(const type &) on first access, so it must
+	 * not be used after this core is destroyed.
+	 */
+	lazy_handle get_lazy(const type &interface_type);
+
+	/**
+	 * @brief Returns set of objects of given type @p set_type.
+	 * @param set_type type of set to return
+	 * @throw instantiation_failed if instantiation of one of members failed
+	 * @pre !set_type.is_empty()
+	 * @pre !set_type.is_qobject()
+	 * @see injector::get_set<S>()
+	 *
+	 * Set is created on first call and is stored, so later calls and all injections return the same list.
+	 * Set starts with members of sets of super cores. Set with no members is empty.
+	 */
+	object_set get_set(const type &set_type);
+
+	/**
+	 * @brief Release prototype @p object.
+	 * @param object prototype object created by this core or one of super cores
+	 * @throw invalid_qobject if @p object was not created as prototype by this core nor any of super cores
+	 * @pre object != nullptr
+	 * @see injector::release(QObject *)
+	 *
+	 * All INJEQT_RESET methods are called on @p object and it is returned to pool of its provider. If pool
+	 * is full INJEQT_DONE methods are called and @p object is destroyed.
+	 */
+	void release(QObject *object);
+
 	/**
 	 * @brief Inject dependencies into @p object.
 	 * @param object object to inject dependencies into.
@@ -156,25 +595,302 @@ public:
 	 */
 	void inject_into(QObject *object);
 
+	/**
+	 * @brief Prepare injection of dependencies into objects of type @p object_type.
+	 * @param object_type type of objects to inject into
+	 * @throw invalid_setter if any tagged setter of @p object_type is not valid (the same as in inject_into(QObject *))
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 * @pre !object_type.is_empty()
+	 * @pre !object_type.is_qobject()
+	 * @see injector::make_assisted_factory<T, Args...>()
+	 *
+	 * Dependencies of @p object_type are extracted once and all shared types required to satisfy them are
+	 * instantiated. Setters of shared, lazy, set and named dependencies are bound to resolved values, so
+	 * returned injection only calls them. Scoped and prototype dependencies are resolved on each injection.
+	 * Returned injection must not be used after this core is destroyed.
+	 */
+	assisted_injection make_assisted_injection(const type &object_type);
+
 private:
+	std::vector<injector_core *> _super_cores;
+	std::map<type, injector_core *> _super_owners;
 	types_by_name _known_types;
 	providers _available_providers;
 	implementations _objects;
 	implementations _resolved_objects;
 	types_model _types_model;
+	types _scoped_types;
+	std::vector<scope> _scopes;
+	types _prototype_types;
+	std::map<QObject *, std::unique_ptr<QObject>> _prototype_objects;
+	std::shared_ptr<std::recursive_mutex> _lazy_mutex;
+	std::vector<std::unique_ptr<async_construction>> _async_constructions;
+	std::unique_ptr<incremental_warmup> _warmup;
+	startup_profile _startup_profile;
+	reverse_dependencies _reverse_dependencies;
+	std::vector<implemented_by> _set_members;
+	std::map<type, object_set> _sets;
+	// tables are only a cache, so these can be built in const methods too
+	mutable wiring_tables _wiring_tables;
+
+	/**
+	 * @brief Map of qualified setters, identified by enclosing meta object and method index, to ids of named bindings.
+	 */
+	using named_id_map = std::map<std::pair<const QMetaObject *, int>, int>;
+
+	named_bindings _named_bindings;
+	named_id_map _named_ids;
+
+	/**
+	 * @brief Return interfaces of all provided types that require resolving.
+	 */
+	std::vector<type> dependent_types() const;
 
 	/**
 	 * @brief Extract all provided types and makes a types_model from them.
+	 * @param all_dependencies dependencies of dependent_types()
+	 * @param validate false if configuration was already validated
 	 * @throw ambiguous_types if one or more types in @p all_providers is ambiguous
 	 * @throw unresolvable_dependencies if a type with unresolvable dependency is found in @p all_providers
+	 */
+	types_model create_types_model(const std::vector<type_dependencies> &all_dependencies, bool validate) const;
+
+	/**
+	 * @brief Return validation manifest of configuration of this core with @p all_dependencies.
+	 * @param all_dependencies dependencies of dependent_types()
+	 */
+	std::string validation_manifest(const std::vector<type_dependencies> &all_dependencies) const;
+
+	/**
+	 * @brief Check if all types required by providers are available and do not require each other in cycle.
+	 * @throw unavailable_required_types if any required type is not available
+	 * @throw invalid_dependency if types of own providers require each other in cycle
+	 */
+	void validate_required_types() const;
+
+	/**
+	 * @brief Return @p removed_types ordered with dependencies first.
+	 * @pre all @p removed_types are provided by this core
+	 *
+	 * Both setter dependencies and types required by providers are taken into account. Cycles are broken
+	 * at arbitrary point.
+	 */
+	std::vector<type> teardown_order(const types &removed_types) const;
+
+	/**
+	 * @brief Call set setters of @p set_types on all objects injected by this core with current sets.
+	 *
+	 * Used when objects were removed from sets, so objects left do not keep pointers to them.
+	 */
+	void inject_sets_again(const types &set_types);
+
+	/**
+	 * @brief Start recording setter calls with objects of ready providers of this core and all super cores.
+	 */
+	void track_ready_objects();
+
+	/**
+	 * @brief Check if super cores do not provide the same types.
+	 * @throw ambiguous_types if one type is provided by more than one super core
+	 */
+	void validate_super_cores() const;
+
+	/**
+	 * @brief Find owners of all types from super cores that are used by own types and providers.
+	 */
+	void find_super_owners();
+
+	/**
+	 * @brief Return super core that owns @p interface_type.
+	 *
+	 * Owner is a core that has @p interface_type available in own types model. It can be any number of
+	 * levels up in hierarchy. Result is cached. Returns nullptr if @p interface_type is available in this core
+	 * or is not available at all.
+	 */
+	injector_core * super_owner_for(const type &interface_type);
+
+	/**
+	 * @brief Return this core or one of super cores (on any level) that uses @p model.
+	 */
+	injector_core * core_with_model(const types_model *model);
+
+	/**
+	 * @brief Return all interface types from own types model that are implemented by types of providers
+	 * for which @p predicate returns true.
+	 */
+	types find_types_with(bool (provider::*predicate)() const) const;
+
+	/**
+	 * @brief Filter list of types from @p to_filter to include only types that are neither scoped nor prototypes.
+	 */
+	types shared_types(const types &to_filter) const;
+
+	/**
+	 * @brief Check if @p interface_type is implemented by scoped type in this core or in its owner.
+	 */
+	bool is_scoped(const type &interface_type);
+
+	/**
+	 * @brief Check if @p interface_type is implemented by prototype type in this core or in its owner.
+	 */
+	bool is_prototype(const type &interface_type);
+
+	/**
+	 * @brief Check if types that are not scoped do not depend on scoped types.
+	 * @throw dependency_on_scoped_type if type that is not scoped depends on scoped type
+	 */
+	void validate_scoped_dependencies();
+
+	/**
+	 * @brief Return object of scoped type @p interface_type from innermost scope.
+	 * @throw no_active_scope if there is no active scope
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 *
+	 * If object is not yet available in innermost scope, it is created there.
+	 */
+	QObject * get_scoped(const type &interface_type);
+
+	/**
+	 * @brief Create object of scoped @p implementation_type in @p in_scope.
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 *
+	 * All scoped types that are required by @p implementation_type and are not yet available in
+	 * @p in_scope are created as well. Objects of types that are not scoped are taken from get(const type &).
+	 */
+	void instantiate_scoped(const type &implementation_type, scope &in_scope);
+
+	/**
+	 * @brief Return list of pairs of type and name of configured named bindings, without providers.
+	 *
+	 * Passing it back to prepare_named_bindings(std::vector<named_binding>) keeps all bindings as they are.
+	 */
+	std::vector<named_binding> current_named_bindings() const;
+
+	/**
+	 * @brief Create named_bindings from @p named and fill dependencies of all its bindings.
+	 * @throw ambiguous_types if the same pair of type and name is used more than once in @p named
+	 * @throw invalid_setter if any tagged setter of named type is not valid
+	 * @pre all bindings without provider are already configured
+	 */
+	named_bindings prepare_named_bindings(std::vector<named_binding> named) const;
+
+	/**
+	 * @brief Map qualified setters of types from @p model and of @p bindings to ids of @p bindings.
+	 * @throw unresolvable_dependencies if qualified setter requires binding that is not in @p bindings
+	 * @throw unresolvable_dependencies if object of binding depends on type that is not available in @p model
+	 */
+	named_id_map map_named_dependencies(const named_bindings &bindings, const types_model &model) const;
+
+	/**
+	 * @brief Replace named bindings with @p bindings and map of qualified setters with @p named_ids.
+	 *
+	 * Providers and objects of bindings already configured are moved to @p bindings. Objects of other
+	 * bindings are torn down.
+	 */
+	void apply_named_bindings(named_bindings bindings, named_id_map named_ids);
+
+	/**
+	 * @brief Return id of named binding required by qualified @p setter.
+	 * @throw unknown_type if there is no binding with type and name required by @p setter
+	 *
+	 * Setters that were not mapped in advance (of objects passed to inject_into(QObject *)) are
+	 * mapped on first use.
+	 */
+	int named_id_for(const setter_method &setter);
+
+	/**
+	 * @brief Return object of named binding with @p id, creating and injecting it if needed.
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 */
+	QObject * get_named(int id);
+
+	/**
+	 * @brief Call setter of dependency @p d on @p object with object or lazy handle of required type.
+	 */
+	void inject_dependency(QObject *object, const dependency &d);
+
+	/**
+	 * @brief Check if prototype types do not depend on each other in cycle.
+	 * @throw invalid_dependency if cycle of prototype types is found
+	 */
+	void validate_prototype_dependencies() const;
+
+	/**
+	 * @brief Return new object of prototype type @p interface_type.
+	 * @throw instantiation_failed if instantiation of one of required types failed
+	 *
+	 * Object is taken from pool of provider if available. Otherwise new object is created and its
+	 * dependencies are resolved.
+	 */
+	QObject * get_prototype(const type &interface_type);
+
+	/**
+	 * @brief Release prototype @p object if it was created by this core or one of super cores.
+	 * @return false if @p object was not created by this core nor any of super cores
+	 */
+	bool try_release(QObject *object);
+
+	/**
+	 * @brief Start warmup of types from @p plan, stopping previous one.
+	 */
+	void start_warmup(std::vector<type> plan, std::chrono::milliseconds slice_budget, std::function<void()> on_finished);
+
+	/**
+	 * @brief Return list of types from @p profile that can be instantiated, critical first.
+	 */
+	std::vector<type> prewarm_plan(const startup_profile &profile);
+
+	/**
+	 * @brief Return list of all types with @p type_role and their dependencies, with dependencies first.
+	 *
+	 * Scoped, prototype and lazily injected types are not included.
+	 */
+	std::vector<type> warmup_plan(const std::string &type_role);
+
+	/**
+	 * @brief Return known types extended with types of super cores that are used by @p for_type.
+	 * @param merged_known_types storage for extended list, used only when @p for_type refers to types of super cores
+	 *
+	 * Known types of this core are returned without copying when there are no super cores or when @p for_type
+	 * does not use any of their types.
+	 */
+	const types_by_name & known_types_for(const type &for_type, types_by_name &merged_known_types) const;
+
+	/**
+	 * @brief Return @p own_known_types extended with types of super cores that are used by @p for_type.
+	 * @see known_types_for(const type &, types_by_name &)
+	 */
+	const types_by_name & known_types_for(const types_by_name &own_known_types, const type &for_type, types_by_name &merged_known_types) const;
+
+	/**
+	 * @return wiring table of @p for_type built by this core or by one of super cores, nullptr if there is none yet
+	 */
+	const wiring_table * find_wiring_table(const type &for_type) const;
+
+	/**
+	 * @return wiring table of @p for_type built by this core or by one of super cores, built in this core on first call
+	 * @pre !for_type.is_empty()
+	 */
+	const wiring_table & wiring_table_of(const type &for_type) const;
+
+	/**
+	 * @brief Build wiring tables of these of @p for_types that are not available in this core nor in super cores.
+	 * @return types whose tables were built
+	 */
+	std::vector<type> add_missing_wiring_tables(const std::vector<type> &for_types) const;
+
+	/**
+	 * @brief Extract dependencies of @p need_dependencies from their wiring tables.
+	 * @param known_types list of all known types of this core
+	 * @param need_dependencies types to extract dependencies of
 	 * @throw dependency_on_self when type depends on self
 	 * @throw dependency_on_subtype when type depends on own supertype
 	 * @throw dependency_on_subtype when type depends on own subtype
-	 * @throw invalid_setter if any tagged setter has parameter that is not a QObject-derived pointer
-	 * @throw invalid_setter if any tagged setter has parameter that is a QObject pointer
-	 * @throw invalid_setter if any tagged setter has other number of parameters than one
+	 * @throw invalid_setter if any tagged setter has invalid parameter or parameters count
+	 *
+	 * Missing tables are built first, then all types are analyzed on analysis threads.
 	 */
-	types_model create_types_model() const;
+	std::vector<type_dependencies> extract_all_dependencies(const types_by_name &known_types, const std::vector<type> &need_dependencies) const;
 
 	/**
 	 * @brief Return type that implements @p interface_type.
@@ -288,15 +1004,29 @@ private:
 	 *
 	 * This method assumes that all object dependencies are already instantiated.
 	 */
-	void resolve_object(const implementation &object) const;
+	void resolve_object(const implementation &object);
 
 	/**
 	 * @brief Resolve all @p object dependencies with @p object_dependencies.
 	 */
-	void resolve_object(const dependencies &object_dependencies, const implementation &object) const;
+	void resolve_object(const dependencies &object_dependencies, const implementation &object);
+
+	/**
+	 * @brief Call provider::provide(injector_core &) on @p p surrounded by provide_start and provide_end probes.
+	 * @see probes.h
+	 */
+	QObject * invoke_provider(provider &p);
+
+	/**
+	 * @return thread of provider of @p object if it is configured with module::add_thread_affine_type<T>(QThread *),
+	 * nullptr otherwise
+	 */
+	QThread * affine_thread_of(QObject *object) const;
 
 	/**
 	 * @brief Call all INJEQT_INIT methods on given object in proper order.
+	 *
+	 * Methods of objects of thread-affine types are called on their thread, other ones on current thread.
 	 */
 	void call_init_methods(QObject *object) const;
 
@@ -20,13 +20,15 @@
 
 #include "injector-impl.h"
 
+#include <injeqt/exception/unavailable-required-types.h>
 #include <injeqt/exception/unknown-type.h>
 #include <injeqt/module.h>
 
+#include "analysis-threads.h"
 #include "containers.h"
 #include "interfaces-utils.h"
+#include "probes.h"
 #include "provider-by-default-constructor.h"
-#include "provider-by-parent-injector-configuration.h"
 #include "provider-ready.h"
 #include "provider.h"
 #include "module-impl.h"
@@ -34,55 +36,305 @@
 #include "resolve-dependencies.h"
 #include "resolved-dependency.h"
 
+#include <algorithm>
 #include <cassert>
 
 namespace injeqt { namespace internal {
 
+namespace {
+
+std::vector<type> own_types_of(const std::vector<std::shared_ptr<provider_configuration>> &provider_configurations,
+	const std::vector<implemented_by> &set_members, const std::vector<named_provider_configuration> &named_configurations)
+{
+	auto extract_types_lamdba = [](const std::shared_ptr<provider_configuration> &pc){
+		auto result = std::vector<type>{};
+		for (auto &&t : pc->types())
+		{
+			auto interfaces = extract_interfaces(t);
+			std::copy(std::begin(interfaces), std::end(interfaces), std::back_inserter(result));
+		}
+		return result;
+	};
+	auto extract_types = std::function<std::vector<type>(const std::shared_ptr<provider_configuration> &)>{extract_types_lamdba};
+	auto result = extract(provider_configurations, extract_types);
+	// set types are known even without configured implementations, so setters can accept them
+	for (auto &&set_member : set_members)
+		result.push_back(set_member.interface_type());
+	for (auto &&named_configuration : named_configurations)
+	{
+		auto named_types = extract_types(named_configuration.configuration);
+		std::copy(std::begin(named_types), std::end(named_types), std::back_inserter(result));
+	}
+	return result;
+}
+
+void validate_set_members(const std::vector<implemented_by> &set_members,
+	const std::vector<std::shared_ptr<provider_configuration>> &provider_configurations)
+{
+	auto configured_types = std::vector<type>{};
+	for (auto &&pc : provider_configurations)
+		for (auto &&t : pc->types())
+			configured_types.push_back(t);
+	auto configured = types{configured_types};
+
+	auto message = std::string{};
+	for (auto &&set_member : set_members)
+		if (!configured.contains_key(set_member.implementation_type()))
+			message.append(set_member.implementation_type().c_name()).append(" in ").append(set_member.interface_type().c_name()).append("\n");
+	if (!message.empty())
+		throw exception::unavailable_required_types{message};
+}
+
+types_by_name make_known_types(const std::vector<type> &own_types, const std::vector<const types_by_name *> &super_known_types)
+{
+	// super injectors are not copied, only types that are used by own types are added to known ones
+	auto result = types_by_name{own_types};
+	result.merge(types_by_name{referenced_types(own_types, result, super_known_types)});
+	return result;
+}
+
+std::vector<type> configured_types_of(const std::vector<std::shared_ptr<provider_configuration>> &provider_configurations,
+	const std::vector<named_provider_configuration> &named_configurations)
+{
+	auto result = std::vector<type>{};
+	for (auto &&pc : provider_configurations)
+		for (auto &&t : pc->types())
+			result.push_back(t);
+	for (auto &&named_configuration : named_configurations)
+		for (auto &&t : named_configuration.configuration->types())
+			result.push_back(t);
+	return result;
+}
+
+std::vector<std::unique_ptr<provider>> create_providers(const std::vector<std::shared_ptr<provider_configuration>> &provider_configurations,
+	const types_by_name &known_types, const wiring_tables &tables)
+{
+	auto create_provider_lambda = [&known_types, &tables](const std::shared_ptr<provider_configuration> &pc){ return pc->create_provider(known_types, tables); };
+	auto create_provider = std::function<std::unique_ptr<provider>(const std::shared_ptr<provider_configuration> &)>{create_provider_lambda};
+	return parallel_transform(provider_configurations, create_provider, analysis_thread_count());
+}
+
+std::vector<named_binding> create_named_bindings(const std::vector<named_provider_configuration> &named_configurations,
+	const types_by_name &known_types, const wiring_tables &tables)
+{
+	auto result = std::vector<named_binding>{};
+	result.reserve(named_configurations.size());
+	for (auto &&named_configuration : named_configurations)
+		result.emplace_back(named_configuration.binding_type, named_configuration.name, named_configuration.configuration->create_provider(known_types, tables));
+	return result;
+}
+
+}
+
 injector_impl::injector_impl()
 {
 }
 
+injector_impl::~injector_impl()
+{
+	for (auto &&super_injector : _super_injectors)
+	{
+		auto &subs = super_injector->_sub_injectors;
+		subs.erase(std::remove(std::begin(subs), std::end(subs), this), std::end(subs));
+	}
+}
+
 injector_impl::injector_impl(std::vector<std::unique_ptr<module>> modules) :
 	// modules are only stored because these can own objects used by injector
 	_modules{std::move(modules)}
 {
-	init(std::vector<injector_impl *>{});
+	init(std::vector<injector_impl *>{}, std::string{});
 }
 
 injector_impl::injector_impl(std::vector<injector_impl *> super_injectors, std::vector<std::unique_ptr<module>> modules) :
 	// modules are only stored because these can own objects used by injector
 	_modules{std::move(modules)}
 {
-	init(super_injectors);
+	init(super_injectors, std::string{});
 }
 
-void injector_impl::init(std::vector<injector_impl *> super_injectors)
+injector_impl::injector_impl(std::vector<injector_impl *> super_injectors, std::vector<std::unique_ptr<module>> modules,
+		const std::string &validation_manifest) :
+	// modules are only stored because these can own objects used by injector
+	_modules{std::move(modules)}
 {
+	init(super_injectors, validation_manifest);
+}
+
+void injector_impl::init(std::vector<injector_impl *> super_injectors, const std::string &validation_manifest)
+{
+	INJEQT_PROBE0(init_start);
+
 	auto extract_provider_configurations_lambda = [](const std::unique_ptr<module> &m){ return m->_pimpl->provider_configurations(); };
 	auto extract_provider_configurations = std::function<std::vector<std::shared_ptr<provider_configuration>>(const std::unique_ptr<module> &)>{extract_provider_configurations_lambda};
 	auto provider_configurations = extract(_modules, extract_provider_configurations);
 
+	auto super_cores = std::vector<injector_core *>{};
+	auto super_known_types = std::vector<const types_by_name *>{};
 	for (auto &&super_injector : super_injectors)
-		for (auto &&provided_type : super_injector->provided_types())
-			provider_configurations.push_back(std::make_shared<provider_by_parent_injector_configuration>(super_injector, provided_type));
+	{
+		super_cores.push_back(&super_injector->_core);
+		auto super_chain = super_injector->_core.known_types_chain();
+		std::copy(std::begin(super_chain), std::end(super_chain), std::back_inserter(super_known_types));
+	}
+	auto set_members = this->set_members(nullptr);
+	validate_set_members(set_members, provider_configurations);
+	auto named_configurations = named_provider_configurations(nullptr);
+	INJEQT_PROBE1(init_phase, "configurations");
+	auto known_types = make_known_types(own_types_of(provider_configurations, set_members, named_configurations), super_known_types);
+	INJEQT_PROBE1(init_phase, "known_types");
 
-	auto extract_types_lamdba = [](const std::shared_ptr<provider_configuration> &pc){
-		auto result = std::vector<type>{};
+	// meta object of each configured type is scanned once, tables are used by providers and then by core
+	auto tables = wiring_tables{configured_types_of(provider_configurations, named_configurations)};
+	INJEQT_PROBE1(init_phase, "wiring_tables");
+
+	auto providers = create_providers(provider_configurations, known_types, tables);
+	INJEQT_PROBE1(init_phase, "providers");
+
+	_core = injector_core{std::move(super_cores), known_types, std::move(providers), validation_manifest, std::move(tables)};
+	INJEQT_PROBE1(init_phase, "core");
+	_core.configure_sets(std::move(set_members));
+	INJEQT_PROBE1(init_phase, "sets");
+	_core.configure_named_bindings(create_named_bindings(named_configurations, known_types, _core.tables()));
+	INJEQT_PROBE1(init_phase, "named_bindings");
+
+	// registered only when whole construction succeeded, so super injectors never see partially created ones
+	_super_injectors = std::move(super_injectors);
+	for (auto &&super_injector : _super_injectors)
+		super_injector->_sub_injectors.push_back(this);
+
+	INJEQT_PROBE0(init_end);
+}
+
+std::vector<implemented_by> injector_impl::set_members(const module *skipped_module) const
+{
+	auto result = std::vector<implemented_by>{};
+	for (auto &&m : _modules)
+		if (m.get() != skipped_module)
+		{
+			auto &module_set_members = m->_pimpl->set_members();
+			std::copy(std::begin(module_set_members), std::end(module_set_members), std::back_inserter(result));
+		}
+	return result;
+}
+
+std::vector<named_provider_configuration> injector_impl::named_provider_configurations(const module *skipped_module) const
+{
+	auto result = std::vector<named_provider_configuration>{};
+	for (auto &&m : _modules)
+		if (m.get() != skipped_module)
+		{
+			auto &module_configurations = m->_pimpl->named_provider_configurations();
+			std::copy(std::begin(module_configurations), std::end(module_configurations), std::back_inserter(result));
+		}
+	return result;
+}
+
+void injector_impl::add_module(std::unique_ptr<module> added_module)
+{
+	assert(added_module);
+
+	auto provider_configurations = added_module->_pimpl->provider_configurations();
+	auto set_members = this->set_members(nullptr);
+	auto &added_set_members = added_module->_pimpl->set_members();
+	std::copy(std::begin(added_set_members), std::end(added_set_members), std::back_inserter(set_members));
+
+	auto all_provider_configurations = provider_configurations;
+	for (auto &&m : _modules)
+	{
+		auto module_configurations = m->_pimpl->provider_configurations();
+		std::copy(std::begin(module_configurations), std::end(module_configurations), std::back_inserter(all_provider_configurations));
+	}
+	validate_set_members(set_members, all_provider_configurations);
+
+	auto named_configurations = named_provider_configurations(nullptr);
+	auto &added_named_configurations = added_module->_pimpl->named_provider_configurations();
+	std::copy(std::begin(added_named_configurations), std::end(added_named_configurations), std::back_inserter(named_configurations));
+
+	auto own_types = own_types_of(provider_configurations, added_set_members, added_named_configurations);
+	auto known_types = _core.known_types();
+	known_types.merge(types_by_name{own_types});
+
+	auto known_types_chain = _core.known_types_chain();
+	auto super_known_types = std::vector<const types_by_name *>{std::begin(known_types_chain) + 1, std::end(known_types_chain)};
+	known_types.merge(types_by_name{referenced_types(own_types, known_types, super_known_types)});
+
+	auto added_tables = _core.add_wiring_tables(configured_types_of(provider_configurations, named_configurations));
+	try
+	{
+		_core.add_providers(known_types, create_providers(provider_configurations, known_types, _core.tables()),
+			create_named_bindings(named_configurations, known_types, _core.tables()));
+	}
+	catch (...)
+	{
+		// meta objects of module that was not added can be unloaded with it
+		_core.remove_wiring_tables(added_tables);
+		throw;
+	}
+	_core.configure_sets(std::move(set_members));
+	// module is only stored because it can own objects used by injector
+	_modules.push_back(std::move(added_module));
+}
+
+void injector_impl::remove_module(module *removed_module)
+{
+	assert(removed_module);
+
+	auto module_it = std::find_if(std::begin(_modules), std::end(_modules),
+		[removed_module](const std::unique_ptr<module> &m){ return m.get() == removed_module; });
+	assert(module_it != std::end(_modules));
+	if (module_it == std::end(_modules))
+		return;
+
+	auto removed_types = std::vector<type>{};
+	for (auto &&pc : removed_module->_pimpl->provider_configurations())
 		for (auto &&t : pc->types())
+			removed_types.push_back(t);
+
+	auto provider_configurations = std::vector<std::shared_ptr<provider_configuration>>{};
+	for (auto &&m : _modules)
+		if (m.get() != removed_module)
 		{
-			auto interfaces = extract_interfaces(t);
-			std::copy(std::begin(interfaces), std::end(interfaces), std::back_inserter(result));
+			auto module_configurations = m->_pimpl->provider_configurations();
+			std::copy(std::begin(module_configurations), std::end(module_configurations), std::back_inserter(provider_configurations));
 		}
-		return result;
-	};
-	auto extract_types = std::function<std::vector<type>(const std::shared_ptr<provider_configuration> &)>{extract_types_lamdba};
-	auto known_types = types_by_name{extract(provider_configurations, extract_types)};
 
-	auto create_provider_lambda = [&known_types](const std::shared_ptr<provider_configuration> &pc){ return pc->create_provider(known_types); };
-	auto create_provider = std::function<std::unique_ptr<provider>(std::shared_ptr<provider_configuration>)>{create_provider_lambda};
-	auto providers = transform(provider_configurations, create_provider);
+	auto set_members = this->set_members(removed_module);
+	validate_set_members(set_members, provider_configurations);
+	auto named_configurations = named_provider_configurations(removed_module);
+
+	// known types of removed module are dropped, as its meta objects may be unloaded with it
+	auto known_types_chain = _core.known_types_chain();
+	auto super_known_types = std::vector<const types_by_name *>{std::begin(known_types_chain) + 1, std::end(known_types_chain)};
+	auto known_types = make_known_types(own_types_of(provider_configurations, set_members, named_configurations), super_known_types);
+
+	// tables of types shared with removed module could be dropped with it before
+	_core.add_wiring_tables(configured_types_of(std::vector<std::shared_ptr<provider_configuration>>{}, named_configurations));
+	_core.remove_providers(known_types, removed_types, create_named_bindings(named_configurations, known_types, _core.tables()));
+	_core.configure_sets(std::move(set_members));
+	// module is destroyed after providers, as it can own objects used by them
+	_modules.erase(module_it);
+}
+
+void injector_impl::replace_ready_object(const implementation &ready_implementation)
+{
+	auto old_object = _core.replace_ready_object(ready_implementation);
+	if (old_object)
+		rebind_in_sub_injectors(old_object, ready_implementation.object());
+}
 
-	_core = injector_core{known_types, std::move(providers)};
+void injector_impl::rebind_in_sub_injectors(QObject *old_object, QObject *new_object)
+{
+	for (auto &&sub_injector : _sub_injectors)
+	{
+		sub_injector->_core.rebind_ready_object(old_object, new_object);
+		sub_injector->rebind_in_sub_injectors(old_object, new_object);
+	}
+}
+
+std::string injector_impl::validation_manifest() const
+{
+	return _core.validation_manifest();
 }
 
 std::vector<type> injector_impl::provided_types() const
@@ -95,6 +347,7 @@ void injector_impl::instantiate(const type &interface_type)
 	assert(!interface_type.is_empty());
 	assert(!interface_type.is_qobject());
 
+	_core.record_first_use(interface_type, true);
 	_core.instantiate(interface_type);
 }
 
@@ -108,9 +361,89 @@ QObject * injector_impl::get(const type &interface_type)
 	assert(!interface_type.is_empty());
 	assert(!interface_type.is_qobject());
 
+	_core.record_first_use(interface_type, true);
 	return _core.get(interface_type);
 }
 
+QObject * injector_impl::try_get(const type &interface_type)
+{
+	assert(!interface_type.is_empty());
+	assert(!interface_type.is_qobject());
+
+	auto result = _core.try_get(interface_type);
+	if (result)
+		_core.record_first_use(interface_type, true);
+	return result;
+}
+
+bool injector_impl::try_instantiate(const type &interface_type)
+{
+	assert(!interface_type.is_empty());
+	assert(!interface_type.is_qobject());
+
+	auto result = _core.try_instantiate(interface_type);
+	if (result)
+		_core.record_first_use(interface_type, true);
+	return result;
+}
+
+void injector_impl::start_warmup_with_type_role(const std::string &type_role, std::chrono::milliseconds slice_budget, std::function<void()> on_finished)
+{
+	_core.start_warmup(type_role, slice_budget, std::move(on_finished));
+}
+
+bool injector_impl::is_warming_up() const
+{
+	return _core.is_warming_up();
+}
+
+void injector_impl::start_profile_recording(std::chrono::milliseconds duration)
+{
+	_core.start_profile_recording(duration);
+}
+
+bool injector_impl::save_profile(const std::string &file_name) const
+{
+	return _core.recorded_profile().save(file_name);
+}
+
+bool injector_impl::start_prewarm_from_profile(const std::string &file_name, std::chrono::milliseconds slice_budget, std::function<void()> on_finished)
+{
+	return _core.start_prewarm_from_profile(file_name, slice_budget, std::move(on_finished));
+}
+
+void injector_impl::get_async(const type &interface_type, std::function<void(QObject *)> on_ready)
+{
+	assert(!interface_type.is_empty());
+	assert(!interface_type.is_qobject());
+
+	_core.record_first_use(interface_type, false);
+	_core.get_async(interface_type, std::move(on_ready));
+}
+
+lazy_handle injector_impl::get_lazy(const type &interface_type)
+{
+	assert(!interface_type.is_empty());
+	assert(!interface_type.is_qobject());
+
+	return _core.get_lazy(interface_type);
+}
+
+object_set injector_impl::get_set(const type &set_type)
+{
+	assert(!set_type.is_empty());
+	assert(!set_type.is_qobject());
+
+	return _core.get_set(set_type);
+}
+
+std::vector<QObject *> injector_impl::get_all(const std::vector<type> &interface_types)
+{
+	for (auto &&interface_type : interface_types)
+		_core.record_first_use(interface_type, true);
+	return _core.get_all(interface_types);
+}
+
 std::vector<QObject *> injector_impl::get_all_with_type_role(const std::string &type_role)
 {
 	return _core.get_all_with_type_role(type_role);
@@ -123,4 +456,34 @@ void injector_impl::inject_into(QObject *object)
 	_core.inject_into(object);
 }
 
+assisted_injection injector_impl::make_assisted_injection(const type &object_type)
+{
+	assert(!object_type.is_empty());
+	assert(!object_type.is_qobject());
+
+	return _core.make_assisted_injection(object_type);
+}
+
+void injector_impl::enter_scope()
+{
+	_core.enter_scope();
+}
+
+void injector_impl::leave_scope()
+{
+	_core.leave_scope();
+}
+
+void injector_impl::release(QObject *object)
+{
+	assert(object);
+
+	_core.release(object);
+}
+
+const injector_core & injector_impl::core() const
+{
+	return _core;
+}
+
 }}
@@ -25,6 +25,7 @@
 
 #include "implementations.h"
 #include "injector-core.h"
+#include "module-impl.h"
 #include "providers.h"
 #include "types-by-name.h"
 
@@ -62,6 +63,11 @@ public:
 	 */
 	injector_impl();
 
+	/**
+	 * @brief Destroy injector_impl and unregister it from its super injectors.
+	 */
+	~injector_impl();
+
 	/**
 	 * @brief Create injector configured with set of modules.
 	 * @param modules set of modules containing configuration of injector
@@ -97,10 +103,41 @@ public:
 	 * @throw invalid_setter if any tagged setter has other number of parameters than one
 	 *
 	 * This constructor extract all providers from all modules and creates injector_core object
-	 * with these providers.
+	 * with these providers on top of cores of @p super_injectors. Types models and objects of
+	 * @p super_injectors are not copied, so they must outlive created object.
 	 */
 	explicit injector_impl(std::vector<injector_impl *> super_injectors, std::vector<std::unique_ptr<::injeqt::v1::module>> modules);
 
+	/**
+	 * @brief Create injector configured with set of modules, skipping validation if @p validation_manifest matches.
+	 * @see injector::injector(std::vector<injector *>, std::vector<std::unique_ptr<module>>, const std::string &)
+	 */
+	explicit injector_impl(std::vector<injector_impl *> super_injectors, std::vector<std::unique_ptr<::injeqt::v1::module>> modules,
+		const std::string &validation_manifest);
+
+	/**
+	 * @see injector::add_module(std::unique_ptr<module>)
+	 * @pre added_module != nullptr
+	 */
+	void add_module(std::unique_ptr<::injeqt::v1::module> added_module);
+
+	/**
+	 * @see injector::remove_module(module *)
+	 * @pre removed_module != nullptr
+	 * @pre removed_module was passed to this injector
+	 */
+	void remove_module(::injeqt::v1::module *removed_module);
+
+	/**
+	 * @see injector::replace_ready_object(const type &, QObject *)
+	 */
+	void replace_ready_object(const implementation &ready_implementation);
+
+	/**
+	 * @see injector::validation_manifest()
+	 */
+	std::string validation_manifest() const;
+
 	/**
 	 * @brief Returns list of all configured types.
 	 *
@@ -137,12 +174,89 @@ public:
 	 */
 	QObject * get(const type &interface_type);
 
+	/**
+	 * @see injector::try_get<T>()
+	 * @pre !interface_type.is_empty()
+	 * @pre !interface_type.is_qobject()
+	 */
+	QObject * try_get(const type &interface_type);
+
+	/**
+	 * @see injector::try_instantiate<T>()
+	 * @pre !interface_type.is_empty()
+	 * @pre !interface_type.is_qobject()
+	 */
+	bool try_instantiate(const type &interface_type);
+
+	/**
+	 * @see injector::get_all(const std::vector<type> &)
+	 * @pre all of interface_types are not empty and are not QObject
+	 */
+	std::vector<QObject *> get_all(const std::vector<type> &interface_types);
+
 	/**
 	 * @brief Returns all objects with given @p type_role.
 	 * @throw instantiation_failed if instantiation of one of found types failed
 	 */
 	std::vector<QObject *> get_all_with_type_role(const std::string &type_role);
 
+	/**
+	 * @brief Start instantiating all objects with given @p type_role in slices from event loop.
+	 * @see injector::start_warmup_with_type_role(const std::string &, std::chrono::milliseconds, std::function<void()>)
+	 */
+	void start_warmup_with_type_role(const std::string &type_role, std::chrono::milliseconds slice_budget, std::function<void()> on_finished);
+
+	/**
+	 * @return true if warmup was started and is not finished yet
+	 */
+	bool is_warming_up() const;
+
+	/**
+	 * @brief Start recording first use of types.
+	 * @see injector::start_profile_recording(std::chrono::milliseconds)
+	 */
+	void start_profile_recording(std::chrono::milliseconds duration);
+
+	/**
+	 * @brief Save recorded profile to @p file_name.
+	 * @see injector::save_profile(const std::string &)
+	 */
+	bool save_profile(const std::string &file_name) const;
+
+	/**
+	 * @brief Start warmup of types from profile saved in @p file_name.
+	 * @see injector::start_prewarm_from_profile(const std::string &, std::chrono::milliseconds, std::function<void()>)
+	 */
+	bool start_prewarm_from_profile(const std::string &file_name, std::chrono::milliseconds slice_budget, std::function<void()> on_finished);
+
+	/**
+	 * @brief Request object of given type @p interface_type without blocking.
+	 * @param interface_type type of object to return
+	 * @param on_ready called with object or with nullptr if instantiation failed or was canceled
+	 * @throw unknown_type if @p interface_type was not configured in injector
+	 * @pre !interface_type.is_empty()
+	 * @pre !interface_type.is_qobject()
+	 * @see injector::get_async<T>()
+	 */
+	void get_async(const type &interface_type, std::function<void(QObject *)> on_ready);
+
+	/**
+	 * @brief Returns lazy handle to object of given type @p interface_type
+	 * @param interface_type type of object to return handle to.
+	 * @throw unknown_type if @p interface_type was not configured in injector
+	 * @pre !interface_type.is_empty()
+	 * @pre !interface_type.is_qobject()
+	 * @see injector::get_lazy<T>()
+	 */
+	lazy_handle get_lazy(const type &interface_type);
+
+	/**
+	 * @see injector::get_set<S>()
+	 * @pre !set_type.is_empty()
+	 * @pre !set_type.is_qobject()
+	 */
+	object_set get_set(const type &set_type);
+
 	/**
 	 * @brief Inject dependencies into @p object.
 	 * @param object object to inject dependencies into.
@@ -159,11 +273,59 @@ public:
 	 */
 	void inject_into(QObject *object);
 
+	/**
+	 * @see injector::make_assisted_factory<T, Args...>()
+	 */
+	assisted_injection make_assisted_injection(const type &object_type);
+
+	/**
+	 * @brief Start new scope for scoped objects.
+	 * @see injector::enter_scope()
+	 */
+	void enter_scope();
+
+	/**
+	 * @brief End innermost scope and destroy all its objects.
+	 * @throw no_active_scope if there is no active scope
+	 * @see injector::leave_scope()
+	 */
+	void leave_scope();
+
+	/**
+	 * @brief Release prototype object.
+	 * @throw invalid_qobject if @p object is not a prototype object created by this injector
+	 * @see injector::release(QObject *)
+	 */
+	void release(QObject *object);
+
+	/**
+	 * @return core of this injector
+	 */
+	const injector_core & core() const;
+
 private:
 	std::vector<std::unique_ptr<module>> _modules;
 	injector_core _core;
 
-	void init(std::vector<injector_impl *> super_injectors);
+	std::vector<injector_impl *> _super_injectors;
+	std::vector<injector_impl *> _sub_injectors;
+
+	void init(std::vector<injector_impl *> super_injectors, const std::string &validation_manifest);
+
+	/**
+	 * @brief Inject @p new_object instead of @p old_object into objects of all sub injectors, recursively.
+	 */
+	void rebind_in_sub_injectors(QObject *old_object, QObject *new_object);
+
+	/**
+	 * @return memberships of sets from all modules except @p skipped_module, in order of modules
+	 */
+	std::vector<implemented_by> set_members(const module *skipped_module) const;
+
+	/**
+	 * @return configurations of named objects from all modules except @p skipped_module, in order of modules
+	 */
+	std::vector<named_provider_configuration> named_provider_configurations(const module *skipped_module) const;
 
 };
 
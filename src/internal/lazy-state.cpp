@@ -0,0 +1,63 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "lazy-state.h"
+
+#include <cassert>
+
+namespace injeqt { namespace internal {
+
+lazy_state::lazy_state(type object_type, std::shared_ptr<std::recursive_mutex> mutex, std::function<QObject *()> resolve) :
+	_object_type{std::move(object_type)},
+	_mutex{std::move(mutex)},
+	_resolve{std::move(resolve)},
+	_object{nullptr}
+{
+	assert(!_object_type.is_empty());
+	assert(_mutex);
+}
+
+const type & lazy_state::object_type() const
+{
+	return _object_type;
+}
+
+bool lazy_state::is_resolved() const
+{
+	return _object.load(std::memory_order_acquire) != nullptr;
+}
+
+QObject * lazy_state::get()
+{
+	auto result = _object.load(std::memory_order_acquire);
+	if (result)
+		return result;
+
+	std::lock_guard<std::recursive_mutex> lock{*_mutex};
+	result = _object.load(std::memory_order_relaxed);
+	if (!result)
+	{
+		result = _resolve();
+		_object.store(result, std::memory_order_release);
+	}
+	return result;
+}
+
+}}
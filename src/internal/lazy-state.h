@@ -0,0 +1,88 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include "internal.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing state of lazy handles.
+ */
+
+class QObject;
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Shared state of lazy_handle objects.
+ *
+ * Keeps type of object, function that returns object and object itself after it was resolved. Resolving
+ * is done under mutex shared by all lazy states of one injector, so two lazy states never resolve objects
+ * at once. Mutex is not used by other methods of injector_core, so resolving must not run concurrently with
+ * them. Already resolved object is returned without locking.
+ */
+class INJEQT_INTERNAL_API lazy_state final
+{
+
+public:
+	/**
+	 * @brief Create new lazy state.
+	 * @param object_type type of object
+	 * @param mutex mutex used to serialize resolving
+	 * @param resolve function that returns object, called at most once if it does not throw
+	 * @pre !object_type.is_empty()
+	 * @pre mutex != nullptr
+	 */
+	explicit lazy_state(type object_type, std::shared_ptr<std::recursive_mutex> mutex, std::function<QObject *()> resolve);
+
+	lazy_state(const lazy_state &) = delete;
+	lazy_state & operator = (const lazy_state &) = delete;
+
+	const type & object_type() const;
+
+	/**
+	 * @return true if object was already resolved
+	 */
+	bool is_resolved() const;
+
+	/**
+	 * @return object, resolved on first call
+	 * @throw any exception thrown by resolve function, in that case next call will try again
+	 */
+	QObject * get();
+
+private:
+	type _object_type;
+	std::shared_ptr<std::recursive_mutex> _mutex;
+	std::function<QObject *()> _resolve;
+	std::atomic<QObject *> _object;
+
+};
+
+}}
@@ -34,4 +34,24 @@ const std::vector<std::shared_ptr<provider_configuration>> & module_impl::provid
 	return _provider_configurations;
 }
 
+const std::vector<implemented_by> & module_impl::set_members() const
+{
+	return _set_members;
+}
+
+void module_impl::add_set_member(implemented_by member)
+{
+	_set_members.push_back(std::move(member));
+}
+
+const std::vector<named_provider_configuration> & module_impl::named_provider_configurations() const
+{
+	return _named_provider_configurations;
+}
+
+void module_impl::add_named_provider_configuration(named_provider_configuration c)
+{
+	_named_provider_configurations.push_back(std::move(c));
+}
+
 }}
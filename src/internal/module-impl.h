@@ -23,9 +23,12 @@
 #include <injeqt/injeqt.h>
 #include <injeqt/type.h>
 
+#include "implemented-by.h"
 #include "provider-configuration.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * @file
@@ -34,6 +37,17 @@
 
 namespace injeqt { namespace internal {
 
+/**
+ * @brief Configuration of provider of object available under name.
+ * @see module::add_type<T>(const std::string &)
+ */
+struct named_provider_configuration
+{
+	type binding_type;
+	std::string name;
+	std::shared_ptr<provider_configuration> configuration;
+};
+
 /**
  * @brief Implementation of module class.
  * @see module class
@@ -57,8 +71,31 @@ public:
 	 */
 	void add_provider_configuration(std::shared_ptr<provider_configuration> p);
 
+	/**
+	 * @return memberships of sets, with set type as interface type and member type as implementation type
+	 */
+	const std::vector<implemented_by> & set_members() const;
+
+	/**
+	 * @brief Add @p member to list of set memberships.
+	 */
+	void add_set_member(implemented_by member);
+
+	/**
+	 * @return configurations of providers of named objects
+	 */
+	const std::vector<named_provider_configuration> & named_provider_configurations() const;
+
+	/**
+	 * @brief Add configuration of provider of named object to list.
+	 * @pre c.configuration must be valid
+	 */
+	void add_named_provider_configuration(named_provider_configuration c);
+
 private:
 	std::vector<std::shared_ptr<provider_configuration>> _provider_configurations;
+	std::vector<implemented_by> _set_members;
+	std::vector<named_provider_configuration> _named_provider_configurations;
 
 };
 
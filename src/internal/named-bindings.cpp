@@ -0,0 +1,79 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "named-bindings.h"
+
+#include <injeqt/exception/ambiguous-types.h>
+
+#include <cassert>
+
+namespace injeqt { namespace internal {
+
+named_binding::named_binding(type binding_type, std::string name, std::unique_ptr<provider> binding_provider) :
+	binding_type{std::move(binding_type)},
+	name{std::move(name)},
+	binding_provider{std::move(binding_provider)},
+	object{nullptr}
+{
+}
+
+named_bindings::named_bindings()
+{
+}
+
+named_bindings::named_bindings(std::vector<named_binding> bindings) :
+	_bindings{std::move(bindings)}
+{
+	auto message = std::string{};
+	for (decltype(_bindings.size()) i = 0; i < _bindings.size(); i++)
+		if (!_ids.insert({std::make_pair(_bindings[i].binding_type, _bindings[i].name), static_cast<int>(i)}).second)
+			message.append(_bindings[i].binding_type.c_name()).append(" named ").append(_bindings[i].name).append("\n");
+	if (!message.empty())
+		throw exception::ambiguous_types{message};
+}
+
+int named_bindings::id_of(const type &binding_type, const std::string &name) const
+{
+	auto id_it = _ids.find(std::make_pair(binding_type, name));
+	return id_it != std::end(_ids)
+		? id_it->second
+		: -1;
+}
+
+int named_bindings::size() const
+{
+	return static_cast<int>(_bindings.size());
+}
+
+named_binding & named_bindings::at(int id)
+{
+	assert(id >= 0 && id < size());
+
+	return _bindings[id];
+}
+
+const named_binding & named_bindings::at(int id) const
+{
+	assert(id >= 0 && id < size());
+
+	return _bindings[id];
+}
+
+}}
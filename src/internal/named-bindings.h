@@ -0,0 +1,119 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include "dependencies.h"
+#include "internal.h"
+#include "provider.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+class QObject;
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing objects available under names.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Provider of object available under name, with state of its object.
+ * @see module::add_type<T>(const std::string &)
+ *
+ * Object is injected only by setters with parameter of binding_type qualified with name. Injector core fills
+ * binding_dependencies when binding is configured and sets object when it is provided for the first time.
+ * Provider can be empty when binding of the same type and name is already configured in injector core.
+ */
+struct INJEQT_INTERNAL_API named_binding
+{
+	named_binding(type binding_type, std::string name, std::unique_ptr<provider> binding_provider);
+
+	type binding_type;
+	std::string name;
+	std::unique_ptr<provider> binding_provider;
+	dependencies binding_dependencies;
+	QObject *object;
+};
+
+/**
+ * @brief List of named bindings with dense ids.
+ *
+ * Id of binding is its position on list. Pairs of type and name are only compared in id_of(const type &, const std::string &),
+ * so injector core can map qualified setters to ids once and then inject named objects without any string comparisons.
+ */
+class INJEQT_INTERNAL_API named_bindings final
+{
+
+public:
+	/**
+	 * @brief Create empty list.
+	 */
+	named_bindings();
+
+	/**
+	 * @brief Create list from @p bindings, in the same order.
+	 * @throw ambiguous_types if the same pair of type and name is used more than once
+	 */
+	explicit named_bindings(std::vector<named_binding> bindings);
+
+	named_bindings(const named_bindings &) = delete;
+	named_bindings(named_bindings &&) = default;
+
+	named_bindings & operator = (const named_bindings &) = delete;
+	named_bindings & operator = (named_bindings &&) = default;
+
+	/**
+	 * @return id of binding with @p binding_type and @p name or -1 if there is no such binding
+	 */
+	int id_of(const type &binding_type, const std::string &name) const;
+
+	/**
+	 * @return number of bindings, all ids are lower than that
+	 */
+	int size() const;
+
+	/**
+	 * @return binding with given @p id
+	 * @pre id >= 0 && id < size()
+	 */
+	named_binding & at(int id);
+
+	/**
+	 * @return binding with given @p id
+	 * @pre id >= 0 && id < size()
+	 */
+	const named_binding & at(int id) const;
+
+private:
+	std::vector<named_binding> _bindings;
+	std::map<std::pair<type, std::string>, int> _ids;
+
+};
+
+}}
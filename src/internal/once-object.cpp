@@ -0,0 +1,138 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "once-object.h"
+
+#include <injeqt/exception/instantiation-cycle.h>
+#include <injeqt/exception/instantiation-failed.h>
+
+#include <QtCore/QObject>
+#include <cassert>
+
+namespace injeqt { namespace internal {
+
+once_object::once_object(type object_type) :
+	_object_type{std::move(object_type)},
+	_ready_object{nullptr},
+	_state{state::uninitialized},
+	_attempt{0}
+{
+	assert(!_object_type.is_empty());
+}
+
+const type & once_object::object_type() const
+{
+	return _object_type;
+}
+
+once_object::state once_object::current_state() const
+{
+	std::lock_guard<std::mutex> lock{_mutex};
+	return _state;
+}
+
+QObject * once_object::object() const
+{
+	return _ready_object.load(std::memory_order_acquire);
+}
+
+QObject * once_object::get(const std::function<std::unique_ptr<QObject>()> &construct)
+{
+	auto result = _ready_object.load(std::memory_order_acquire);
+	if (result)
+		return result;
+
+	std::unique_lock<std::mutex> lock{_mutex};
+	while (_state == state::constructing)
+	{
+		if (_constructing_thread == std::this_thread::get_id())
+			throw exception::instantiation_cycle{_object_type.c_name()};
+
+		auto attempt = _attempt;
+		_constructed.wait(lock, [this, attempt]{ return _attempt != attempt; });
+		if (_state == state::failed)
+			std::rethrow_exception(_error);
+	}
+
+	if (_state == state::ready)
+		return _object.get();
+
+	_state = state::constructing;
+	_constructing_thread = std::this_thread::get_id();
+	lock.unlock();
+
+	auto object = std::unique_ptr<QObject>{};
+	auto error = std::exception_ptr{};
+	try
+	{
+		object = construct();
+		if (!object)
+			throw exception::instantiation_failed{_object_type.c_name()};
+	}
+	catch (...)
+	{
+		error = std::current_exception();
+	}
+
+	lock.lock();
+	result = object.get();
+	finish(lock, std::move(object), error);
+	if (error)
+		std::rethrow_exception(error);
+	return result;
+}
+
+std::unique_ptr<QObject> once_object::adopt(std::unique_ptr<QObject> object)
+{
+	assert(object);
+
+	std::unique_lock<std::mutex> lock{_mutex};
+	if (_state == state::constructing || _state == state::ready)
+		return object;
+
+	finish(lock, std::move(object), std::exception_ptr{});
+	return nullptr;
+}
+
+void once_object::finish(std::unique_lock<std::mutex> &lock, std::unique_ptr<QObject> object, std::exception_ptr error)
+{
+	assert(lock.owns_lock());
+	assert(error || object);
+
+	if (error)
+	{
+		_state = state::failed;
+		_error = error;
+	}
+	else
+	{
+		_state = state::ready;
+		_object = std::move(object);
+		_error = std::exception_ptr{};
+		_ready_object.store(_object.get(), std::memory_order_release);
+	}
+	_constructing_thread = std::thread::id{};
+	_attempt++;
+
+	lock.unlock();
+	_constructed.notify_all();
+}
+
+}}
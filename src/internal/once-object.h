@@ -0,0 +1,123 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include "internal.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing objects constructed at most once.
+ */
+
+class QObject;
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Object slot of a provider that is filled at most once.
+ *
+ * Each provider that caches its object owns one instance of this class, so constructing objects of different
+ * types never contends on a common lock. Slot goes through following states:
+ * * uninitialized - no object and no construction in progress
+ * * constructing - one thread is running construction function
+ * * ready - object is available, it is returned without locking
+ * * failed - last construction thrown an exception
+ *
+ * Threads that request object while other thread is constructing it wait for result. If construction fails
+ * all of these threads receive the same exception and next request tries again. Request coming from inside of
+ * construction function on the constructing thread can never be satisfied and throws instantiation_cycle
+ * instead of deadlocking.
+ */
+class INJEQT_INTERNAL_API once_object final
+{
+
+public:
+	enum class state
+	{
+		uninitialized,
+		constructing,
+		ready,
+		failed
+	};
+
+	/**
+	 * @brief Create empty slot for object of @p object_type.
+	 * @param object_type type of object, used in exception messages
+	 * @pre !object_type.is_empty()
+	 */
+	explicit once_object(type object_type);
+
+	once_object(const once_object &) = delete;
+	once_object & operator = (const once_object &) = delete;
+
+	const type & object_type() const;
+
+	state current_state() const;
+
+	/**
+	 * @return stored object or nullptr if it was not yet constructed
+	 */
+	QObject * object() const;
+
+	/**
+	 * @return stored object, calling @p construct if it was not yet constructed
+	 * @param construct function that returns new object
+	 * @throw instantiation_failed if @p construct returns nullptr
+	 * @throw instantiation_cycle if called from inside of @p construct on the same thread
+	 * @throw any exception thrown by @p construct, also in threads waiting for its result
+	 * @post result != nullptr
+	 */
+	QObject * get(const std::function<std::unique_ptr<QObject>()> &construct);
+
+	/**
+	 * @brief Store @p object constructed outside of this slot.
+	 * @return nullptr if object was stored, @p object if slot already has an object or one is being constructed
+	 * @pre object != nullptr
+	 */
+	std::unique_ptr<QObject> adopt(std::unique_ptr<QObject> object);
+
+private:
+	type _object_type;
+	mutable std::mutex _mutex;
+	std::condition_variable _constructed;
+	std::atomic<QObject *> _ready_object;
+	std::unique_ptr<QObject> _object;
+	state _state;
+	std::thread::id _constructing_thread;
+	std::exception_ptr _error;
+	unsigned _attempt;
+
+	void finish(std::unique_lock<std::mutex> &lock, std::unique_ptr<QObject> object, std::exception_ptr error);
+
+};
+
+}}
@@ -0,0 +1,62 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+/**
+ * @file
+ * @brief Contains macros for USDT (SystemTap) static probes.
+ *
+ * Probes are compiled in only when sys/sdt.h was found at configuration time (INJEQT_HAVE_SYS_SDT_H
+ * is defined), otherwise all macros expand to nothing. Each compiled probe is a single nop instruction
+ * until a tracer (perf, bpftrace, SystemTap) attaches to it. All probes belong to provider injeqt:
+ *
+ * - provide_start(const char *type_name), provide_end(const char *type_name, QObject *object)
+ *   around each call of provider::provide(injector_core &)
+ * - setter(QObject *object, const char *object_type_name, const char *parameter_type_name)
+ *   before each call of INJEQT_SET method
+ * - init_action(QObject *object, const char *type_name), done_action(QObject *object, const char *type_name)
+ *   before each call of INJEQT_INIT and INJEQT_DONE method
+ * - inject_into_start(QObject *object, const char *type_name), inject_into_end(QObject *object, const char *type_name)
+ *   around injector_core::inject_into(QObject *)
+ * - init_start(), init_phase(const char *phase_name), init_end()
+ *   around injector_impl::init, init_phase fires after each of its phases: configurations, known_types,
+ *   providers, core, sets and named_bindings
+ *
+ * Example:
+ *
+ *     bpftrace -e 'usdt:libinjeqt.so:injeqt:provide_start { @start[tid] = nsecs; }
+ *                  usdt:libinjeqt.so:injeqt:provide_end { @ns[str(arg0)] = sum(nsecs - @start[tid]); }'
+ *
+ * Arguments must be cheap to compute, as they are evaluated even when no tracer is attached.
+ */
+
+#ifdef INJEQT_HAVE_SYS_SDT_H
+#include <sys/sdt.h>
+#define INJEQT_PROBE0(name) DTRACE_PROBE(injeqt, name)
+#define INJEQT_PROBE1(name, a1) DTRACE_PROBE1(injeqt, name, a1)
+#define INJEQT_PROBE2(name, a1, a2) DTRACE_PROBE2(injeqt, name, a1, a2)
+#define INJEQT_PROBE3(name, a1, a2, a3) DTRACE_PROBE3(injeqt, name, a1, a2, a3)
+#else
+#define INJEQT_PROBE0(name)
+#define INJEQT_PROBE1(name, a1)
+#define INJEQT_PROBE2(name, a1, a2)
+#define INJEQT_PROBE3(name, a1, a2, a3)
+#endif
@@ -0,0 +1,105 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "provider-by-constructor.h"
+
+#include "injector-core.h"
+#include "thread-invoke.h"
+
+#include <cassert>
+
+namespace injeqt { namespace internal {
+
+provider_by_constructor::provider_by_constructor(constructor_method constructor, QThread *thread) :
+	_constructor{std::move(constructor)},
+	_thread{thread},
+	_object{_constructor.object_type()}
+{
+	assert(!_constructor.is_empty());
+}
+
+provider_by_constructor::~provider_by_constructor()
+{
+}
+
+const type & provider_by_constructor::provided_type() const
+{
+	return _constructor.object_type();
+}
+
+const constructor_method & provider_by_constructor::constructor() const
+{
+	return _constructor;
+}
+
+QThread * provider_by_constructor::thread() const
+{
+	return _thread.data();
+}
+
+QObject * provider_by_constructor::provide(injector_core &i)
+{
+	return _object.get([this, &i]{
+		auto arguments = std::vector<QObject *>{};
+		arguments.reserve(_constructor.parameter_types().size());
+		for (auto &&parameter_type : _constructor.parameter_types())
+			arguments.push_back(i.get(parameter_type));
+
+		auto target_thread = thread();
+		auto result = std::unique_ptr<QObject>{};
+		invoke_on_thread(target_thread, [this, &arguments, &result]{ result = _constructor.invoke(arguments); });
+
+		if (result && target_thread && result->thread() != target_thread)
+			result->moveToThread(target_thread);
+		return result;
+	});
+}
+
+types provider_by_constructor::required_types() const
+{
+	return types{_constructor.parameter_types()};
+}
+
+bool provider_by_constructor::require_resolving() const
+{
+	return true;
+}
+
+bool provider_by_constructor::is_scoped() const
+{
+	return false;
+}
+
+bool provider_by_constructor::is_prototype() const
+{
+	return false;
+}
+
+bool provider_by_constructor::is_default_constructed() const
+{
+	return false;
+}
+
+bool provider_by_constructor::is_ready() const
+{
+	return false;
+}
+
+}}
@@ -0,0 +1,139 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+
+#include "constructor-method.h"
+#include "internal.h"
+#include "once-object.h"
+#include "provider.h"
+
+#include <QtCore/QPointer>
+#include <QtCore/QThread>
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing provider working on injection constructor.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Provider that returns object created by constructor that accepts dependencies.
+ * @see constructor_method
+ *
+ * This provider implementation will return object using injection constructor of some type. Its
+ * provided_type() returns type of object that contains passed constructor. Its required_types() returns
+ * types of constructor parameters, so injector_core instantiates them before calling provide(injector_core &).
+ *
+ * Once created, object will be stored inside and return on subsequents calls to provide(injector_core &).
+ * This provider has ownership over created object and will destroy it at own destruction. Object is kept in
+ * once_object, so concurrent first calls construct it exactly once. Remaining INJEQT_SET setters are
+ * called and INJEQT_INIT methods are invoked on object as on default-constructed ones.
+ *
+ * If thread was passed to constructor, object is constructed on that thread and has its affinity. When that
+ * thread is not running, object is constructed on current thread and then moved to it.
+ */
+class INJEQT_INTERNAL_API provider_by_constructor final : public provider
+{
+
+public:
+	/**
+	 * @brief Create provider instance with injection constructor to call.
+	 * @param constructor constructor method used to create object
+	 * @param thread thread to construct object on, nullptr for thread calling provide(injector_core &)
+	 * @pre !constructor.is_empty()
+	 */
+	explicit provider_by_constructor(constructor_method constructor, QThread *thread = nullptr);
+	virtual ~provider_by_constructor();
+
+	provider_by_constructor(provider_by_constructor &&x) = delete;
+	provider_by_constructor & operator = (provider_by_constructor &&x) = delete;
+
+	/**
+	 * @return constructor_method::object_type() of object passed to construtor
+	 */
+	virtual const type & provided_type() const override;
+
+	/**
+	 * @return object created by injection constructor
+	 * @post result != nullptr
+	 * @post implements(type{result->metaObject()}, provided_type())
+	 * @throw instantiation_failed if instantiation of provided type failed
+	 *
+	 * If object was not yet created objects of all parameter types are taken from @p i and constructor
+	 * is invoked with them. Then object from cache is returned.
+	 */
+	virtual QObject * provide(injector_core &i) override;
+
+	/**
+	 * @return types of parameters of constructor
+	 */
+	virtual types required_types() const override;
+
+	/**
+	 * @return true
+	 *
+	 * Objects created by injector will have its remaining dependencies resolved.
+	 */
+	virtual bool require_resolving() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_scoped() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_prototype() const override;
+
+	/**
+	 * @return false
+	 *
+	 * Object requires other objects, so it can not be constructed outside of provide(injector_core &).
+	 */
+	virtual bool is_default_constructed() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_ready() const override;
+
+	/**
+	 * @return constructor object passed in constructor
+	 */
+	const constructor_method & constructor() const;
+
+	/**
+	 * @return thread passed in constructor or nullptr if it was destroyed
+	 */
+	QThread * thread() const;
+
+private:
+	constructor_method _constructor;
+	QPointer<QThread> _thread;
+	once_object _object;
+
+};
+
+}}
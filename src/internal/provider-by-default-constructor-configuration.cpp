@@ -23,15 +23,19 @@
 #include <injeqt/exception/default-constructor-not-found.h>
 #include <injeqt/exception/qobject-type.h>
 
+#include "constructor-method.h"
 #include "default-constructor-method.h"
+#include "provider-by-constructor.h"
 #include "provider-by-default-constructor.h"
+#include "wiring-table.h"
 
 #include <cassert>
 
 namespace injeqt { namespace internal {
 
-provider_by_default_constructor_configuration::provider_by_default_constructor_configuration(type object_type) :
-	_object_type{std::move(object_type)}
+provider_by_default_constructor_configuration::provider_by_default_constructor_configuration(type object_type, QThread *thread) :
+	_object_type{std::move(object_type)},
+	_thread{thread}
 {
 	assert(!_object_type.is_empty());
 }
@@ -45,16 +49,22 @@ std::vector<type> provider_by_default_constructor_configuration::types() const
 	return {_object_type};
 }
 
-std::unique_ptr<provider> provider_by_default_constructor_configuration::create_provider(const types_by_name &) const
+std::unique_ptr<provider> provider_by_default_constructor_configuration::create_provider(const types_by_name &known_types, const wiring_tables &tables) const
 {
 	if (_object_type.is_qobject())
 		throw exception::qobject_type();
 
-	auto c = make_default_constructor_method(_object_type);
-	if (c.is_empty())
-		throw exception::default_constructor_not_found{_object_type.name()};
+	auto &table = tables.at(_object_type);
+	auto c = make_default_constructor_method(table);
+	if (!c.is_empty())
+		return std::unique_ptr<provider_by_default_constructor>{new provider_by_default_constructor{std::move(c), _thread}};
 
-	return std::unique_ptr<provider_by_default_constructor>{new provider_by_default_constructor{std::move(c)}};
+	// types without default constructor can get dependencies in constructor
+	auto ic = make_constructor_method(known_types, table);
+	if (ic.is_empty())
+		throw exception::default_constructor_not_found{_object_type.c_name()};
+
+	return std::unique_ptr<provider_by_constructor>{new provider_by_constructor{std::move(ic), _thread}};
 }
 
 }}
@@ -26,6 +26,8 @@
 #include "internal.h"
 #include "provider-configuration.h"
 
+class QThread;
+
 /**
  * @file
  * @brief Contains classes and functions for representing configuration of provider working on default constructor.
@@ -37,7 +39,7 @@ namespace injeqt { namespace internal {
  * @brief Configuration of provider that returns default-constructed object.
  *
  * This provider configuration object will return provider implementation that will
- * use default constructor to create objects.
+ * use default constructor to create objects, optionally on given thread.
  */
 class INJEQT_INTERNAL_API provider_by_default_constructor_configuration : public provider_configuration
 {
@@ -46,12 +48,13 @@ public:
 	/**
 	 * @brief Create provider configuration instance.
 	 * @param object_type type of object that this provider will return
+	 * @param thread thread to construct objects on, nullptr for thread requesting object
 	 * @pre !object_type.is_empty()
 	 * 
 	 * This constructor does not throw even when @p object_type is invalid or does not have deafult
-	 * contructor. Factory method create_provider(const types_by_name &) will throw in that case.
+	 * contructor. Factory method create_provider(const types_by_name &, const wiring_tables &) will throw in that case.
 	 */
-	explicit provider_by_default_constructor_configuration(type object_type);
+	explicit provider_by_default_constructor_configuration(type object_type, QThread *thread = nullptr);
 	virtual ~provider_by_default_constructor_configuration();
 
 	/**
@@ -65,10 +68,11 @@ public:
 	 * @throw exception::qobject_type if object_type passed to constructor was QObject
 	 * @throw exception::default_constructor_not_found if object_type passed does not have default constructor
 	 */
-	virtual std::unique_ptr<provider> create_provider(const types_by_name &known_types) const override;
+	virtual std::unique_ptr<provider> create_provider(const types_by_name &known_types, const wiring_tables &tables) const override;
 
 private:
 	type _object_type;
+	QThread *_thread;
 
 };
 
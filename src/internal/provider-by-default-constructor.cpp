@@ -20,14 +20,16 @@
 
 #include "provider-by-default-constructor.h"
 
-#include <injeqt/exception/instantiation-failed.h>
+#include "thread-invoke.h"
 
 #include <cassert>
 
 namespace injeqt { namespace internal {
 
-provider_by_default_constructor::provider_by_default_constructor(default_constructor_method constructor) :
-	_constructor{std::move(constructor)}
+provider_by_default_constructor::provider_by_default_constructor(default_constructor_method constructor, QThread *thread) :
+	_constructor{std::move(constructor)},
+	_thread{thread},
+	_object{_constructor.object_type()}
 {
 	assert(!_constructor.is_empty());
 }
@@ -46,15 +48,33 @@ const default_constructor_method & provider_by_default_constructor::constructor(
 	return _constructor;
 }
 
+QThread * provider_by_default_constructor::thread() const
+{
+	return _thread.data();
+}
+
 QObject * provider_by_default_constructor::provide(injector_core &)
 {
-	if (!_object)
-	{
-		_object = _constructor.invoke();
-		if (!_object)
-			throw exception::instantiation_failed{provided_type().name()};
-	}
-	return _object.get();
+	return _object.get([this]{ return construct(); });
+}
+
+std::unique_ptr<QObject> provider_by_default_constructor::construct() const
+{
+	auto target_thread = thread();
+	auto result = std::unique_ptr<QObject>{};
+	invoke_on_thread(target_thread, [this, &result]{ result = _constructor.invoke(); });
+
+	if (result && target_thread && result->thread() != target_thread)
+		result->moveToThread(target_thread);
+	return result;
+}
+
+std::unique_ptr<QObject> provider_by_default_constructor::adopt(std::unique_ptr<QObject> object)
+{
+	assert(object);
+	assert(type{object->metaObject()} == provided_type());
+
+	return _object.adopt(std::move(object));
 }
 
 bool provider_by_default_constructor::require_resolving() const
@@ -62,4 +82,24 @@ bool provider_by_default_constructor::require_resolving() const
 	return true;
 }
 
+bool provider_by_default_constructor::is_scoped() const
+{
+	return false;
+}
+
+bool provider_by_default_constructor::is_prototype() const
+{
+	return false;
+}
+
+bool provider_by_default_constructor::is_default_constructed() const
+{
+	return true;
+}
+
+bool provider_by_default_constructor::is_ready() const
+{
+	return false;
+}
+
 }}
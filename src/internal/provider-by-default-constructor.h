@@ -23,9 +23,13 @@
 #include <injeqt/injeqt.h>
 
 #include "internal.h"
+#include "once-object.h"
 #include "provider.h"
 #include "default-constructor-method.h"
 
+#include <QtCore/QPointer>
+#include <QtCore/QThread>
+
 /**
  * @file
  * @brief Contains classes and functions for representing provider working on default constructor.
@@ -42,6 +46,13 @@ namespace injeqt { namespace internal {
  *
  * Once created, object will be stored inside and return on subsequents calls to provide(injector_core &).
  * This provider has ownershipd over created object and will destroy it at own destruction.
+ * Object is kept in once_object, so concurrent first calls construct it exactly once.
+ *
+ * Object can also be constructed outside of this provider (for example on worker thread) and then passed
+ * to it with adopt(std::unique_ptr<QObject>).
+ *
+ * If thread was passed to constructor, object is constructed on that thread and has its affinity. When that
+ * thread is not running, object is constructed on current thread and then moved to it.
  */
 class INJEQT_INTERNAL_API provider_by_default_constructor final : public provider
 {
@@ -50,9 +61,10 @@ public:
 	/**
 	 * @brief Create provider instance with default constructor to call.
 	 * @param constructor constructor method used to create object
+	 * @param thread thread to construct object on, nullptr for thread calling provide(injector_core &)
 	 * @pre !constructor.is_empty()
 	 */
-	explicit provider_by_default_constructor(default_constructor_method constructor);
+	explicit provider_by_default_constructor(default_constructor_method constructor, QThread *thread = nullptr);
 	virtual ~provider_by_default_constructor();
 
 	provider_by_default_constructor(provider_by_default_constructor &&x) = delete;
@@ -86,14 +98,52 @@ public:
 	 */
 	virtual bool require_resolving() const override;
 
+	/**
+	 * @return false
+	 */
+	virtual bool is_scoped() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_prototype() const override;
+
+	/**
+	 * @return true
+	 */
+	virtual bool is_default_constructed() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_ready() const override;
+
 	/**
 	 * @return constructor object passed in constructor
 	 */
 	const default_constructor_method & constructor() const;
 
+	/**
+	 * @return thread passed in constructor or nullptr if it was destroyed
+	 */
+	QThread * thread() const;
+
+	/**
+	 * @brief Take ownership of @p object constructed outside of this provider.
+	 * @return nullptr if object was adopted, @p object if provider already has an object
+	 * @pre object != nullptr
+	 * @pre type{object->metaObject()} == provided_type()
+	 *
+	 * Adopted object is returned from next calls to provide(injector_core &).
+	 */
+	std::unique_ptr<QObject> adopt(std::unique_ptr<QObject> object);
+
 private:
 	default_constructor_method _constructor;
-	std::unique_ptr<QObject> _object;
+	QPointer<QThread> _thread;
+	once_object _object;
+
+	std::unique_ptr<QObject> construct() const;
 
 };
 
@@ -25,6 +25,7 @@
 
 #include "factory-method.h"
 #include "provider-by-factory.h"
+#include "wiring-table.h"
 
 #include <cassert>
 
@@ -47,16 +48,16 @@ std::vector<type> provider_by_factory_configuration::types() const
 	return {_object_type, _factory_type};
 }
 
-std::unique_ptr<provider> provider_by_factory_configuration::create_provider(const types_by_name &known_types) const
+std::unique_ptr<provider> provider_by_factory_configuration::create_provider(const types_by_name &known_types, const wiring_tables &tables) const
 {
 	if (_object_type.is_qobject())
 		throw exception::qobject_type();
 	if (_factory_type.is_qobject())
 		throw exception::qobject_type();
 
-	auto fm = internal::make_factory_method(known_types, _object_type, _factory_type);
+	auto fm = internal::make_factory_method(known_types, _object_type, tables.at(_factory_type));
 	if (fm.is_empty())
-		throw exception::unique_factory_method_not_found{_object_type.name() + " in " + _factory_type.name()};
+		throw exception::unique_factory_method_not_found{std::string{_object_type.c_name()} + " in " + _factory_type.c_name()};
 
 	return std::unique_ptr<provider_by_factory>{new provider_by_factory{std::move(fm)}};
 }
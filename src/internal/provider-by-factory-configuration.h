@@ -52,7 +52,7 @@ public:
 	 * 
 	 * This constructor does not throw even when @p object_type or @p factory_type is invalid or if 
 	 * @p factory_type does not contain proper factory method.
-	 * Factory method create_provider(const types_by_name &) will throw in that case.
+	 * Factory method create_provider(const types_by_name &, const wiring_tables &) will throw in that case.
 	 */
 	explicit provider_by_factory_configuration(type object_type, type factory_type);
 	virtual ~provider_by_factory_configuration();
@@ -69,7 +69,7 @@ public:
 	 * @throw exception::factory_type if object_type passed to constructor was QObject
 	 * @throw exception::unique_factory_method_not_found if factory_type does not have unique factory metohod returning object_type
 	 */
-	virtual std::unique_ptr<provider> create_provider(const types_by_name &known_types) const override;
+	virtual std::unique_ptr<provider> create_provider(const types_by_name &known_types, const wiring_tables &tables) const override;
 
 private:
 	type _object_type;
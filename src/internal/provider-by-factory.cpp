@@ -20,14 +20,13 @@
 
 #include "provider-by-factory.h"
 
-#include <injeqt/exception/instantiation-failed.h>
-
 #include "injector-impl.h"
 
 namespace injeqt { namespace internal {
 
 provider_by_factory::provider_by_factory(factory_method factory) :
-	_factory{std::move(factory)}
+	_factory{std::move(factory)},
+	_object{_factory.result_type()}
 {
 }
 
@@ -47,15 +46,10 @@ const factory_method & provider_by_factory::factory() const
 
 QObject * provider_by_factory::provide(injector_core &i)
 {
-	if (!_object)
-	{
+	return _object.get([this, &i]{
 		auto factory_object = i.get(_factory.object_type());
-		_object = _factory.invoke(factory_object);
-		if (!_object)
-			throw exception::instantiation_failed{provided_type().name()};
-	}
-
-	return _object.get();
+		return _factory.invoke(factory_object);
+	});
 }
 
 types provider_by_factory::required_types() const
@@ -68,4 +62,24 @@ bool provider_by_factory::require_resolving() const
 	return false;
 }
 
+bool provider_by_factory::is_scoped() const
+{
+	return false;
+}
+
+bool provider_by_factory::is_prototype() const
+{
+	return false;
+}
+
+bool provider_by_factory::is_default_constructed() const
+{
+	return false;
+}
+
+bool provider_by_factory::is_ready() const
+{
+	return false;
+}
+
 }}
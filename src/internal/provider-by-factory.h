@@ -24,6 +24,7 @@
 
 #include "factory-method.h"
 #include "internal.h"
+#include "once-object.h"
 #include "provider.h"
 
 /**
@@ -43,6 +44,7 @@ namespace injeqt { namespace internal {
  *
  * Once created, object will be stored inside and return on subsequents calls to provide(injector_core &).
  * This provider has ownershipd over created object and will destroy it at own destruction.
+ * Object is kept in once_object, so concurrent first calls construct it exactly once.
  */
 class INJEQT_INTERNAL_API provider_by_factory final : public provider
 {
@@ -89,6 +91,26 @@ public:
 	 */
 	virtual bool require_resolving() const override;
 
+	/**
+	 * @return false
+	 */
+	virtual bool is_scoped() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_prototype() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_default_constructed() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_ready() const override;
+
 	/**
 	 * @return factory method object passed in constructor
 	 */
@@ -96,7 +118,7 @@ public:
 
 private:
 	factory_method _factory;
-	std::unique_ptr<QObject> _object;
+	once_object _object;
 
 };
 
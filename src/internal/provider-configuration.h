@@ -36,6 +36,7 @@
 namespace injeqt { namespace internal {
 
 class provider;
+class wiring_tables;
 
 /**
  * @brief Abstract configuration of object's provider
@@ -44,9 +45,9 @@ class provider;
  * This object is used to create @see provider objects. Configurations are stored in @see module
  * and @see module_impl, providers are stored in @see injector_core objects.
  * 
- * Provider configuration contains only two methods: types() and create_provider(const types_by_name &).
+ * Provider configuration contains only two methods: types() and create_provider(const types_by_name &, const wiring_tables &).
  * First one is represents list of types that are known to provider (like factory type and created
- * object type), second one creates provider based on list of all known types.
+ * object type), second one creates provider based on list of all known types and on wiring tables of types of all configurations.
  * 
  * This class is reqruied due to Qt limitations of interactions between plugins and QMetaType system.
  * If QMetaType have worked properly inside plugins it could be used to extract parameter and return
@@ -70,9 +71,12 @@ public:
 
 	/**
 	 * @param known_types list of all types known to injector
+	 * @param tables wiring tables that contain tables of all types()
 	 * @return new provider object
+	 *
+	 * This method can be called from many threads at once.
 	 */
-	virtual std::unique_ptr<provider> create_provider(const types_by_name &known_types) const = 0;
+	virtual std::unique_ptr<provider> create_provider(const types_by_name &known_types, const wiring_tables &tables) const = 0;
 
 };
 
@@ -0,0 +1,114 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "provider-prototype.h"
+
+#include <injeqt/exception/instantiation-failed.h>
+
+#include <cassert>
+
+namespace injeqt { namespace internal {
+
+provider_prototype::provider_prototype(default_constructor_method constructor, std::size_t pool_capacity) :
+	_constructor{std::move(constructor)},
+	_pool_capacity{pool_capacity}
+{
+	assert(!_constructor.is_empty());
+}
+
+provider_prototype::~provider_prototype()
+{
+}
+
+const type & provider_prototype::provided_type() const
+{
+	return _constructor.object_type();
+}
+
+const default_constructor_method & provider_prototype::constructor() const
+{
+	return _constructor;
+}
+
+QObject * provider_prototype::provide(injector_core &)
+{
+	auto object = _constructor.invoke();
+	if (!object)
+		throw exception::instantiation_failed{provided_type().c_name()};
+	return object.release();
+}
+
+bool provider_prototype::require_resolving() const
+{
+	return true;
+}
+
+bool provider_prototype::is_scoped() const
+{
+	return false;
+}
+
+bool provider_prototype::is_prototype() const
+{
+	return true;
+}
+
+bool provider_prototype::is_default_constructed() const
+{
+	return false;
+}
+
+bool provider_prototype::is_ready() const
+{
+	return false;
+}
+
+std::size_t provider_prototype::pool_capacity() const
+{
+	return _pool_capacity;
+}
+
+const std::vector<std::unique_ptr<QObject>> & provider_prototype::pool() const
+{
+	return _pool;
+}
+
+std::unique_ptr<QObject> provider_prototype::take_from_pool()
+{
+	if (_pool.empty())
+		return {};
+
+	auto result = std::move(_pool.back());
+	_pool.pop_back();
+	return result;
+}
+
+std::unique_ptr<QObject> provider_prototype::put_to_pool(std::unique_ptr<QObject> object)
+{
+	assert(object);
+
+	if (_pool.size() >= _pool_capacity)
+		return object;
+
+	_pool.push_back(std::move(object));
+	return {};
+}
+
+}}
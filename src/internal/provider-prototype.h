@@ -0,0 +1,147 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+
+#include "internal.h"
+#include "provider.h"
+#include "default-constructor-method.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing provider of prototype objects.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Provider that returns new default-constructed object for each request.
+ *
+ * This provider implementation will return new object created using default constructor of some type
+ * on each call to provide(injector_core &). Its provided_type() returns type of object that contains
+ * passed constructor. Its required_types() returns empty set of types no other objects are required for
+ * construction. Ownership of each object is passed to caller.
+ *
+ * Provider also keeps bounded pool of released objects. Injector puts released objects into the pool
+ * with put_to_pool(std::unique_ptr<QObject>) and reuses them with take_from_pool() before calling
+ * provide(injector_core &). Objects in pool are owned by provider. Pool grows only when objects are
+ * released, so large capacity is only an upper bound and does not allocate anything up front.
+ */
+class INJEQT_INTERNAL_API provider_prototype final : public provider
+{
+
+public:
+	/**
+	 * @brief Create provider instance with default constructor to call.
+	 * @param constructor constructor method used to create objects
+	 * @param pool_capacity maximum number of released objects kept for reuse
+	 * @pre !constructor.is_empty()
+	 */
+	explicit provider_prototype(default_constructor_method constructor, std::size_t pool_capacity);
+	virtual ~provider_prototype();
+
+	provider_prototype(provider_prototype &&x) = delete;
+	provider_prototype & operator = (provider_prototype &&x) = delete;
+
+	/**
+	 * @return default_constructor_method::object_type() of object passed to construtor
+	 */
+	virtual const type & provided_type() const override;
+
+	/**
+	 * @return new object created by default constructor, owned by caller
+	 * @post result != nullptr
+	 * @post implements(type{result->metaObject()}, provided_type())
+	 * @throw instantiation_failed if instantiation of provided type failed
+	 */
+	virtual QObject * provide(injector_core &i) override;
+
+	/**
+	 * @return empty set of object - this provider does not require another object to instantiate
+	 */
+	virtual types required_types() const override { return types{}; }
+
+	/**
+	 * @return true
+	 *
+	 * Objects created by injector will have its dependencies resolved.
+	 */
+	virtual bool require_resolving() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_scoped() const override;
+
+	/**
+	 * @return true
+	 */
+	virtual bool is_prototype() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_default_constructed() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_ready() const override;
+
+	/**
+	 * @return constructor object passed in constructor
+	 */
+	const default_constructor_method & constructor() const;
+
+	/**
+	 * @return maximum number of objects kept in pool
+	 */
+	std::size_t pool_capacity() const;
+
+	/**
+	 * @return objects currently kept in pool
+	 */
+	const std::vector<std::unique_ptr<QObject>> & pool() const;
+
+	/**
+	 * @return object from pool, owned by caller, or nullptr if pool is empty
+	 */
+	std::unique_ptr<QObject> take_from_pool();
+
+	/**
+	 * @brief Put @p object into pool.
+	 * @return nullptr if object was added to pool, @p object if pool is full
+	 * @pre object != nullptr
+	 */
+	std::unique_ptr<QObject> put_to_pool(std::unique_ptr<QObject> object);
+
+private:
+	default_constructor_method _constructor;
+	std::size_t _pool_capacity;
+	std::vector<std::unique_ptr<QObject>> _pool;
+
+};
+
+}}
@@ -49,7 +49,7 @@ public:
 	 * @pre !object_type.is_empty()
 	 * 
 	 * This constructor does not throw even when @p object_type and @p object combination is invalid.
-	 * Factory method create_provider(const types_by_name &) will throw in that case.
+	 * Factory method create_provider(const types_by_name &, const wiring_tables &) will throw in that case.
 	 */
 	explicit provider_ready_configuration(type object_type, QObject *object);
 	virtual ~provider_ready_configuration();
@@ -68,7 +68,7 @@ public:
 	 * @throw exception::invalid_qobject if object passed to constructor was nullptr does not have a valid metaObject()
 	 * @throw exception::interface_not_implemented if object passed to constructor does not implement object_type interface
 	 */
-	virtual std::unique_ptr<provider> create_provider(const types_by_name &known_types) const override;
+	virtual std::unique_ptr<provider> create_provider(const types_by_name &known_types, const wiring_tables &tables) const override;
 
 private:
 	type _object_type;
@@ -20,6 +20,8 @@
 
 #include "provider-ready.h"
 
+#include <cassert>
+
 namespace injeqt { namespace internal {
 
 provider_ready::provider_ready(implementation ready_implementation) :
@@ -37,6 +39,13 @@ const implementation & provider_ready::ready_implementation() const
 	return _ready_implementation;
 }
 
+void provider_ready::set_ready_implementation(implementation ready_implementation)
+{
+	assert(ready_implementation.interface_type() == provided_type());
+
+	_ready_implementation = std::move(ready_implementation);
+}
+
 QObject * provider_ready::provide(injector_core &)
 {
 	return _ready_implementation.object();
@@ -47,4 +56,24 @@ bool provider_ready::require_resolving() const
 	return false;
 }
 
+bool provider_ready::is_scoped() const
+{
+	return false;
+}
+
+bool provider_ready::is_prototype() const
+{
+	return false;
+}
+
+bool provider_ready::is_default_constructed() const
+{
+	return false;
+}
+
+bool provider_ready::is_ready() const
+{
+	return true;
+}
+
 }}
@@ -75,11 +75,38 @@ public:
 	 */
 	virtual bool require_resolving() const override;
 
+	/**
+	 * @return false
+	 */
+	virtual bool is_scoped() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_prototype() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_default_constructed() const override;
+
+	/**
+	 * @return true
+	 */
+	virtual bool is_ready() const override;
+
 	/**
 	 * @return implementation object passed in constructor
 	 */
 	const implementation & ready_implementation() const;
 
+	/**
+	 * @brief Replace object returned by this provider.
+	 * @param ready_implementation new object to return
+	 * @pre ready_implementation.interface_type() == provided_type()
+	 */
+	void set_ready_implementation(implementation ready_implementation);
+
 private:
 	implementation _ready_implementation;
 
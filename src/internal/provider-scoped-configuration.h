@@ -1,6 +1,6 @@
 /*
  * %injeqt copyright begin%
- * Copyright 2015 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
  * %injeqt copyright end%
  *
  * This library is free software; you can redistribute it and/or
@@ -23,36 +23,35 @@
 #include <injeqt/injeqt.h>
 #include <injeqt/type.h>
 
+#include "internal.h"
 #include "provider-configuration.h"
 
-#include "injector-impl.h"
-
 /**
  * @file
- * @brief Contains classes and functions for representing configuration of provider that uses different injector.
+ * @brief Contains classes and functions for representing configuration of provider of scoped objects.
  */
 
 namespace injeqt { namespace internal {
 
 /**
- * @brief Configuration of provider that uses different injector.
+ * @brief Configuration of provider that returns new default-constructed object for each scope.
  *
- * This provider configuration object will return provider implementation that will
- * use different (parent) injector to provide objects.
+ * This provider configuration object will return @see provider_scoped implementation.
  */
-class provider_by_parent_injector_configuration : public provider_configuration
+class INJEQT_INTERNAL_API provider_scoped_configuration : public provider_configuration
 {
 
 public:
 	/**
 	 * @brief Create provider configuration instance.
-	 * @param parent_injector injector used to get object
-	 * @param object_type type to provide
-	 * @pre parent_injector != nullptr
+	 * @param object_type type of object that this provider will return
 	 * @pre !object_type.is_empty()
+	 *
+	 * This constructor does not throw even when @p object_type is invalid or does not have deafult
+	 * contructor. Factory method create_provider(const types_by_name &, const wiring_tables &) will throw in that case.
 	 */
-	explicit provider_by_parent_injector_configuration(injector_impl *parent_injector, type object_type);
-	virtual ~provider_by_parent_injector_configuration();
+	explicit provider_scoped_configuration(type object_type);
+	virtual ~provider_scoped_configuration();
 
 	/**
 	 * @return list consisting of object_type param passed to constructor
@@ -60,13 +59,14 @@ public:
 	virtual std::vector<type> types() const override;
 
 	/**
-	 * @param known_types list of all types known to injector, used to check return types of methods
-	 * @return pointer to new @see provider_by_parent_injector_ object
+	 * @param known_types list of all types known to injector, not used
+	 * @return pointer to new @see provider_scoped object
+	 * @throw exception::qobject_type if object_type passed to constructor was QObject
+	 * @throw exception::default_constructor_not_found if object_type passed does not have default constructor
 	 */
-	virtual std::unique_ptr<provider> create_provider(const types_by_name &known_types) const override;
+	virtual std::unique_ptr<provider> create_provider(const types_by_name &known_types, const wiring_tables &tables) const override;
 
 private:
-	injector_impl *_parent_injector;
 	type _object_type;
 
 };
@@ -0,0 +1,82 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "provider-scoped.h"
+
+#include <injeqt/exception/instantiation-failed.h>
+
+#include <cassert>
+
+namespace injeqt { namespace internal {
+
+provider_scoped::provider_scoped(default_constructor_method constructor) :
+	_constructor{std::move(constructor)}
+{
+	assert(!_constructor.is_empty());
+}
+
+provider_scoped::~provider_scoped()
+{
+}
+
+const type & provider_scoped::provided_type() const
+{
+	return _constructor.object_type();
+}
+
+const default_constructor_method & provider_scoped::constructor() const
+{
+	return _constructor;
+}
+
+QObject * provider_scoped::provide(injector_core &)
+{
+	auto object = _constructor.invoke();
+	if (!object)
+		throw exception::instantiation_failed{provided_type().c_name()};
+	return object.release();
+}
+
+bool provider_scoped::require_resolving() const
+{
+	return true;
+}
+
+bool provider_scoped::is_scoped() const
+{
+	return true;
+}
+
+bool provider_scoped::is_prototype() const
+{
+	return false;
+}
+
+bool provider_scoped::is_default_constructed() const
+{
+	return false;
+}
+
+bool provider_scoped::is_ready() const
+{
+	return false;
+}
+
+}}
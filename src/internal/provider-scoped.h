@@ -0,0 +1,117 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+
+#include "internal.h"
+#include "provider.h"
+#include "default-constructor-method.h"
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing provider of scoped objects.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Provider that returns new default-constructed object for each scope.
+ *
+ * This provider implementation will return new object created using default constructor of some type
+ * on each call to provide(injector_core &). Its provided_type() returns type of object that contains
+ * passed constructor. Its required_types() returns empty set of types no other objects are required for
+ * construction.
+ *
+ * This provider does not store created objects. Ownership of each object is passed to caller - injector_core
+ * stores it in currently active scope and destroys it when scope ends.
+ */
+class INJEQT_INTERNAL_API provider_scoped final : public provider
+{
+
+public:
+	/**
+	 * @brief Create provider instance with default constructor to call.
+	 * @param constructor constructor method used to create objects
+	 * @pre !constructor.is_empty()
+	 */
+	explicit provider_scoped(default_constructor_method constructor);
+	virtual ~provider_scoped();
+
+	provider_scoped(provider_scoped &&x) = delete;
+	provider_scoped & operator = (provider_scoped &&x) = delete;
+
+	/**
+	 * @return default_constructor_method::object_type() of object passed to construtor
+	 */
+	virtual const type & provided_type() const override;
+
+	/**
+	 * @return new object created by default constructor, owned by caller
+	 * @post result != nullptr
+	 * @post implements(type{result->metaObject()}, provided_type())
+	 * @throw instantiation_failed if instantiation of provided type failed
+	 */
+	virtual QObject * provide(injector_core &i) override;
+
+	/**
+	 * @return empty set of object - this provider does not require another object to instantiate
+	 */
+	virtual types required_types() const override { return types{}; }
+
+	/**
+	 * @return true
+	 *
+	 * Objects created by injector will have its dependencies resolved.
+	 */
+	virtual bool require_resolving() const override;
+
+	/**
+	 * @return true
+	 */
+	virtual bool is_scoped() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_prototype() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_default_constructed() const override;
+
+	/**
+	 * @return false
+	 */
+	virtual bool is_ready() const override;
+
+	/**
+	 * @return constructor object passed in constructor
+	 */
+	const default_constructor_method & constructor() const;
+
+private:
+	default_constructor_method _constructor;
+
+};
+
+}}
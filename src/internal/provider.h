@@ -49,6 +49,11 @@ class injector_core;
  * 
  * Provider return objects that may or may not require dependency resolving.
  * It can be checked with require_resolving() method.
+ *
+ * Scoped providers (is_scoped() returns true) create new object on each call to provide()
+ * and pass its ownership to caller. Injector stores these objects in currently active scope.
+ * Prototype providers (is_prototype() returns true) do the same, but injector calls them for
+ * each request and each injection point.
  */
 class provider
 {
@@ -87,6 +92,28 @@ public:
 	 */
 	virtual bool require_resolving() const = 0;
 
+	/**
+	 * @return true, if provided objects are bound to scope and owned by caller of provide(injector_core &)
+	 */
+	virtual bool is_scoped() const = 0;
+
+	/**
+	 * @return true, if new object is provided for each request and is owned by caller of provide(injector_core &)
+	 */
+	virtual bool is_prototype() const = 0;
+
+	/**
+	 * @return true, if provider is provider_by_default_constructor - its object can be constructed
+	 * outside of provide(injector_core &) and passed with provider_by_default_constructor::adopt
+	 */
+	virtual bool is_default_constructed() const = 0;
+
+	/**
+	 * @return true, if provider is provider_ready - its object is not owned by injector and can be replaced
+	 * with provider_ready::set_ready_implementation
+	 */
+	virtual bool is_ready() const = 0;
+
 };
 
 }}
@@ -39,8 +39,12 @@ types required_to_satisfy(const dependencies &dependencies_to_satisfy, const typ
 		[](const implementation &i){ return i.interface_type(); });
 
 	auto interfaces_to_check = std::vector<type>{};
-	std::transform(std::begin(dependencies_to_satisfy), std::end(dependencies_to_satisfy), std::back_inserter(interfaces_to_check),
-		[](const dependency &d){ return d.required_type(); });
+	auto add_interfaces_to_check = [&interfaces_to_check](const std::vector<dependency> &dependencies){
+		for (auto &&d : dependencies)
+			if (d.setter().is_eager())
+				interfaces_to_check.push_back(d.required_type());
+	};
+	add_interfaces_to_check(dependencies_to_satisfy.content());
 
 	while (!interfaces_to_check.empty())
 	{
@@ -59,9 +63,7 @@ types required_to_satisfy(const dependencies &dependencies_to_satisfy, const typ
 
 		if (model.mapped_dependencies().contains_key(current_implementation_type))
 		{
-			auto dependencies = model.mapped_dependencies().get(current_implementation_type)->dependency_list();
-			std::transform(std::begin(dependencies), std::end(dependencies), std::back_inserter(interfaces_to_check),
-				[](const dependency &d){ return d.required_type(); });
+			add_interfaces_to_check(model.mapped_dependencies().get(current_implementation_type)->dependency_list().content());
 		}
 	}
 
@@ -44,6 +44,8 @@ namespace injeqt { namespace internal {
  * This function computes list of all types that must be instantiated in order to properly resolve all
  * provided dependencies. It means it recursively traverses dependency tree and returns all nodes that
  * are not found in @p objects set.
+ *
+ * Dependencies injected with injeqt::lazy<T> setters are not traversed - these are resolved on first access.
  */
 INJEQT_INTERNAL_API types required_to_satisfy(const dependencies &dependencies_to_satisfy, const types_model &model, const implementations &objects);
 
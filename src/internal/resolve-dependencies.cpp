@@ -24,17 +24,29 @@
 #include "implementations.h"
 #include "resolved-dependency.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace injeqt { namespace internal {
 
 resolve_dependencies_result resolve_dependencies(const dependencies &to_resolve, const implementations &resolve_with)
 {
-	auto match_result = match(to_resolve, resolve_with, type_from_dependency, type_from_implementation, match_increment_mode::left);
+	auto eager = std::vector<dependency>{};
+	auto unresolved = std::vector<dependency>{};
+	for (auto &&d : to_resolve)
+		if (!d.setter().is_eager())
+			unresolved.push_back(d);
+		else
+			eager.push_back(d);
+
+	auto match_result = match(dependencies{eager}, resolve_with, type_from_dependency, type_from_implementation, match_increment_mode::left);
 	auto resolved = std::vector<resolved_dependency>{};
 
 	for (auto &&match : match_result.matched)
 		resolved.emplace_back(match.second, match.first.setter());
 
-	return {dependencies{match_result.unmatched_1}, resolved};
+	std::copy(std::begin(match_result.unmatched_1), std::end(match_result.unmatched_1), std::back_inserter(unresolved));
+	return {dependencies{unresolved}, resolved};
 }
 
 }}
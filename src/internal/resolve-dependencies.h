@@ -64,6 +64,9 @@ struct resolve_dependencies_result
  * have corresponding object - it is added to resolve_dependencies_result::unresolved field. All matching dependency -
  * implementation pairs are added to resolve_dependencies_result::resolved field.
  *
+ * Dependencies injected with injeqt::lazy<T> setters are never matched and are always added to
+ * resolve_dependencies_result::unresolved field, as these require lazy handles instead of objects.
+ *
  * This function requires that all items in both sets are valid. In other case its behavior is undefined.
  * This function returns only valid objects.
  */
@@ -0,0 +1,76 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "reverse-dependencies.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace injeqt { namespace internal {
+
+void reverse_dependencies::track(QObject *dependency)
+{
+	assert(dependency);
+
+	_dependents[dependency];
+}
+
+void reverse_dependencies::untrack(QObject *dependency)
+{
+	_dependents.erase(dependency);
+}
+
+bool reverse_dependencies::is_tracked(QObject *dependency) const
+{
+	return _dependents.find(dependency) != std::end(_dependents);
+}
+
+void reverse_dependencies::add(QObject *dependency, QObject *dependent_object, const setter_method &setter)
+{
+	assert(dependent_object);
+
+	auto dependents_it = _dependents.find(dependency);
+	if (dependents_it == std::end(_dependents))
+		return;
+
+	auto &dependents = dependents_it->second;
+	// objects destroyed in the meantime are dropped before list grows, so it does not grow with each scope
+	if (dependents.size() == dependents.capacity())
+		dependents.erase(std::remove_if(std::begin(dependents), std::end(dependents), [](const dependent &d){ return d.object.isNull(); }), std::end(dependents));
+	dependents.push_back(dependent{dependent_object, setter});
+}
+
+std::vector<reverse_dependencies::dependent> reverse_dependencies::rebind(QObject *from, QObject *to)
+{
+	assert(is_tracked(from));
+	assert(to);
+
+	auto dependents_it = _dependents.find(from);
+	auto result = std::vector<dependent>{};
+	std::copy_if(std::begin(dependents_it->second), std::end(dependents_it->second), std::back_inserter(result),
+		[](const dependent &d){ return !d.object.isNull(); });
+	_dependents.erase(dependents_it);
+
+	_dependents[to] = result;
+	return result;
+}
+
+}}
@@ -0,0 +1,104 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+
+#include "internal.h"
+#include "setter-method.h"
+
+#include <map>
+#include <vector>
+#include <QtCore/QPointer>
+
+class QObject;
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing index of objects injected with given object.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Index of objects that were injected with tracked objects.
+ * @see injector_core::replace_ready_object(const implementation &)
+ *
+ * Injector core tracks objects that can be replaced at runtime and adds each setter call to this index.
+ * Calls with objects that are not tracked are not recorded, so cost of add(QObject *, QObject *, setter_method)
+ * for these is only one lookup.
+ *
+ * Dependent objects are held with QPointer, so entries of objects destroyed in the meantime (for example at
+ * end of scope) are skipped and dropped before list of dependents grows.
+ */
+class INJEQT_INTERNAL_API reverse_dependencies final
+{
+
+public:
+	/**
+	 * @brief Dependent object with setter that was called on it.
+	 */
+	struct dependent
+	{
+		QPointer<QObject> object;
+		setter_method setter;
+	};
+
+	/**
+	 * @brief Start recording setter calls with @p dependency.
+	 * @pre dependency != nullptr
+	 */
+	void track(QObject *dependency);
+
+	/**
+	 * @brief Stop recording setter calls with @p dependency and forget already recorded ones.
+	 */
+	void untrack(QObject *dependency);
+
+	/**
+	 * @return true if setter calls with @p dependency are recorded
+	 */
+	bool is_tracked(QObject *dependency) const;
+
+	/**
+	 * @brief Record that @p setter was called on @p dependent with @p dependency.
+	 * @pre dependent != nullptr
+	 *
+	 * Nothing is recorded if @p dependency is not tracked.
+	 */
+	void add(QObject *dependency, QObject *dependent_object, const setter_method &setter);
+
+	/**
+	 * @brief Move tracking and all recorded calls from @p from to @p to.
+	 * @return all recorded calls with @p from on objects that still exist
+	 * @pre is_tracked(from)
+	 * @pre to != nullptr
+	 *
+	 * Caller is expected to call returned setters with @p to.
+	 */
+	std::vector<dependent> rebind(QObject *from, QObject *to);
+
+private:
+	std::map<QObject *, std::vector<dependent>> _dependents;
+
+};
+
+}}
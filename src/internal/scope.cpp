@@ -0,0 +1,98 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "scope.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace injeqt { namespace internal {
+
+scope::scope()
+{
+}
+
+scope::~scope()
+{
+}
+
+QObject * scope::get(const type &interface_type) const
+{
+	auto implementation_it = _implementations.get(interface_type);
+	return implementation_it != end(_implementations)
+		? implementation_it->object()
+		: nullptr;
+}
+
+void scope::add(std::unique_ptr<QObject> object, const std::vector<implementation> &object_implementations)
+{
+	assert(object);
+
+	for (auto &&i : object_implementations)
+	{
+		assert(i.object() == object.get());
+		_implementations.add(i);
+	}
+	_objects.push_back(std::move(object));
+}
+
+void scope::mark_resolved(QObject *object)
+{
+	_resolved_objects.push_back(object);
+}
+
+const std::vector<QObject *> & scope::resolved_objects() const
+{
+	return _resolved_objects;
+}
+
+std::unique_ptr<QObject> scope::remove(QObject *object)
+{
+	assert(object);
+
+	auto object_it = std::find_if(std::begin(_objects), std::end(_objects), [object](const std::unique_ptr<QObject> &o){ return o.get() == object; });
+	assert(object_it != std::end(_objects));
+
+	auto result = std::move(*object_it);
+	_objects.erase(object_it);
+	_resolved_objects.erase(std::remove(std::begin(_resolved_objects), std::end(_resolved_objects), object), std::end(_resolved_objects));
+
+	auto implementations_left = std::vector<implementation>{};
+	std::copy_if(std::begin(_implementations), std::end(_implementations), std::back_inserter(implementations_left),
+		[object](const implementation &i){ return i.object() != object; });
+	_implementations = implementations{implementations_left};
+
+	return result;
+}
+
+std::vector<std::unique_ptr<QObject>>::size_type scope::size() const
+{
+	return _objects.size();
+}
+
+void scope::clear()
+{
+	_resolved_objects.clear();
+	_implementations.clear();
+	_objects.clear();
+}
+
+}}
@@ -0,0 +1,113 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include "implementations.h"
+#include "internal.h"
+
+#include <memory>
+#include <vector>
+#include <QtCore/QObject>
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing scope of objects.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Table of objects created inside one scope.
+ * @see injector::enter_scope()
+ *
+ * Scope owns all objects added to it and keeps them in one compact table - objects in creation order and
+ * implementations sorted by interface type for lookups. Objects are not destroyed one by one - all of them
+ * are destroyed in one pass when scope is cleared or destroyed.
+ *
+ * Scope does not call INJEQT_DONE methods. Injector core calls them on all resolved_objects() before
+ * scope is cleared.
+ */
+class INJEQT_INTERNAL_API scope final
+{
+
+public:
+	scope();
+	~scope();
+
+	scope(const scope &) = delete;
+	scope(scope &&) = default;
+
+	scope & operator = (const scope &) = delete;
+	scope & operator = (scope &&) = default;
+
+	/**
+	 * @return object available under @p interface_type or nullptr if there is no such object in scope
+	 */
+	QObject * get(const type &interface_type) const;
+
+	/**
+	 * @brief Take ownership of @p object and make it available under types from @p object_implementations.
+	 * @pre object != nullptr
+	 * @pre each item from @p object_implementations has object() equal to @p object
+	 */
+	void add(std::unique_ptr<QObject> object, const std::vector<implementation> &object_implementations);
+
+	/**
+	 * @brief Mark @p object as resolved - with all dependencies set and INJEQT_INIT methods called.
+	 * @pre @p object was added to this scope
+	 */
+	void mark_resolved(QObject *object);
+
+	/**
+	 * @return all resolved objects in order of resolving
+	 */
+	const std::vector<QObject *> & resolved_objects() const;
+
+	/**
+	 * @brief Remove @p object from scope without destroying other objects.
+	 * @return removed object, owned by caller
+	 * @pre @p object was added to this scope
+	 *
+	 * All implementations of @p object are removed as well.
+	 */
+	std::unique_ptr<QObject> remove(QObject *object);
+
+	/**
+	 * @return number of objects owned by scope
+	 */
+	std::vector<std::unique_ptr<QObject>>::size_type size() const;
+
+	/**
+	 * @brief Destroy all objects in one pass.
+	 */
+	void clear();
+
+private:
+	implementations _implementations;
+	std::vector<std::unique_ptr<QObject>> _objects;
+	std::vector<QObject *> _resolved_objects;
+
+};
+
+}}
@@ -24,8 +24,12 @@
 #include <injeqt/type.h>
 
 #include "interfaces-utils.h"
+#include "probes.h"
+#include "type-name.h"
 
 #include <cassert>
+#include <QtCore/QMetaClassInfo>
+#include <QtCore/QMetaObject>
 
 namespace injeqt { namespace internal {
 
@@ -34,7 +38,21 @@ bool setter_method::is_setter_tag(const std::string &tag)
 	return tag == "INJEQT_SET" || tag == "INJEQT_SETTER";
 }
 
+std::string setter_method::qualifier_of(const QMetaObject *meta_object, const QMetaMethod &setter)
+{
+	auto class_info_name = std::string{INJEQT_NAMED_CLASSINFO_PREFIX} + setter.name().data();
+	auto class_info_index = meta_object->indexOfClassInfo(class_info_name.c_str());
+	return class_info_index >= 0
+		? std::string{meta_object->classInfo(class_info_index).value()}
+		: std::string{};
+}
+
 bool setter_method::validate_setter_method(type parameter_type, const QMetaMethod &meta_method)
+{
+	return validate_setter_method(std::move(parameter_type), meta_method, std::string{});
+}
+
+bool setter_method::validate_setter_method(type parameter_type, const QMetaMethod &meta_method, const std::string &qualifier)
 {
 	auto meta_object = meta_method.enclosingMetaObject();
 	if (!meta_object)
@@ -51,21 +69,37 @@ bool setter_method::validate_setter_method(type parameter_type, const QMetaMetho
 		throw exception::invalid_setter{std::string{"invalid parameter (empty): "} + meta_object->className() + "::" + meta_method.methodSignature().data()};
 	if (parameter_type.is_empty())
 		throw exception::invalid_setter{std::string{"invalid parameter (qobject): "} + meta_object->className() + "::" + meta_method.methodSignature().data()};
-	if (parameter_type.name() + "*" != std::string{meta_method.parameterTypes()[0].data()})
+	auto parameter_type_name = std::string{meta_method.parameterTypes()[0].data()};
+	auto wrapped_name = lazy_type_name(parameter_type_name);
+	if (wrapped_name.empty())
+		wrapped_name = set_type_name(parameter_type_name);
+	if (wrapped_name.empty() ? !is_pointer_name_of(parameter_type_name, parameter_type) : name_of(parameter_type) != wrapped_name)
 		throw exception::invalid_setter{std::string{"invalid parameter (type): "} + meta_object->className() + "::" + meta_method.methodSignature().data()};
+	if (!qualifier.empty() && !wrapped_name.empty())
+		throw exception::invalid_setter{std::string{"named setter must accept plain pointer: "} + meta_object->className() + "::" + meta_method.methodSignature().data()};
 	return true;
 }
 
-setter_method::setter_method()
+setter_method::setter_method() :
+	_is_lazy{false},
+	_is_set{false}
 {
 }
 
 setter_method::setter_method(type parameter_type, QMetaMethod meta_method) :
+	setter_method{std::move(parameter_type), std::move(meta_method), std::string{}}
+{
+}
+
+setter_method::setter_method(type parameter_type, QMetaMethod meta_method, std::string qualifier) :
 	_object_type{meta_method.enclosingMetaObject()},
 	_parameter_type{std::move(parameter_type)},
-	_meta_method{std::move(meta_method)}
+	_meta_method{std::move(meta_method)},
+	_is_lazy{!lazy_type_name(_meta_method.parameterTypes()[0].data()).empty()},
+	_is_set{!set_type_name(_meta_method.parameterTypes()[0].data()).empty()},
+	_qualifier{std::move(qualifier)}
 {
-	assert(validate_setter_method(parameter_type, meta_method));
+	assert(validate_setter_method(_parameter_type, _meta_method, _qualifier));
 }
 
 bool setter_method::is_empty() const
@@ -93,6 +127,26 @@ std::string setter_method::signature() const
 	return _meta_method.methodSignature().data();
 }
 
+bool setter_method::is_lazy() const
+{
+	return _is_lazy;
+}
+
+bool setter_method::is_set() const
+{
+	return _is_set;
+}
+
+const std::string & setter_method::qualifier() const
+{
+	return _qualifier;
+}
+
+bool setter_method::is_eager() const
+{
+	return !_is_lazy && !_is_set && _qualifier.empty();
+}
+
 bool setter_method::invoke(QObject *on, QObject *parameter) const
 {
 	assert(!is_empty());
@@ -102,9 +156,37 @@ bool setter_method::invoke(QObject *on, QObject *parameter) const
 	assert(!type{parameter->metaObject()}.is_empty());
 	assert(implements(type{parameter->metaObject()}, _parameter_type));
 
+	INJEQT_PROBE3(setter, on, _object_type.c_name(), _parameter_type.c_name());
 	return _meta_method.invoke(on, Q_ARG(QObject *, parameter));
 }
 
+bool setter_method::invoke(QObject *on, const lazy_handle &parameter) const
+{
+	assert(!is_empty());
+	assert(is_lazy());
+	assert(on != nullptr);
+	assert(implements(type{on->metaObject()}, _object_type));
+	assert(!parameter.is_empty());
+	assert(parameter.object_type() == _parameter_type);
+
+	INJEQT_PROBE3(setter, on, _object_type.c_name(), _parameter_type.c_name());
+	// lazy<T> is an alias of lazy_handle, so argument type matches regardless of T
+	return _meta_method.invoke(on, QGenericArgument{_meta_method.parameterTypes()[0].data(), &parameter});
+}
+
+bool setter_method::invoke(QObject *on, const object_set &parameter) const
+{
+	assert(!is_empty());
+	assert(is_set());
+	assert(on != nullptr);
+	assert(implements(type{on->metaObject()}, _object_type));
+	assert(parameter.set_type() == _parameter_type);
+
+	INJEQT_PROBE3(setter, on, _object_type.c_name(), _parameter_type.c_name());
+	// set_of<S> is an alias of object_set, so argument type matches regardless of S
+	return _meta_method.invoke(on, QGenericArgument{_meta_method.parameterTypes()[0].data(), &parameter});
+}
+
 bool operator == (const setter_method &x, const setter_method &y)
 {
 	if (x.object_type() != y.object_type())
@@ -158,12 +240,23 @@ bool operator >= (const setter_method &x, const setter_method &y)
 
 setter_method make_setter_method(const types_by_name &known_types, const QMetaMethod &meta_method)
 {
-	auto parameter_type = meta_method.parameterCount() == 1
-		? type_by_pointer(known_types, meta_method.parameterTypes()[0].data())
-		: type{nullptr};
-	setter_method::validate_setter_method(parameter_type, meta_method);
+	return make_setter_method(known_types, meta_method, std::string{});
+}
 
-	return setter_method{parameter_type, meta_method};
+setter_method make_setter_method(const types_by_name &known_types, const QMetaMethod &meta_method, const std::string &qualifier)
+{
+	auto parameter_type = type{nullptr};
+	if (meta_method.parameterCount() == 1)
+	{
+		auto parameter_type_name = std::string{meta_method.parameterTypes()[0].data()};
+		auto wrapped_name = lazy_type_name(parameter_type_name);
+		if (wrapped_name.empty())
+			wrapped_name = set_type_name(parameter_type_name);
+		parameter_type = type_by_pointer(known_types, wrapped_name.empty() ? parameter_type_name : wrapped_name + "*");
+	}
+	setter_method::validate_setter_method(parameter_type, meta_method, qualifier);
+
+	return setter_method{parameter_type, meta_method, qualifier};
 }
 
 }}
@@ -22,6 +22,8 @@
 
 #include <injeqt/exception/exception.h>
 #include <injeqt/injeqt.h>
+#include <injeqt/lazy.h>
+#include <injeqt/object-set.h>
 #include <injeqt/type.h>
 
 #include "internal.h"
@@ -61,6 +63,15 @@ namespace injeqt { namespace internal {
  *     };
  *
  * Object with setter method must not take ownership of passed object.
+ *
+ * Setter method can also accept injeqt::lazy<T> parameter. Then parameter_type() is T and is_lazy()
+ * returns true. Such setters are invoked with lazy_handle objects.
+ *
+ * Setter method can also accept injeqt::set_of<S> parameter. Then parameter_type() is S and is_set()
+ * returns true. Such setters are invoked with object_set objects.
+ *
+ * Setter method with pointer parameter can be qualified with INJEQT_NAMED class info. Then qualifier()
+ * returns name of binding that must be injected instead of unnamed object of parameter_type().
  */
 class INJEQT_INTERNAL_API setter_method final
 {
@@ -68,8 +79,18 @@ class INJEQT_INTERNAL_API setter_method final
 public:
 	static bool is_setter_tag(const std::string &tag);
 
+	/**
+	 * @return name of binding required by @p setter of class @p meta_object, read from INJEQT_NAMED class info
+	 *
+	 * Empty string is returned for unqualified setters. Class info of @p meta_object and its super classes is
+	 * checked, so setter of super class can be qualified in derived one.
+	 */
+	static std::string qualifier_of(const QMetaObject *meta_object, const QMetaMethod &setter);
+
 	static bool validate_setter_method(type parameter_type, const QMetaMethod &meta_method);
 
+	static bool validate_setter_method(type parameter_type, const QMetaMethod &meta_method, const std::string &qualifier);
+
 	/**
 	 * @brief Create empty setter_method.
 	 */
@@ -84,10 +105,22 @@ public:
 	 * @pre meta_method.parameterCount() == 1
 	 * @pre meta_method.enclosingMetaObject() != nullptr
 	 * @pre !parameter_type.is_empty()
-	 * @pre parameter_type.name() + "*" == std::string{meta_method.parameterTypes()[0].data()}
+	 * @pre parameter_type.name() + "*" == std::string{meta_method.parameterTypes()[0].data()} or
+	 *      parameter_type.name() == lazy_type_name(meta_method.parameterTypes()[0].data()) or
+	 *      parameter_type.name() == set_type_name(meta_method.parameterTypes()[0].data())
 	 */
 	explicit setter_method(type parameter_type, QMetaMethod meta_method);
 
+	/**
+	 * @brief Create object from QMetaMethod definition and name of required binding.
+	 * @param parameter_type Type of parameter of setter @p meta_method
+	 * @param meta_method Qt meta method that should be a setter method
+	 * @param qualifier name of binding required by setter, empty for unqualified setter
+	 * @pre preconditions of setter_method(type, QMetaMethod)
+	 * @pre qualifier.empty() or setter accepts pointer parameter
+	 */
+	explicit setter_method(type parameter_type, QMetaMethod meta_method, std::string qualifier);
+
 	/**
 	 * @return true if setter_method is empty and does not represent valie setter method
 	 */
@@ -121,6 +154,28 @@ public:
 	 */
 	std::string signature() const;
 
+	/**
+	 * @return true if setter method accepts injeqt::lazy<T> parameter
+	 */
+	bool is_lazy() const;
+
+	/**
+	 * @return true if setter method accepts injeqt::set_of<S> parameter
+	 */
+	bool is_set() const;
+
+	/**
+	 * @return name of binding required by setter method, empty if setter is not qualified
+	 */
+	const std::string & qualifier() const;
+
+	/**
+	 * @return true if setter accepts unnamed object created together with its owner
+	 *
+	 * Lazy, set and qualified setters are not eager - these are injected one by one after owner is created.
+	 */
+	bool is_eager() const;
+
 	/**
 	 * @param on object to call this method on
 	 * @param parameter parmeter to be passed in invocation
@@ -139,10 +194,38 @@ public:
 	 */
 	bool invoke(QObject *on, QObject *parameter) const;
 
+	/**
+	 * @param on object to call this method on
+	 * @param parameter lazy handle to be passed in invocation
+	 * @return true if invoke was successfull
+	 * @pre !is_empty()
+	 * @pre is_lazy()
+	 * @pre on != nullptr
+	 * @pre type{on->metaObject()} == object_type()
+	 * @pre !parameter.is_empty()
+	 * @pre parameter.object_type() == parameter_type()
+	 */
+	bool invoke(QObject *on, const lazy_handle &parameter) const;
+
+	/**
+	 * @param on object to call this method on
+	 * @param parameter set to be passed in invocation
+	 * @return true if invoke was successfull
+	 * @pre !is_empty()
+	 * @pre is_set()
+	 * @pre on != nullptr
+	 * @pre type{on->metaObject()} == object_type()
+	 * @pre parameter.set_type() == parameter_type()
+	 */
+	bool invoke(QObject *on, const object_set &parameter) const;
+
 private:
 	type _object_type;
 	type _parameter_type;
 	QMetaMethod _meta_method;
+	bool _is_lazy;
+	bool _is_set;
+	std::string _qualifier;
 
 };
 
@@ -155,4 +238,6 @@ INJEQT_INTERNAL_API bool operator >= (const setter_method &x, const setter_metho
 
 INJEQT_INTERNAL_API setter_method make_setter_method(const types_by_name &known_types, const QMetaMethod &meta_method);
 
+INJEQT_INTERNAL_API setter_method make_setter_method(const types_by_name &known_types, const QMetaMethod &meta_method, const std::string &qualifier);
+
 }}
@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <vector>
 
 namespace injeqt { namespace internal {
@@ -154,6 +155,40 @@ public:
 		_content = std::move(result);
 	}
 
+	/**
+	 * @short Merge with another sorted vector, moving its items.
+	 * @param sorted_vector vector to merge with
+	 *
+	 * Works like merge(const type &), but can be used for move-only items.
+	 */
+	void merge(type &&sorted_vector)
+	{
+		auto result = storage_type{};
+
+		std::merge(std::make_move_iterator(std::begin(_content)), std::make_move_iterator(std::end(_content)),
+			std::make_move_iterator(std::begin(sorted_vector._content)), std::make_move_iterator(std::end(sorted_vector._content)),
+			std::back_inserter(result), compare_keys);
+		ensure_unique(result);
+
+		_content = std::move(result);
+		sorted_vector._content.clear();
+	}
+
+	/**
+	 * @short Remove item with key @p k.
+	 * @param k key of item to remove
+	 * @return true if item was removed
+	 */
+	bool remove(const key_type &k)
+	{
+		auto lower_bound = std::lower_bound(std::begin(_content), std::end(_content), k, compare_with_key);
+		if (lower_bound == std::end(_content) || !(KeyExtractor(*lower_bound) == k))
+			return false;
+
+		_content.erase(lower_bound);
+		return true;
+	}
+
 	/**
 	 * @return Data stored in sorted vector.
 	 */
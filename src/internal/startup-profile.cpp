@@ -0,0 +1,121 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "startup-profile.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace injeqt { namespace internal {
+
+namespace {
+
+const auto header = std::string{"injeqt-startup-profile 1"};
+
+}
+
+bool operator == (const startup_profile_entry &x, const startup_profile_entry &y)
+{
+	return x.type_name == y.type_name && x.offset == y.offset && x.critical == y.critical;
+}
+
+bool operator != (const startup_profile_entry &x, const startup_profile_entry &y)
+{
+	return !(x == y);
+}
+
+startup_profile::startup_profile() :
+	_recording_duration{0}
+{
+}
+
+void startup_profile::start_recording(std::chrono::milliseconds duration)
+{
+	_entries.clear();
+	_recording_start = std::chrono::steady_clock::now();
+	_recording_duration = duration;
+}
+
+bool startup_profile::is_recording() const
+{
+	return _recording_duration.count() > 0 && std::chrono::steady_clock::now() - _recording_start < _recording_duration;
+}
+
+void startup_profile::record(const std::string &type_name, bool critical)
+{
+	if (!is_recording())
+		return;
+
+	auto recorded = std::any_of(std::begin(_entries), std::end(_entries),
+		[&type_name](const startup_profile_entry &e){ return e.type_name == type_name; });
+	if (recorded)
+		return;
+
+	auto offset = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _recording_start);
+	_entries.push_back(startup_profile_entry{type_name, offset, critical});
+}
+
+const std::vector<startup_profile_entry> & startup_profile::entries() const
+{
+	return _entries;
+}
+
+bool startup_profile::save(const std::string &file_name) const
+{
+	std::ofstream file{file_name, std::ios::trunc};
+	if (!file)
+		return false;
+
+	file << header << "\n";
+	for (auto &&e : _entries)
+		file << e.offset.count() << " " << (e.critical ? 1 : 0) << " " << e.type_name << "\n";
+
+	file.close();
+	return !file.fail();
+}
+
+bool startup_profile::load(const std::string &file_name)
+{
+	std::ifstream file{file_name};
+	auto line = std::string{};
+	if (!file || !std::getline(file, line) || line != header)
+		return false;
+
+	auto entries = std::vector<startup_profile_entry>{};
+	while (std::getline(file, line))
+	{
+		if (line.empty())
+			continue;
+
+		std::istringstream stream{line};
+		auto offset = std::chrono::milliseconds::rep{};
+		auto critical = 0;
+		auto type_name = std::string{};
+		if (!(stream >> offset >> critical >> type_name) || (critical != 0 && critical != 1))
+			return false;
+		entries.push_back(startup_profile_entry{type_name, std::chrono::milliseconds{offset}, critical == 1});
+	}
+
+	_entries = std::move(entries);
+	return true;
+}
+
+}}
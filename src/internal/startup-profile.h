@@ -0,0 +1,127 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+
+#include "internal.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * @brief Contains classes and functions for recording and storing order of first use of types.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Entry of startup_profile.
+ */
+struct startup_profile_entry
+{
+	/**
+	 * @brief Name of requested type.
+	 */
+	std::string type_name;
+
+	/**
+	 * @brief Time of first request, counted from start of recording.
+	 */
+	std::chrono::milliseconds offset;
+
+	/**
+	 * @brief True if caller was blocked by request.
+	 */
+	bool critical;
+};
+
+INJEQT_INTERNAL_API bool operator == (const startup_profile_entry &x, const startup_profile_entry &y);
+INJEQT_INTERNAL_API bool operator != (const startup_profile_entry &x, const startup_profile_entry &y);
+
+/**
+ * @brief List of types in order of first use during startup.
+ *
+ * Profile is filled by calls to record(const std::string &, bool) after start_recording(std::chrono::milliseconds)
+ * was called. Only first request of each type is recorded and only requests made in recording window are
+ * recorded at all.
+ *
+ * Profile can be saved to and loaded from small text file. First line of file is a header with version of
+ * format, then each line contains offset in milliseconds, 1 or 0 for critical flag and name of type,
+ * separated by spaces.
+ */
+class INJEQT_INTERNAL_API startup_profile final
+{
+
+public:
+	/**
+	 * @brief Create empty profile that is not recording.
+	 */
+	startup_profile();
+
+	/**
+	 * @brief Start recording for @p duration from now.
+	 *
+	 * Already recorded entries are removed.
+	 */
+	void start_recording(std::chrono::milliseconds duration);
+
+	/**
+	 * @return true if recording window is not over yet
+	 */
+	bool is_recording() const;
+
+	/**
+	 * @brief Record request of type @p type_name.
+	 * @param type_name name of requested type
+	 * @param critical true if caller was blocked by request
+	 *
+	 * Request is ignored if recording window is over or if @p type_name was already recorded.
+	 */
+	void record(const std::string &type_name, bool critical);
+
+	/**
+	 * @return list of recorded entries in order of recording
+	 */
+	const std::vector<startup_profile_entry> & entries() const;
+
+	/**
+	 * @brief Save profile to @p file_name.
+	 * @return false if file could not be written
+	 */
+	bool save(const std::string &file_name) const;
+
+	/**
+	 * @brief Replace entries of this profile with these from @p file_name.
+	 * @return false if file could not be read or has invalid format, then profile is not changed
+	 */
+	bool load(const std::string &file_name);
+
+private:
+	std::vector<startup_profile_entry> _entries;
+	std::chrono::steady_clock::time_point _recording_start;
+	std::chrono::milliseconds _recording_duration;
+
+};
+
+}}
@@ -0,0 +1,143 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "thread-invoke.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QEvent>
+#include <QtCore/QObject>
+#include <QtCore/QThread>
+
+namespace injeqt { namespace internal {
+
+namespace {
+
+QEvent::Type invoke_event_type()
+{
+	static auto result = static_cast<QEvent::Type>(QEvent::registerEventType());
+	return result;
+}
+
+struct invocation
+{
+	explicit invocation(const std::function<void()> &f) :
+		function{f},
+		started{false},
+		finished{false},
+		abandoned{false}
+	{
+	}
+
+	const std::function<void()> &function;
+	std::mutex mutex;
+	std::condition_variable finished_condition;
+	std::exception_ptr error;
+	bool started;
+	bool finished;
+	bool abandoned;
+};
+
+class invoke_receiver final : public QObject
+{
+
+public:
+	explicit invoke_receiver(std::shared_ptr<invocation> i) :
+		_invocation{std::move(i)}
+	{
+	}
+
+	virtual bool event(QEvent *e) override
+	{
+		if (e->type() != invoke_event_type())
+			return QObject::event(e);
+
+		{
+			std::lock_guard<std::mutex> lock{_invocation->mutex};
+			if (_invocation->abandoned)
+			{
+				// caller already invoked function itself, it may not exist anymore
+				deleteLater();
+				return true;
+			}
+			_invocation->started = true;
+		}
+
+		auto error = std::exception_ptr{};
+		try
+		{
+			_invocation->function();
+		}
+		catch (...)
+		{
+			error = std::current_exception();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock{_invocation->mutex};
+			_invocation->error = error;
+			_invocation->finished = true;
+		}
+		_invocation->finished_condition.notify_all();
+		deleteLater();
+		return true;
+	}
+
+private:
+	std::shared_ptr<invocation> _invocation;
+
+};
+
+}
+
+void invoke_on_thread(QThread *thread, const std::function<void()> &function)
+{
+	if (!thread || thread == QThread::currentThread() || !thread->isRunning())
+	{
+		function();
+		return;
+	}
+
+	auto i = std::make_shared<invocation>(function);
+	auto receiver = new invoke_receiver{i};
+	receiver->moveToThread(thread);
+	QCoreApplication::postEvent(receiver, new QEvent{invoke_event_type()});
+
+	std::unique_lock<std::mutex> lock{i->mutex};
+	while (!i->finished_condition.wait_for(lock, std::chrono::milliseconds{10}, [&i]{ return i->finished; }))
+		if (!i->started && !thread->isRunning())
+		{
+			// thread finished before processing event, so it will never call function; receiver is left
+			// in that thread and skips function if thread is started again
+			i->abandoned = true;
+			lock.unlock();
+			function();
+			return;
+		}
+
+	if (i->error)
+		std::rethrow_exception(i->error);
+}
+
+}}
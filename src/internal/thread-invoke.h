@@ -0,0 +1,50 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+
+#include "internal.h"
+
+#include <functional>
+
+/**
+ * @file
+ * @brief Contains classes and functions for invoking functions on other threads.
+ */
+
+class QThread;
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Invoke @p function on @p thread and wait until it returns.
+ * @param thread thread to invoke function on
+ * @param function function to invoke
+ * @throw any exception thrown by @p function
+ *
+ * Function is called directly when @p thread is nullptr, is current thread or is not running. In other cases
+ * it is called from event loop of @p thread, so that thread must run an event loop and must not wait for
+ * current thread. If @p thread finishes before it processes the call, function is called directly as well.
+ */
+INJEQT_INTERNAL_API void invoke_on_thread(QThread *thread, const std::function<void()> &function);
+
+}}
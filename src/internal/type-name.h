@@ -0,0 +1,156 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include "internal.h"
+
+#include <cstring>
+#include <string>
+
+/**
+ * @file
+ * @brief Contains classes and functions for comparing names of types without allocations.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Non-owning view of name of type.
+ *
+ * Holds pointer and length of characters owned by someone else - usually by static QMetaObject or by
+ * std::string that lives longer than view. Views are cheap to copy and compare, so they are
+ * used as keys of @see types_by_name.
+ */
+class INJEQT_INTERNAL_API name_view final
+{
+
+public:
+	/**
+	 * @brief Create empty view.
+	 */
+	name_view() :
+		_data{""},
+		_length{0}
+	{
+	}
+
+	/**
+	 * @brief Create view of null-terminated @p data.
+	 */
+	name_view(const char *data) :
+		_data{data},
+		_length{std::strlen(data)}
+	{
+	}
+
+	/**
+	 * @brief Create view of first @p length characters of @p data.
+	 */
+	name_view(const char *data, std::size_t length) :
+		_data{data},
+		_length{length}
+	{
+	}
+
+	/**
+	 * @brief Create view of content of @p data.
+	 * @note @p data must outlive view.
+	 */
+	name_view(const std::string &data) :
+		_data{data.data()},
+		_length{data.length()}
+	{
+	}
+
+	const char * data() const { return _data; }
+	std::size_t length() const { return _length; }
+	bool empty() const { return _length == 0; }
+	char back() const { return _data[_length - 1]; }
+
+	/**
+	 * @return view without last @p count characters
+	 * @pre count <= length()
+	 */
+	name_view drop_back(std::size_t count) const { return name_view{_data, _length - count}; }
+
+	/**
+	 * @return view as std::string - only for messages and other places that need owned copy
+	 */
+	std::string to_string() const { return std::string{_data, _length}; }
+
+	/**
+	 * @return negative, zero or positive value, like std::string::compare
+	 */
+	int compare(const name_view &other) const
+	{
+		auto common = _length < other._length ? _length : other._length;
+		auto result = common == 0 ? 0 : std::memcmp(_data, other._data, common);
+		if (result != 0)
+			return result;
+		return _length < other._length ? -1 : _length > other._length ? 1 : 0;
+	}
+
+private:
+	const char *_data;
+	std::size_t _length;
+
+};
+
+inline bool operator == (const name_view &x, const name_view &y)
+{
+	return x.length() == y.length() && x.compare(y) == 0;
+}
+
+inline bool operator != (const name_view &x, const name_view &y)
+{
+	return !(x == y);
+}
+
+inline bool operator < (const name_view &x, const name_view &y)
+{
+	return x.compare(y) < 0;
+}
+
+/**
+ * @return view of name of @p t, without allocation
+ * @pre !t.is_empty()
+ */
+inline name_view name_of(const type &t)
+{
+	return name_view{t.c_name()};
+}
+
+/**
+ * @return true if @p pointer_name is name of pointer to @p t, like "Foo*" for type Foo
+ * @pre !t.is_empty()
+ *
+ * Pointer spellings are used by Qt meta system to identify parameter and return types of invokable methods.
+ * These are compared with name owned by meta object of @p t in place, so no spelling is built or stored.
+ */
+inline bool is_pointer_name_of(name_view pointer_name, const type &t)
+{
+	return !pointer_name.empty() && pointer_name.back() == '*' && pointer_name.drop_back(1) == name_of(t);
+}
+
+}}
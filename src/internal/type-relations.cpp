@@ -81,7 +81,7 @@ void validate_non_ambiguous(const std::vector<type> &types, const type_relations
 		auto message = std::string{};
 		if (relations.ambiguous().contains(t))
 		{
-			message.append(t.name());
+			message.append(t.c_name());
 			message.append("\n");
 		}
 
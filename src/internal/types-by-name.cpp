@@ -20,20 +20,109 @@
 
 #include "types-by-name.h"
 
+#include <initializer_list>
+#include <QtCore/QMetaMethod>
+#include <QtCore/QMetaObject>
+
 namespace injeqt { namespace internal {
 
-type type_by_pointer(const types_by_name &known_types, const std::string &pointer_name)
+type type_by_pointer(const types_by_name &known_types, name_view pointer_name)
 {
 	if (pointer_name.length() < 2)
 		return type{};
-	if (pointer_name[pointer_name.length() - 1] != '*')
+	if (pointer_name.back() != '*')
 		return type{};
-	auto name = pointer_name.substr(0, pointer_name.length() - 1);
-	auto item = known_types.get(name);
+	auto item = known_types.get(pointer_name.drop_back(1));
 	if (item == std::end(known_types))
 		return type{};
 	else
 		return *item;
 }
 
+namespace {
+
+std::string template_argument_name(const std::string &parameter_type_name, std::initializer_list<const char *> prefixes)
+{
+	auto prefix_length = std::string::size_type{0};
+	for (auto &&prefix : prefixes)
+		if (parameter_type_name.compare(0, std::char_traits<char>::length(prefix), prefix) == 0)
+		{
+			prefix_length = std::char_traits<char>::length(prefix);
+			break;
+		}
+
+	if (prefix_length == 0 || parameter_type_name.length() < prefix_length + 2 || parameter_type_name.back() != '>')
+		return {};
+	return parameter_type_name.substr(prefix_length, parameter_type_name.length() - prefix_length - 1);
+}
+
+}
+
+std::string lazy_type_name(const std::string &parameter_type_name)
+{
+	return template_argument_name(parameter_type_name, {"injeqt::v1::lazy<", "injeqt::lazy<", "v1::lazy<", "lazy<"});
+}
+
+std::string set_type_name(const std::string &parameter_type_name)
+{
+	return template_argument_name(parameter_type_name, {"injeqt::v1::set_of<", "injeqt::set_of<", "v1::set_of<", "set_of<"});
+}
+
+namespace {
+
+void add_referenced_type(std::vector<type> &result, const std::string &parameter_type_name, const types_by_name &known_types,
+	const std::vector<const types_by_name *> &super_known_types)
+{
+	auto wrapped_name = lazy_type_name(parameter_type_name);
+	if (wrapped_name.empty())
+		wrapped_name = set_type_name(parameter_type_name);
+	auto pointer_name = wrapped_name.empty()
+		? parameter_type_name
+		: wrapped_name + "*";
+	if (!type_by_pointer(known_types, pointer_name).is_empty())
+		return;
+
+	for (auto &&super_known : super_known_types)
+	{
+		auto referenced = type_by_pointer(*super_known, pointer_name);
+		if (!referenced.is_empty())
+		{
+			result.push_back(referenced);
+			return;
+		}
+	}
+}
+
+void add_referenced_types(std::vector<type> &result, const QMetaMethod &method, const types_by_name &known_types,
+	const std::vector<const types_by_name *> &super_known_types)
+{
+	if (method.methodType() != QMetaMethod::Constructor)
+		add_referenced_type(result, method.typeName(), known_types, super_known_types);
+	for (auto &&parameter_type : method.parameterTypes())
+		add_referenced_type(result, parameter_type.data(), known_types, super_known_types);
+}
+
+}
+
+std::vector<type> referenced_types(const std::vector<type> &for_types, const types_by_name &known_types,
+	const std::vector<const types_by_name *> &super_known_types)
+{
+	auto result = std::vector<type>{};
+	if (super_known_types.empty())
+		return result;
+
+	for (auto &&for_type : for_types)
+	{
+		auto meta_object = for_type.meta_object();
+		auto method_count = meta_object->methodCount();
+		for (decltype(method_count) i = 0; i < method_count; i++)
+			add_referenced_types(result, meta_object->method(i), known_types, super_known_types);
+		auto constructor_count = meta_object->constructorCount();
+		for (decltype(constructor_count) i = 0; i < constructor_count; i++)
+			add_referenced_types(result, meta_object->constructor(i), known_types, super_known_types);
+	}
+
+	return result;
+}
+
 }}
@@ -26,16 +26,45 @@
 #include "internal.h"
 
 #include "sorted-unique-vector.h"
+#include "type-name.h"
+
+#include <vector>
 
 namespace injeqt { namespace internal {
 
-inline std::string name_from_type(const type &t)
+inline name_view name_from_type(const type &t)
 {
-	return t.name();
+	return name_of(t);
 }
 
-using types_by_name = sorted_unique_vector<std::string, type, name_from_type>;
+using types_by_name = sorted_unique_vector<name_view, type, name_from_type>;
+
+INJEQT_INTERNAL_API type type_by_pointer(const types_by_name &known_types, name_view pointer_name);
+
+/**
+ * @return name of type T if @p parameter_type_name is name of injeqt::lazy<T> type, empty string otherwise
+ *
+ * Accepts names with and without injeqt:: and injeqt::v1:: namespace prefixes.
+ */
+INJEQT_INTERNAL_API std::string lazy_type_name(const std::string &parameter_type_name);
+
+/**
+ * @return name of type S if @p parameter_type_name is name of injeqt::set_of<S> type, empty string otherwise
+ *
+ * Accepts names with and without injeqt:: and injeqt::v1:: namespace prefixes.
+ */
+INJEQT_INTERNAL_API std::string set_type_name(const std::string &parameter_type_name);
 
-INJEQT_INTERNAL_API type type_by_pointer(const types_by_name &known_types, const std::string &pointer_name);
+/**
+ * @brief Return types from @p super_known_types that are used as pointer parameters or return values in @p for_types.
+ * @param for_types types to scan for invokable methods and constructors
+ * @param known_types types already known, these are not looked up in @p super_known_types
+ * @param super_known_types known types of super injectors
+ *
+ * Used by sub injectors to extend own set of known types with only these types of super injectors that
+ * its own types refer to, without copying whole sets of known types of super injectors.
+ */
+INJEQT_INTERNAL_API std::vector<type> referenced_types(const std::vector<type> &for_types, const types_by_name &known_types,
+	const std::vector<const types_by_name *> &super_known_types);
 
 }}
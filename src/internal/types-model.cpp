@@ -23,9 +23,13 @@
 #include <injeqt/exception/ambiguous-types.h>
 #include <injeqt/exception/unresolvable-dependencies.h>
 
+#include "analysis-threads.h"
+#include "containers.h"
 #include "type-relations.h"
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 
 namespace injeqt { namespace internal {
 
@@ -39,6 +43,15 @@ types_model::types_model(implemented_by_mapping available_types, types_dependenc
 {
 }
 
+types_model::types_model(implemented_by_mapping available_types, types_dependencies mapped_dependencies,
+		types ambiguous_types, std::vector<const types_model *> super_models) :
+	_available_types{std::move(available_types)},
+	_mapped_dependencies{std::move(mapped_dependencies)},
+	_ambiguous_types{std::move(ambiguous_types)},
+	_super_models{std::move(super_models)}
+{
+}
+
 const implemented_by_mapping & types_model::available_types() const
 {
 	return _available_types;
@@ -49,9 +62,61 @@ const types_dependencies & types_model::mapped_dependencies() const
 	return _mapped_dependencies;
 }
 
+const types & types_model::ambiguous_types() const
+{
+	return _ambiguous_types;
+}
+
+const std::vector<const types_model *> & types_model::super_models() const
+{
+	return _super_models;
+}
+
 bool types_model::contains(const type &interface_type) const
 {
-	return _available_types.get(interface_type) != end(_available_types);
+	return owner_of(interface_type) != nullptr;
+}
+
+bool types_model::knows(const type &interface_type) const
+{
+	if (_available_types.contains_key(interface_type) || _ambiguous_types.contains_key(interface_type))
+		return true;
+
+	for (auto &&super_model : _super_models)
+		if (super_model->knows(interface_type))
+			return true;
+
+	return false;
+}
+
+type types_model::implementation_type(const type &interface_type) const
+{
+	auto owner = owner_of(interface_type);
+	return owner
+		? owner->_available_types.get(interface_type)->implementation_type()
+		: type{};
+}
+
+const types_model * types_model::owner_of(const type &interface_type) const
+{
+	if (_available_types.contains_key(interface_type))
+		return this;
+	if (_super_models.empty() || _ambiguous_types.contains_key(interface_type))
+		return nullptr;
+
+	auto result = static_cast<const types_model *>(nullptr);
+	for (auto &&super_model : _super_models)
+	{
+		auto owner = super_model->owner_of(interface_type);
+		if (!owner)
+			continue;
+		// interface available in more than one unrelated super model is ambiguous
+		if (result && result != owner)
+			return nullptr;
+		result = owner;
+	}
+
+	return result;
 }
 
 std::vector<dependency> types_model::get_unresolvable_dependencies() const
@@ -59,28 +124,103 @@ std::vector<dependency> types_model::get_unresolvable_dependencies() const
 	auto result = std::vector<dependency>{};
 	for (auto &&mapped_type_dependency : _mapped_dependencies)
 		for (auto &&dependency : mapped_type_dependency.dependency_list())
-			if (!contains(dependency.required_type()))
+			// sets can be empty and named bindings are checked by injector_core, so their types do not have to be available
+			if (!dependency.setter().is_set() && dependency.setter().qualifier().empty() && !contains(dependency.required_type()))
 				result.push_back(dependency);
 	return result;
 }
 
 types_model make_types_model(const types_by_name &known_types, const std::vector<type> &all_types, const std::vector<type> &need_dependencies)
+{
+	return make_types_model(known_types, all_types, need_dependencies, std::vector<const types_model *>{});
+}
+
+namespace {
+
+std::vector<type_dependencies> make_all_dependencies(const types_by_name &known_types, const std::vector<type> &need_dependencies)
+{
+	// each type is analyzed independently using only read-only meta object data
+	auto make_dependencies = std::function<type_dependencies(const type &)>{[&](const type &t){ return make_type_dependencies(known_types, t); }};
+	return parallel_transform(need_dependencies, make_dependencies, analysis_thread_count());
+}
+
+}
+
+types_model make_types_model(const std::vector<type> &all_types, const std::vector<type_dependencies> &all_dependencies,
+	const std::vector<const types_model *> &super_models, bool validate)
 {
 	auto relations = make_type_relations(all_types);
-	validate_non_ambiguous(all_types, relations);
+	if (validate)
+		validate_non_ambiguous(all_types, relations);
 
-	auto all_dependencies = std::vector<type_dependencies>{};
-	std::transform(std::begin(need_dependencies), std::end(need_dependencies), std::back_inserter(all_dependencies),
-		[&](const type &t){ return make_type_dependencies(known_types, t); });
+	auto unique = std::vector<implemented_by>{};
+	auto ambiguous = relations.ambiguous().content();
+	for (auto &&i : relations.unique())
+	{
+		auto known_in_super = std::any_of(std::begin(super_models), std::end(super_models),
+			[&](const types_model *super_model){ return super_model->knows(i.interface_type()); });
+		if (!known_in_super)
+		{
+			unique.push_back(i);
+			continue;
+		}
+
+		// configured type or its interface configured in super injector
+		auto is_configured = i.interface_type() == i.implementation_type() || std::any_of(std::begin(super_models), std::end(super_models),
+			[&](const types_model *super_model){ return super_model->implementation_type(i.interface_type()) == i.interface_type(); });
+		if (validate && is_configured)
+			throw exception::ambiguous_types{std::string{i.interface_type().c_name()} + "\n"};
+
+		ambiguous.push_back(i.interface_type());
+	}
 
-	auto available_types = relations.unique();
+	auto available_types = implemented_by_mapping{unique};
 	auto mapped_dependencies = types_dependencies{all_dependencies};
-	auto result = types_model(available_types, mapped_dependencies);
-	validate_non_unresolvable(result);
+	auto result = types_model(available_types, mapped_dependencies, types{ambiguous}, super_models);
+	if (validate)
+		validate_non_unresolvable(result);
 
 	return result;
 }
 
+types_model make_types_model(const types_by_name &known_types, const std::vector<type> &all_types, const std::vector<type> &need_dependencies,
+	const std::vector<const types_model *> &super_models)
+{
+	return make_types_model(all_types, make_all_dependencies(known_types, need_dependencies), super_models, true);
+}
+
+types_model make_unvalidated_types_model(const types_by_name &known_types, const std::vector<type> &all_types, const std::vector<type> &need_dependencies,
+	const std::vector<const types_model *> &super_models)
+{
+	return make_types_model(all_types, make_all_dependencies(known_types, need_dependencies), super_models, false);
+}
+
+types_model extend_types_model(const types_model &model, const types_by_name &known_types, const std::vector<type> &all_types,
+	const std::vector<type> &need_dependencies)
+{
+	return extend_types_model(model, all_types, make_all_dependencies(known_types, need_dependencies));
+}
+
+types_model extend_types_model(const types_model &model, const std::vector<type> &all_types,
+	std::vector<type_dependencies> new_dependencies)
+{
+	auto all_dependencies = std::move(new_dependencies);
+	std::copy(std::begin(model.mapped_dependencies()), std::end(model.mapped_dependencies()), std::back_inserter(all_dependencies));
+
+	return make_types_model(all_types, all_dependencies, model.super_models(), true);
+}
+
+types_model reduce_types_model(const types_model &model, const std::vector<type> &all_types,
+	const std::vector<type> &need_dependencies)
+{
+	auto kept = types{need_dependencies};
+	auto all_dependencies = std::vector<type_dependencies>{};
+	std::copy_if(std::begin(model.mapped_dependencies()), std::end(model.mapped_dependencies()), std::back_inserter(all_dependencies),
+		[&kept](const type_dependencies &d){ return kept.contains_key(d.dependent_type()); });
+
+	return make_types_model(all_types, all_dependencies, model.super_models(), true);
+}
+
 void validate_non_unresolvable(const types_model &model)
 {
 	auto unresolvable_dependencies = model.get_unresolvable_dependencies();
@@ -90,7 +230,7 @@ void validate_non_unresolvable(const types_model &model)
 		auto message = std::string{};
 		for (auto &&unresolvable_dependency : unresolvable_dependencies)
 		{
-			message.append(unresolvable_dependency.required_type().name());
+			message.append(unresolvable_dependency.required_type().c_name());
 			message.append(": ");
 			message.append(unresolvable_dependency.setter().signature());
 			message.append("\n");
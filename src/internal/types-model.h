@@ -25,9 +25,12 @@
 
 #include "implemented-by-mapping.h"
 #include "internal.h"
+#include "types.h"
 #include "types-by-name.h"
 #include "types-dependencies.h"
 
+#include <vector>
+
 /**
  * @file
  * @brief Contains classes and functions for representing model of Injeqt types.
@@ -44,6 +47,12 @@ namespace injeqt { namespace internal {
  *
  * Use make_types_model(const std::vector<type> &) to create valid instance of this type
  * and be informed of any errors in form of exceptions.
+ *
+ * Model can be layered on top of models of super injectors. In that case only types configured
+ * in this model are stored in it and all other lookups are forwarded to super models. Super models
+ * are not owned and must outlive this object. Interfaces that are ambiguous in this model (or that are
+ * ambiguous between this model and one of super models) are stored in ambiguous_types() and hide
+ * interfaces with the same type in super models.
  */
 class INJEQT_INTERNAL_API types_model
 {
@@ -64,21 +73,67 @@ public:
 	 */
 	explicit types_model(implemented_by_mapping available_types, types_dependencies mapped_dependencies);
 
+	/**
+	 * @brief Create new instance of types_model layered on top of super models.
+	 * @param available_types set of all interfaces in this model mapped to implementation types
+	 * @param mapped_dependencies set of all dependencies of implementation types in this model
+	 * @param ambiguous_types set of interfaces that are not available in this model nor in any of super models
+	 * @param super_models models used for lookup of types not available in this one, must outlive this object
+	 */
+	explicit types_model(implemented_by_mapping available_types, types_dependencies mapped_dependencies,
+		types ambiguous_types, std::vector<const types_model *> super_models);
+
 	/**
 	 * @return set of all interfaces in model mapped to implementation types.
+	 *
+	 * Interfaces available only in super models are not included.
 	 */
 	const implemented_by_mapping & available_types() const;
 
 	/**
 	 * @return set of all dependencies of implementation types
+	 *
+	 * Dependencies of types from super models are not included.
 	 */
 	const types_dependencies & mapped_dependencies() const;
 
 	/**
-	 * @return true if model contains @p interface_type
+	 * @return set of interfaces that are ambiguous in this model and hide the same interfaces in super models
+	 */
+	const types & ambiguous_types() const;
+
+	/**
+	 * @return list of models this model is layered on
+	 */
+	const std::vector<const types_model *> & super_models() const;
+
+	/**
+	 * @return true if model or exactly one of its super models contains @p interface_type
+	 * @see owner_of(const type &)
 	 */
 	bool contains(const type &interface_type) const;
 
+	/**
+	 * @return true if @p interface_type is available or ambiguous in model or in any of its super models
+	 */
+	bool knows(const type &interface_type) const;
+
+	/**
+	 * @return type implementing @p interface_type in this model or in one of its super models
+	 *
+	 * Empty type is returned if contains(interface_type) is false.
+	 */
+	type implementation_type(const type &interface_type) const;
+
+	/**
+	 * @return model that has @p interface_type in its available_types()
+	 *
+	 * Returns this model, one of super models or one of their super models. Lookup goes through each layer
+	 * only once. Returns nullptr if @p interface_type is hidden by ambiguous_types(), if it is not available
+	 * at all or if it is available in more than one unrelated super model.
+	 */
+	const types_model * owner_of(const type &interface_type) const;
+
 	/**
 	 * @brief Return all unresolvable dependencies
 	 */
@@ -87,6 +142,8 @@ public:
 private:
 	implemented_by_mapping _available_types;
 	types_dependencies _mapped_dependencies;
+	types _ambiguous_types;
+	std::vector<const types_model *> _super_models;
 
 };
 
@@ -107,6 +164,115 @@ private:
  */
 INJEQT_INTERNAL_API types_model make_types_model(const types_by_name &known_types, const std::vector<type> &all_types, const std::vector<type> &need_dependencies);
 
+/**
+ * @brief Create types_model from given set of types layered on top of @p super_models.
+ * @param known_types list of all known types
+ * @param all_types set of types to make model from, all types must be valid.
+ * @param need_dependencies list of types that will have dependencies extracted
+ * @param super_models models of super injectors, must outlive result
+ * @post result.get_unresolvable_dependencies().empty()
+ * @throw ambiguous_types if one or more types is ambiguous (@see make_type_relations)
+ * @throw ambiguous_types if one of types from @p all_types or its interface is configured in super model
+ * @throw unresolvable_dependencies if a type has a dependency type not in @p all_types set nor in @p super_models
+ * @throw dependency_on_self when type depends on self
+ * @throw dependency_on_subtype when type depends on own supertype
+ * @throw dependency_on_subtype when type depends on own subtype
+ * @throw invalid_setter if any tagged setter has parameter that is not a QObject-derived pointer
+ * @throw invalid_setter if any tagged setter has parameter that is a QObject pointer
+ * @throw invalid_setter if any tagged setter has other number of parameters than one
+ *
+ * Cost of this function is proportional to size of @p all_types - super models are only queried
+ * for interfaces of these types. Interfaces shared by types from @p all_types and from super models
+ * are moved to ambiguous_types() of result.
+ */
+INJEQT_INTERNAL_API types_model make_types_model(const types_by_name &known_types, const std::vector<type> &all_types, const std::vector<type> &need_dependencies,
+	const std::vector<const types_model *> &super_models);
+
+/**
+ * @brief Create types_model from given set of types layered on top of @p super_models without validating it.
+ * @param known_types list of all known types
+ * @param all_types set of types to make model from, all types must be valid.
+ * @param need_dependencies list of types that will have dependencies extracted
+ * @param super_models models of super injectors, must outlive result
+ * @throw dependency_on_self when type depends on self
+ * @throw dependency_on_subtype when type depends on own supertype
+ * @throw dependency_on_subtype when type depends on own subtype
+ * @throw invalid_setter if any tagged setter has invalid parameter or parameters count
+ *
+ * Result is the same as of make_types_model(const types_by_name &, const std::vector<type> &, const std::vector<type> &,
+ * const std::vector<const types_model *> &) for valid configuration. Ambiguous and unresolvable types are not looked
+ * for, so it must only be used for configurations that were already validated.
+ */
+INJEQT_INTERNAL_API types_model make_unvalidated_types_model(const types_by_name &known_types, const std::vector<type> &all_types,
+	const std::vector<type> &need_dependencies, const std::vector<const types_model *> &super_models);
+
+/**
+ * @brief Create types_model from given set of types and their already extracted dependencies.
+ * @param all_types set of types to make model from, all types must be valid.
+ * @param all_dependencies dependencies of types that need them, for example extracted from their wiring tables
+ * @param super_models models of super injectors, must outlive result
+ * @param validate false if configuration was already validated
+ * @throw ambiguous_types if @p validate is true and one or more types is ambiguous or configured in super model
+ * @throw unresolvable_dependencies if @p validate is true and a type has a dependency type not in @p all_types set nor in @p super_models
+ *
+ * Result is the same as of make_types_model(const types_by_name &, const std::vector<type> &, const std::vector<type> &,
+ * const std::vector<const types_model *> &), but dependencies are not extracted. This allows caller to reuse meta
+ * object data it already has.
+ */
+INJEQT_INTERNAL_API types_model make_types_model(const std::vector<type> &all_types, const std::vector<type_dependencies> &all_dependencies,
+	const std::vector<const types_model *> &super_models, bool validate);
+
+/**
+ * @brief Create types_model extending @p model with new types.
+ * @param model model to extend
+ * @param known_types list of all known types, including new ones
+ * @param all_types set of types of @p model together with new types, all types must be valid.
+ * @param need_dependencies list of new types that will have dependencies extracted
+ * @post result.get_unresolvable_dependencies().empty()
+ * @throw ambiguous_types if one or more types is ambiguous (@see make_type_relations)
+ * @throw unresolvable_dependencies if new type has unresolvable dependency or if type of @p model depends
+ * on interface that becomes ambiguous
+ * @throw dependency_on_self when type depends on self
+ * @throw dependency_on_subtype when type depends on own supertype
+ * @throw dependency_on_subtype when type depends on own subtype
+ * @throw invalid_setter if any tagged setter has parameter that is not a QObject-derived pointer
+ * @throw invalid_setter if any tagged setter has parameter that is a QObject pointer
+ * @throw invalid_setter if any tagged setter has other number of parameters than one
+ *
+ * Result is the same as of make_types_model(const types_by_name &, const std::vector<type> &, const std::vector<type> &,
+ * const std::vector<const types_model *> &) called with all types, but dependencies are only extracted for
+ * @p need_dependencies - dependencies of types from @p model are reused.
+ */
+INJEQT_INTERNAL_API types_model extend_types_model(const types_model &model, const types_by_name &known_types, const std::vector<type> &all_types,
+	const std::vector<type> &need_dependencies);
+
+/**
+ * @brief Create types_model extending @p model with new types and their already extracted dependencies.
+ * @param model model to extend
+ * @param all_types set of types of @p model together with new types, all types must be valid.
+ * @param new_dependencies dependencies of new types that need them
+ * @see extend_types_model(const types_model &, const types_by_name &, const std::vector<type> &, const std::vector<type> &)
+ *
+ * Throws the same exceptions as extend_types_model(const types_model &, const types_by_name &, const std::vector<type> &,
+ * const std::vector<type> &), but dependencies are not extracted.
+ */
+INJEQT_INTERNAL_API types_model extend_types_model(const types_model &model, const std::vector<type> &all_types,
+	std::vector<type_dependencies> new_dependencies);
+
+/**
+ * @brief Create types_model from @p model with some types removed.
+ * @param model model to reduce
+ * @param all_types set of types of @p model that are left
+ * @param need_dependencies list of types from @p model whose dependencies are kept
+ * @post result.get_unresolvable_dependencies().empty()
+ * @throw unresolvable_dependencies if one of types left depends on removed type
+ *
+ * Dependencies are not extracted again - ones of @p model are reused. Interfaces that were ambiguous
+ * in @p model can become available in result.
+ */
+INJEQT_INTERNAL_API types_model reduce_types_model(const types_model &model, const std::vector<type> &all_types,
+	const std::vector<type> &need_dependencies);
+
 /**
  * @brief Check if types model do not have unresolvable types.
  * @param model model to check
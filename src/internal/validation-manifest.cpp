@@ -0,0 +1,120 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "validation-manifest.h"
+
+#include "interfaces-utils.h"
+#include "provider.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+namespace injeqt { namespace internal {
+
+namespace {
+
+// 64-bit FNV-1a
+std::uint64_t entry_digest(const std::string &entry)
+{
+	auto digest = std::uint64_t{14695981039346656037ull};
+	for (auto c : entry)
+	{
+		digest ^= static_cast<unsigned char>(c);
+		digest *= 1099511628211ull;
+	}
+	return digest;
+}
+
+std::string provider_entry(const provider &p)
+{
+	auto &t = p.provided_type();
+	auto result = t.name();
+	result.append(" ");
+	result.append(p.is_scoped() ? "s" : "-");
+	result.append(p.is_prototype() ? "p" : "-");
+	result.append(p.is_ready() ? "r" : "-");
+	result.append(p.is_default_constructed() ? "d" : "-");
+	result.append(p.require_resolving() ? "R" : "-");
+	result.append(" " + std::to_string(t.meta_object()->methodCount()));
+	result.append(" " + std::to_string(t.meta_object()->constructorCount()));
+
+	auto required_names = std::vector<std::string>{};
+	for (auto &&r : p.required_types())
+		required_names.push_back(r.name());
+	std::sort(std::begin(required_names), std::end(required_names));
+	for (auto &&name : required_names)
+		result.append(" " + name);
+
+	return result;
+}
+
+std::string dependencies_entry(const type_dependencies &d)
+{
+	auto result = "dependencies " + d.dependent_type().name();
+
+	auto interface_names = std::vector<std::string>{};
+	for (auto &&i : extract_interfaces(d.dependent_type()))
+		interface_names.push_back(i.name());
+	std::sort(std::begin(interface_names), std::end(interface_names));
+	for (auto &&name : interface_names)
+		result.append(" " + name);
+
+	// dependencies are ordered by address of meta object of required type, so setters are sorted by text
+	auto setter_entries = std::vector<std::string>{};
+	for (auto &&dependency : d.dependency_list())
+	{
+		auto &setter = dependency.setter();
+		auto setter_entry = std::string{setter.signature()};
+		setter_entry.append(setter.is_lazy() ? " l" : " -");
+		setter_entry.append(setter.is_set() ? "s" : "-");
+		setter_entry.append(" " + setter.qualifier());
+		setter_entries.push_back(setter_entry);
+	}
+	std::sort(std::begin(setter_entries), std::end(setter_entries));
+	for (auto &&setter_entry : setter_entries)
+		result.append(" | " + setter_entry);
+
+	return result;
+}
+
+}
+
+std::string make_validation_manifest(const providers &all_providers, const std::vector<type_dependencies> &all_dependencies,
+	const std::vector<type> &super_types)
+{
+	// types are ordered by address of meta object, which differs between runs, so digests of entries are
+	// added up instead of sorting all entries
+	auto digest = std::uint64_t{0};
+	for (auto &&p : all_providers)
+		digest += entry_digest(provider_entry(*p));
+	for (auto &&d : all_dependencies)
+		digest += entry_digest(dependencies_entry(d));
+	for (auto &&t : super_types)
+		digest += entry_digest(std::string{"super "} + t.c_name());
+
+	static const char hex_digits[] = "0123456789abcdef";
+	auto result = std::string{"injeqt-validation-manifest 3 "};
+	for (auto shift = 60; shift >= 0; shift -= 4)
+		result.push_back(hex_digits[(digest >> shift) & 0xf]);
+	return result;
+}
+
+}}
@@ -0,0 +1,59 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include "internal.h"
+#include "providers.h"
+#include "type-dependencies.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * @brief Contains functions for creating validation manifests of injector configurations.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Return validation manifest of configuration made of @p all_providers with @p all_dependencies on top
+ * of super injectors that provide @p super_types.
+ * @param all_dependencies dependencies of all provided types that require resolving
+ * @see injector::validation_manifest()
+ *
+ * Manifest is a one-line text with version and digest of configuration. Digest is computed from names,
+ * kinds and required types of all providers, from number of methods and constructors of provided types,
+ * from interfaces and setters of types in @p all_dependencies - signature, qualifier and kind of each one -
+ * and from names of @p super_types. Changed setter gives other digest even if class keeps its name and number
+ * of methods. Digest does not depend on order of providers nor on addresses of meta objects, so it is the
+ * same in each run of the same binary.
+ *
+ * Digest is not cryptographic. Manifest only says that configuration was already validated, it does not
+ * protect against intentionally forged files.
+ */
+INJEQT_INTERNAL_API std::string make_validation_manifest(const providers &all_providers, const std::vector<type_dependencies> &all_dependencies,
+	const std::vector<type> &super_types);
+
+}}
@@ -0,0 +1,225 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "wiring-table.h"
+
+#include <injeqt/exception/invalid-action.h>
+
+#include "analysis-threads.h"
+#include "constructor-method.h"
+#include "containers.h"
+#include "setter-method.h"
+#include "types.h"
+
+#include <cassert>
+#include <QtCore/QMetaClassInfo>
+#include <QtCore/QMetaObject>
+
+namespace injeqt { namespace internal {
+
+namespace {
+
+}
+
+wiring_table::wiring_table(const type &for_type) :
+	_for_type{for_type},
+	_injection_constructor_index{-1}
+{
+	assert(!for_type.is_empty());
+
+	auto meta_object = for_type.meta_object();
+	auto method_count = meta_object->methodCount();
+	for (decltype(method_count) i = 0; i < method_count; i++)
+	{
+		auto method = meta_object->method(i);
+		auto tag = method.tag();
+		if (tag && *tag)
+		{
+			auto method_tag = std::string{tag};
+			if (setter_method::is_setter_tag(method_tag))
+			{
+				_setters.push_back(method);
+				_setter_qualifiers.push_back(setter_method::qualifier_of(meta_object, method));
+			}
+			else if (action_method::is_action_init_tag(method_tag))
+				add_action(_init_actions, method);
+			else if (action_method::is_action_done_tag(method_tag))
+				add_action(_done_actions, method);
+			else if (action_method::is_action_reset_tag(method_tag))
+				add_action(_reset_actions, method);
+		}
+		if (method.parameterCount() == 0)
+			_factory_candidates.push_back(method);
+	}
+
+	auto constructor_count = meta_object->constructorCount();
+	for (decltype(constructor_count) i = 0; i < constructor_count; i++)
+	{
+		auto constructor = meta_object->constructor(i);
+		if (constructor.methodType() != QMetaMethod::Constructor)
+			continue;
+		if (constructor.parameterCount() == 0 && !_default_constructor.isValid())
+			_default_constructor = constructor;
+		else if (_injection_constructor_index < 0 && is_injection_constructor(constructor))
+		{
+			_injection_constructor = constructor;
+			_injection_constructor_index = i;
+		}
+	}
+}
+
+void wiring_table::add_action(actions &to, const QMetaMethod &meta_method)
+{
+	try
+	{
+		to.methods.emplace_back(make_action_method(meta_method));
+	}
+	catch (exception::invalid_action &e)
+	{
+		if (to.invalid_action.empty())
+			to.invalid_action = e.what();
+	}
+}
+
+const std::vector<action_method> & wiring_table::valid_actions(const actions &from)
+{
+	if (!from.invalid_action.empty())
+		throw exception::invalid_action{from.invalid_action};
+	return from.methods;
+}
+
+const type & wiring_table::for_type() const
+{
+	return _for_type;
+}
+
+const std::vector<QMetaMethod> & wiring_table::setters() const
+{
+	return _setters;
+}
+
+const std::vector<std::string> & wiring_table::setter_qualifiers() const
+{
+	return _setter_qualifiers;
+}
+
+const std::vector<QMetaMethod> & wiring_table::factory_candidates() const
+{
+	return _factory_candidates;
+}
+
+const QMetaMethod & wiring_table::default_constructor() const
+{
+	return _default_constructor;
+}
+
+const QMetaMethod & wiring_table::injection_constructor() const
+{
+	return _injection_constructor;
+}
+
+int wiring_table::injection_constructor_index() const
+{
+	return _injection_constructor_index;
+}
+
+const std::vector<action_method> & wiring_table::init_actions() const
+{
+	return valid_actions(_init_actions);
+}
+
+const std::vector<action_method> & wiring_table::done_actions() const
+{
+	return valid_actions(_done_actions);
+}
+
+const std::vector<action_method> & wiring_table::reset_actions() const
+{
+	return valid_actions(_reset_actions);
+}
+
+wiring_tables::wiring_tables()
+{
+}
+
+wiring_tables::wiring_tables(const std::vector<type> &for_types)
+{
+	add(for_types);
+}
+
+std::vector<type> wiring_tables::add(const std::vector<type> &for_types)
+{
+	auto missing = std::vector<type>{};
+	for (auto &&for_type : for_types)
+		if (!find(for_type))
+			missing.push_back(for_type);
+	// the same type can be used by many configurations
+	missing = types{missing}.content();
+
+	// each table only reads its own meta object, so these can be built independently
+	auto build_table = std::function<std::unique_ptr<wiring_table>(const type &)>{[](const type &t){
+		assert(!t.is_empty());
+		return std::unique_ptr<wiring_table>{new wiring_table{t}};
+	}};
+	auto tables = parallel_transform(missing, build_table, analysis_thread_count());
+	for (auto &&table : tables)
+	{
+		auto table_type = table->for_type();
+		_tables.emplace(table_type, std::move(table));
+	}
+
+	return missing;
+}
+
+const wiring_table & wiring_tables::at(const type &for_type) const
+{
+	auto table = find(for_type);
+	assert(table);
+	return *table;
+}
+
+const wiring_table * wiring_tables::find(const type &for_type) const
+{
+	auto table_it = _tables.find(for_type);
+	return table_it != std::end(_tables) ? table_it->second.get() : nullptr;
+}
+
+const wiring_table & wiring_tables::table_of(const type &for_type)
+{
+	assert(!for_type.is_empty());
+
+	auto &table = _tables[for_type];
+	if (!table)
+		table.reset(new wiring_table{for_type});
+	return *table;
+}
+
+void wiring_tables::remove(const std::vector<type> &removed_types)
+{
+	for (auto &&removed_type : removed_types)
+		_tables.erase(removed_type);
+}
+
+std::size_t wiring_tables::size() const
+{
+	return _tables.size();
+}
+
+}}
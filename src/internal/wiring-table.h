@@ -0,0 +1,214 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+#include <injeqt/injeqt.h>
+#include <injeqt/type.h>
+
+#include "action-method.h"
+#include "internal.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <QtCore/QMetaMethod>
+
+/**
+ * @file
+ * @brief Contains classes and functions for representing tables of tagged methods of classes.
+ */
+
+namespace injeqt { namespace internal {
+
+/**
+ * @brief Table of methods of one class that are used to wire its objects.
+ * @see wiring_tables
+ *
+ * Table contains setters (methods tagged with INJEQT_SET), actions (methods tagged with INJEQT_INIT, INJEQT_DONE
+ * and INJEQT_RESET), default constructor, injection constructor and candidates for factory methods (methods without parameters).
+ * Methods of all super classes are included in the same order as in QMetaObject. Names required by setters
+ * with INJEQT_NAMED class info are read together with setters.
+ *
+ * Table is built with one pass over QMetaObject. Tables are kept by wiring_tables of each injector, so meta
+ * methods of each class are scanned only once, no matter how many objects of it are created and injected.
+ *
+ * Invalid actions do not prevent building of table. Exception is thrown only when list of actions with
+ * invalid one is requested - the same as when these are extracted with extract_actions(const std::string &,
+ * const type &).
+ */
+class INJEQT_INTERNAL_API wiring_table final
+{
+
+public:
+	/**
+	 * @brief Build table of @p for_type.
+	 * @pre !for_type.is_empty()
+	 */
+	explicit wiring_table(const type &for_type);
+
+	/**
+	 * @return type this table was built for
+	 */
+	const type & for_type() const;
+
+	/**
+	 * @return all methods tagged as setters, not validated
+	 */
+	const std::vector<QMetaMethod> & setters() const;
+
+	/**
+	 * @return names of bindings required by setters, empty for unqualified setters, in the same order as setters()
+	 */
+	const std::vector<std::string> & setter_qualifiers() const;
+
+	/**
+	 * @return all methods without parameters
+	 */
+	const std::vector<QMetaMethod> & factory_candidates() const;
+
+	/**
+	 * @return first constructor without parameters or invalid QMetaMethod if there is none
+	 */
+	const QMetaMethod & default_constructor() const;
+
+	/**
+	 * @return first constructor with only QObject-derived pointer parameters or invalid QMetaMethod if there is none
+	 *
+	 * Constructors with QObject * parameter (like usual parent parameter) are skipped.
+	 */
+	const QMetaMethod & injection_constructor() const;
+
+	/**
+	 * @return index of injection_constructor() in QMetaObject or -1 if there is none
+	 */
+	int injection_constructor_index() const;
+
+	/**
+	 * @return all methods tagged with INJEQT_INIT
+	 * @throw invalid_action if any of these methods is not valid action
+	 */
+	const std::vector<action_method> & init_actions() const;
+
+	/**
+	 * @return all methods tagged with INJEQT_DONE
+	 * @throw invalid_action if any of these methods is not valid action
+	 */
+	const std::vector<action_method> & done_actions() const;
+
+	/**
+	 * @return all methods tagged with INJEQT_RESET
+	 * @throw invalid_action if any of these methods is not valid action
+	 */
+	const std::vector<action_method> & reset_actions() const;
+
+private:
+	struct actions
+	{
+		std::vector<action_method> methods;
+		std::string invalid_action;
+	};
+
+	type _for_type;
+	std::vector<QMetaMethod> _setters;
+	std::vector<std::string> _setter_qualifiers;
+	std::vector<QMetaMethod> _factory_candidates;
+	QMetaMethod _default_constructor;
+	QMetaMethod _injection_constructor;
+	int _injection_constructor_index;
+	actions _init_actions;
+	actions _done_actions;
+	actions _reset_actions;
+
+	static void add_action(actions &to, const QMetaMethod &meta_method);
+	static const std::vector<action_method> & valid_actions(const actions &from);
+
+};
+
+/**
+ * @brief Cache of wiring tables of types used by one injector.
+ *
+ * Tables of all configured types are built once with add(const std::vector<type> &) when injector is created
+ * and then passed to provider configurations and to analysis of dependencies. Tables of other types (like
+ * ones of objects passed to injector::inject_into(QObject *)) are built on first request with table_of(const
+ * type &). Tables are reused until their types are removed. Removing types is required when their meta objects
+ * can be unloaded, for example with module from a plugin.
+ *
+ * This class is not synchronized. Const methods can be called from many threads at once, as long as no
+ * other method is called at the same time.
+ */
+class INJEQT_INTERNAL_API wiring_tables final
+{
+
+public:
+	wiring_tables();
+
+	/**
+	 * @brief Create cache with tables of @p for_types.
+	 */
+	explicit wiring_tables(const std::vector<type> &for_types);
+
+	/**
+	 * @brief Build tables of these of @p for_types that do not have one yet.
+	 * @pre no type in @p for_types is empty
+	 * @return types whose tables were built
+	 *
+	 * Tables are built on analysis threads, see analysis_thread_count().
+	 */
+	std::vector<type> add(const std::vector<type> &for_types);
+
+	/**
+	 * @return table of @p for_type
+	 * @pre table of @p for_type was added
+	 */
+	const wiring_table & at(const type &for_type) const;
+
+	/**
+	 * @return table of @p for_type or nullptr if it was not built yet
+	 */
+	const wiring_table * find(const type &for_type) const;
+
+	/**
+	 * @return table of @p for_type, built on first call
+	 * @pre !for_type.is_empty()
+	 *
+	 * Returned reference is valid until @p for_type is removed or this object is destroyed.
+	 */
+	const wiring_table & table_of(const type &for_type);
+
+	/**
+	 * @brief Remove tables of @p removed_types.
+	 *
+	 * Types without tables are ignored.
+	 */
+	void remove(const std::vector<type> &removed_types);
+
+	/**
+	 * @return number of tables in cache
+	 */
+	std::size_t size() const;
+
+private:
+	std::map<type, std::unique_ptr<wiring_table>> _tables;
+
+};
+
+}}
@@ -0,0 +1,66 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <injeqt/lazy.h>
+
+#include "lazy-state.h"
+
+#include <cassert>
+
+using namespace injeqt::internal;
+
+namespace injeqt { namespace v1 {
+
+lazy_handle::lazy_handle()
+{
+}
+
+lazy_handle::lazy_handle(std::shared_ptr<internal::lazy_state> state) :
+	_state{std::move(state)}
+{
+}
+
+bool lazy_handle::is_empty() const
+{
+	return !_state;
+}
+
+type lazy_handle::object_type() const
+{
+	assert(!is_empty());
+
+	return _state->object_type();
+}
+
+bool lazy_handle::is_resolved() const
+{
+	assert(!is_empty());
+
+	return _state->is_resolved();
+}
+
+QObject * lazy_handle::get() const
+{
+	assert(!is_empty());
+
+	return _state->get();
+}
+
+}}
@@ -20,10 +20,16 @@
 
 #include <injeqt/module.h>
 
+#include <injeqt/exception/interface-not-implemented.h>
+#include <injeqt/exception/qobject-type.h>
+
+#include "interfaces-utils.h"
 #include "module-impl.h"
 #include "provider-by-default-constructor-configuration.h"
 #include "provider-by-factory-configuration.h"
+#include "provider-prototype-configuration.h"
 #include "provider-ready-configuration.h"
+#include "provider-scoped-configuration.h"
 
 #include <QtCore/QMetaObject>
 #include <cassert>
@@ -53,6 +59,48 @@ void module::add_type(type t)
 	_pimpl->add_provider_configuration(std::make_shared<internal::provider_by_default_constructor_configuration>(std::move(t)));
 }
 
+void module::add_ready_object(type t, QObject *object, const std::string &name)
+{
+	assert(!t.is_empty());
+	assert(!name.empty());
+
+	auto binding_type = t;
+	_pimpl->add_named_provider_configuration(internal::named_provider_configuration{std::move(binding_type), name,
+		std::make_shared<internal::provider_ready_configuration>(std::move(t), object)});
+}
+
+void module::add_type(type t, const std::string &name)
+{
+	assert(!t.is_empty());
+	assert(!name.empty());
+
+	auto binding_type = t;
+	_pimpl->add_named_provider_configuration(internal::named_provider_configuration{std::move(binding_type), name,
+		std::make_shared<internal::provider_by_default_constructor_configuration>(std::move(t))});
+}
+
+void module::add_thread_affine_type(type t, QThread *thread)
+{
+	assert(!t.is_empty());
+	assert(thread);
+
+	_pimpl->add_provider_configuration(std::make_shared<internal::provider_by_default_constructor_configuration>(std::move(t), thread));
+}
+
+void module::add_scoped_type(type t)
+{
+	assert(!t.is_empty());
+
+	_pimpl->add_provider_configuration(std::make_shared<internal::provider_scoped_configuration>(std::move(t)));
+}
+
+void module::add_prototype(type t, std::size_t pool_capacity)
+{
+	assert(!t.is_empty());
+
+	_pimpl->add_provider_configuration(std::make_shared<internal::provider_prototype_configuration>(std::move(t), pool_capacity));
+}
+
 void module::add_factory(type t, type f)
 {
 	assert(!t.is_empty());
@@ -61,4 +109,17 @@ void module::add_factory(type t, type f)
 	_pimpl->add_provider_configuration(std::make_shared<internal::provider_by_factory_configuration>(std::move(t), std::move(f)));
 }
 
+void module::add_to_set(type s, type t)
+{
+	assert(!s.is_empty());
+	assert(!t.is_empty());
+
+	if (s.is_qobject())
+		throw exception::qobject_type{};
+	if (!internal::implements(t, s))
+		throw exception::interface_not_implemented{std::string{t.c_name()} + ": " + s.c_name()};
+
+	_pimpl->add_set_member(internal::implemented_by{std::move(s), std::move(t)});
+}
+
 }}
@@ -0,0 +1,84 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <injeqt/object-set.h>
+
+#include <cassert>
+
+namespace injeqt { namespace v1 {
+
+namespace {
+
+const std::vector<QObject *> & no_objects()
+{
+	static const auto result = std::vector<QObject *>{};
+	return result;
+}
+
+}
+
+object_set::object_set()
+{
+}
+
+object_set::object_set(type set_type, std::shared_ptr<const std::vector<QObject *>> objects) :
+	_set_type{std::move(set_type)},
+	_objects{std::move(objects)}
+{
+}
+
+const type & object_set::set_type() const
+{
+	return _set_type;
+}
+
+const std::vector<QObject *> & object_set::objects() const
+{
+	return _objects ? *_objects : no_objects();
+}
+
+std::size_t object_set::size() const
+{
+	return objects().size();
+}
+
+bool object_set::empty() const
+{
+	return objects().empty();
+}
+
+object_set::const_iterator object_set::begin() const
+{
+	return std::begin(objects());
+}
+
+object_set::const_iterator object_set::end() const
+{
+	return std::end(objects());
+}
+
+QObject * object_set::at(std::size_t index) const
+{
+	assert(index < size());
+
+	return objects()[index];
+}
+
+}}
@@ -56,6 +56,13 @@ std::string type::name() const
 	return _meta_object->className();
 }
 
+const char * type::c_name() const
+{
+	assert(!is_empty());
+
+	return _meta_object->className();
+}
+
 const QMetaObject * type::meta_object() const
 {
 	return _meta_object;
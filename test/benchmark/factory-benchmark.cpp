@@ -0,0 +1,85 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <injeqt/type.h>
+
+#include "internal/default-constructor-method.h"
+#include "internal/factory-method.h"
+#include "internal/types-by-name.h"
+
+#include <QtTest/QtTest>
+
+using namespace injeqt::internal;
+using namespace injeqt::v1;
+
+class created_object : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE created_object() {}
+
+};
+
+class object_factory : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE created_object * create() { return new created_object{}; }
+
+};
+
+class factory_benchmark : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void factory_invoke();
+	void default_constructor_invoke();
+
+};
+
+void factory_benchmark::factory_invoke()
+{
+	auto known_types = types_by_name{std::vector<type>{make_type<created_object>(), make_type<object_factory>()}};
+	auto method = make_factory_method(known_types, make_type<created_object>(), make_type<object_factory>());
+	QVERIFY(!method.is_empty());
+
+	object_factory factory{};
+	QBENCHMARK
+	{
+		QVERIFY(method.invoke(&factory) != nullptr);
+	}
+}
+
+void factory_benchmark::default_constructor_invoke()
+{
+	auto constructor = make_default_constructor_method(make_type<created_object>());
+	QVERIFY(!constructor.is_empty());
+
+	QBENCHMARK
+	{
+		QVERIFY(constructor.invoke() != nullptr);
+	}
+}
+
+QTEST_APPLESS_MAIN(factory_benchmark)
+#include "factory-benchmark.moc"
@@ -0,0 +1,142 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+static int created_objects = 0;
+
+class leaf_dependency : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE leaf_dependency() { created_objects++; }
+
+};
+
+class middle_dependency : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE middle_dependency() { created_objects++; }
+
+private slots:
+	INJEQT_SET void set_leaf_dependency(leaf_dependency *) {}
+
+};
+
+class rarely_used_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE rarely_used_service() { created_objects++; }
+
+private slots:
+	INJEQT_SET void set_middle_dependency(middle_dependency *) {}
+
+};
+
+class eager_application : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE eager_application() { created_objects++; }
+
+private slots:
+	INJEQT_SET void set_rarely_used_service(rarely_used_service *) {}
+
+};
+
+class lazy_application : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE lazy_application() { created_objects++; }
+
+private slots:
+	INJEQT_SET void set_rarely_used_service(injeqt::lazy<rarely_used_service>) {}
+
+};
+
+class application_module : public injeqt::module
+{
+public:
+	application_module()
+	{
+		add_type<leaf_dependency>();
+		add_type<middle_dependency>();
+		add_type<rarely_used_service>();
+		add_type<eager_application>();
+		add_type<lazy_application>();
+	}
+	virtual ~application_module() {}
+};
+
+class lazy_benchmark : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void eager_cold_start();
+	void lazy_cold_start();
+
+private:
+	template<typename T>
+	void cold_start(const char *name);
+
+};
+
+template<typename T>
+void lazy_benchmark::cold_start(const char *name)
+{
+	created_objects = 0;
+	auto runs = 0;
+
+	QBENCHMARK
+	{
+		auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+		modules.emplace_back(std::unique_ptr<injeqt::module>{new application_module{}});
+		auto injector = injeqt::injector{std::move(modules)};
+		injector.get<T>();
+		runs++;
+	}
+
+	qDebug("%s: %d objects created on cold start", name, created_objects / runs);
+}
+
+void lazy_benchmark::eager_cold_start()
+{
+	cold_start<eager_application>("eager");
+}
+
+void lazy_benchmark::lazy_cold_start()
+{
+	cold_start<lazy_application>("lazy");
+}
+
+QTEST_APPLESS_MAIN(lazy_benchmark)
+#include "lazy-benchmark.moc"
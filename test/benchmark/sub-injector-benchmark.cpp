@@ -0,0 +1,150 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class root_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE root_service() {}
+
+};
+
+class leaf_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE leaf_service() {}
+
+private slots:
+	INJEQT_SET void set_root_service(root_service *) {}
+
+};
+
+class root_module : public injeqt::module
+{
+public:
+	root_module()
+	{
+		add_type<root_service>();
+	}
+	virtual ~root_module() {}
+};
+
+class leaf_module : public injeqt::module
+{
+public:
+	leaf_module()
+	{
+		add_type<leaf_service>();
+	}
+	virtual ~leaf_module() {}
+};
+
+class sub_injector_benchmark : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void get_from_root_data();
+	void get_from_root();
+	void create_leaf_injector_data();
+	void create_leaf_injector();
+
+private:
+	void levels_data();
+	std::vector<std::unique_ptr<injeqt::injector>> make_chain(int levels);
+	injeqt::injector make_leaf(injeqt::injector &parent);
+
+};
+
+void sub_injector_benchmark::levels_data()
+{
+	QTest::addColumn<int>("levels");
+
+	QTest::newRow("1 level") << 1;
+	QTest::newRow("4 levels") << 4;
+	QTest::newRow("16 levels") << 16;
+}
+
+std::vector<std::unique_ptr<injeqt::injector>> sub_injector_benchmark::make_chain(int levels)
+{
+	auto result = std::vector<std::unique_ptr<injeqt::injector>>{};
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new root_module{}});
+	result.emplace_back(std::unique_ptr<injeqt::injector>{new injeqt::injector{std::move(modules)}});
+	for (auto i = 1; i < levels; i++)
+		result.emplace_back(std::unique_ptr<injeqt::injector>{new injeqt::injector{std::vector<injeqt::injector *>{result.back().get()}, {}}});
+	return result;
+}
+
+injeqt::injector sub_injector_benchmark::make_leaf(injeqt::injector &parent)
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new leaf_module{}});
+	return injeqt::injector{std::vector<injeqt::injector *>{&parent}, std::move(modules)};
+}
+
+void sub_injector_benchmark::get_from_root_data()
+{
+	levels_data();
+}
+
+void sub_injector_benchmark::get_from_root()
+{
+	QFETCH(int, levels);
+
+	auto chain = make_chain(levels);
+	auto leaf = make_leaf(*chain.back());
+	leaf.get<root_service>();
+
+	QBENCHMARK
+	{
+		leaf.get<root_service>();
+	}
+}
+
+void sub_injector_benchmark::create_leaf_injector_data()
+{
+	levels_data();
+}
+
+void sub_injector_benchmark::create_leaf_injector()
+{
+	QFETCH(int, levels);
+
+	auto chain = make_chain(levels);
+	chain.front()->get<root_service>();
+
+	QBENCHMARK
+	{
+		auto leaf = make_leaf(*chain.back());
+		leaf.get<leaf_service>();
+	}
+}
+
+QTEST_APPLESS_MAIN(sub_injector_benchmark)
+#include "sub-injector-benchmark.moc"
@@ -0,0 +1,126 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <injeqt/exception/unknown-type.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class configured_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE configured_service() {}
+
+};
+
+class optional_service : public QObject
+{
+	Q_OBJECT
+
+};
+
+class configured_module : public injeqt::module
+{
+public:
+	configured_module()
+	{
+		add_type<configured_service>();
+	}
+	virtual ~configured_module() {}
+};
+
+class try_get_benchmark : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void initTestCase();
+	void cleanupTestCase();
+	void catch_unknown_type_miss();
+	void try_get_miss();
+	void get_hit();
+	void try_get_hit();
+
+private:
+	std::unique_ptr<injeqt::injector> _injector;
+
+};
+
+void try_get_benchmark::initTestCase()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new configured_module{}});
+	_injector.reset(new injeqt::injector{std::move(modules)});
+}
+
+void try_get_benchmark::cleanupTestCase()
+{
+	_injector.reset();
+}
+
+void try_get_benchmark::catch_unknown_type_miss()
+{
+	auto misses = 0;
+	QBENCHMARK
+	{
+		try
+		{
+			_injector->get<optional_service>();
+		}
+		catch (injeqt::exception::unknown_type &)
+		{
+			misses++;
+		}
+	}
+	QVERIFY(misses > 0);
+}
+
+void try_get_benchmark::try_get_miss()
+{
+	auto misses = 0;
+	QBENCHMARK
+	{
+		if (!_injector->try_get<optional_service>())
+			misses++;
+	}
+	QVERIFY(misses > 0);
+}
+
+void try_get_benchmark::get_hit()
+{
+	QBENCHMARK
+	{
+		QVERIFY(_injector->get<configured_service>() != nullptr);
+	}
+}
+
+void try_get_benchmark::try_get_hit()
+{
+	QBENCHMARK
+	{
+		QVERIFY(_injector->try_get<configured_service>() != nullptr);
+	}
+}
+
+QTEST_APPLESS_MAIN(try_get_benchmark)
+#include "try-get-benchmark.moc"
@@ -0,0 +1,154 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class service_1 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_1() {}
+
+};
+
+class service_2 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_2() {}
+
+private slots:
+	INJEQT_SET void set_service_1(service_1 *) {}
+
+};
+
+class service_3 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_3() {}
+
+private slots:
+	INJEQT_SET void set_service_1(service_1 *) {}
+	INJEQT_SET void set_service_2(service_2 *) {}
+
+};
+
+class service_4 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_4() {}
+
+private slots:
+	INJEQT_INIT void init() {}
+	INJEQT_SET void set_service_2(service_2 *) {}
+	INJEQT_SET void set_service_3(service_3 *) {}
+
+};
+
+class service_5 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_5() {}
+
+private slots:
+	INJEQT_DONE void done() {}
+	INJEQT_SET void set_service_1(service_1 *) {}
+	INJEQT_SET void set_service_3(service_3 *) {}
+	INJEQT_SET void set_service_4(service_4 *) {}
+
+};
+
+class services_module : public injeqt::module
+{
+public:
+	services_module()
+	{
+		add_type<service_1>();
+		add_type<service_2>();
+		add_type<service_3>();
+		add_type<service_4>();
+		add_type<service_5>();
+	}
+	virtual ~services_module() {}
+};
+
+class validation_manifest_benchmark : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void create_injector_without_manifest();
+	void create_injector_with_manifest();
+	void create_validation_manifest();
+
+private:
+	std::vector<std::unique_ptr<injeqt::module>> make_modules();
+
+};
+
+std::vector<std::unique_ptr<injeqt::module>> validation_manifest_benchmark::make_modules()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new services_module{}});
+	return modules;
+}
+
+void validation_manifest_benchmark::create_injector_without_manifest()
+{
+	QBENCHMARK
+	{
+		auto injector = injeqt::injector{make_modules()};
+	}
+}
+
+void validation_manifest_benchmark::create_injector_with_manifest()
+{
+	// startup with manifest must not be slower than full validation it replaces
+	auto manifest = injeqt::injector{make_modules()}.validation_manifest();
+
+	QBENCHMARK
+	{
+		auto injector = injeqt::injector{make_modules(), manifest};
+	}
+}
+
+void validation_manifest_benchmark::create_validation_manifest()
+{
+	auto injector = injeqt::injector{make_modules()};
+
+	QBENCHMARK
+	{
+		injector.validation_manifest();
+	}
+}
+
+QTEST_APPLESS_MAIN(validation_manifest_benchmark)
+#include "validation-manifest-benchmark.moc"
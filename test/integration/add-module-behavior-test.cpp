@@ -0,0 +1,270 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/ambiguous-types.h>
+#include <injeqt/exception/invalid-setter.h>
+#include <injeqt/exception/unknown-type.h>
+#include <injeqt/exception/unresolvable-dependencies.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class base_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	base_service() {}
+	virtual ~base_service() {}
+
+};
+
+class core_service : public base_service
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+
+	Q_INVOKABLE core_service() { instances++; }
+	virtual ~core_service() { instances--; }
+
+};
+
+int core_service::instances = 0;
+
+class plugin_service : public base_service
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE plugin_service() {}
+
+	core_service * core() const { return _core; }
+
+private slots:
+	INJEQT_SET void set_core_service(core_service *x) { _core = x; }
+
+private:
+	QPointer<core_service> _core;
+
+};
+
+class base_service_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE base_service_user() {}
+
+private slots:
+	INJEQT_SET void set_base_service(base_service *) {}
+
+};
+
+class missing_service : public QObject
+{
+	Q_OBJECT
+
+};
+
+class broken_plugin_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE broken_plugin_service() {}
+
+private slots:
+	INJEQT_SET void set_missing_service(missing_service *) {}
+
+};
+
+class core_module : public injeqt::module
+{
+public:
+	core_module()
+	{
+		add_type<core_service>();
+	}
+	virtual ~core_module() {}
+};
+
+class core_with_user_module : public injeqt::module
+{
+public:
+	core_with_user_module()
+	{
+		add_type<core_service>();
+		add_type<base_service_user>();
+	}
+	virtual ~core_with_user_module() {}
+};
+
+class plugin_module : public injeqt::module
+{
+public:
+	plugin_module()
+	{
+		add_type<plugin_service>();
+	}
+	virtual ~plugin_module() {}
+};
+
+class doubled_plugin_module : public injeqt::module
+{
+public:
+	doubled_plugin_module()
+	{
+		add_type<plugin_service>();
+		add_type<plugin_service>();
+	}
+	virtual ~doubled_plugin_module() {}
+};
+
+class broken_plugin_module : public injeqt::module
+{
+public:
+	broken_plugin_module()
+	{
+		add_type<broken_plugin_service>();
+	}
+	virtual ~broken_plugin_module() {}
+};
+
+class add_module_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_make_added_types_available();
+	void should_keep_created_objects();
+	void should_make_shared_interface_unavailable();
+	void should_throw_when_type_already_configured();
+	void should_throw_when_added_type_is_doubled();
+	void should_throw_when_shared_interface_is_used();
+	void should_not_modify_injector_when_module_is_invalid();
+
+private:
+	template<typename T>
+	injeqt::injector make_injector();
+	template<typename T>
+	std::unique_ptr<injeqt::module> make_module();
+
+};
+
+template<typename T>
+injeqt::injector add_module_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(make_module<T>());
+	return injeqt::injector{std::move(modules)};
+}
+
+template<typename T>
+std::unique_ptr<injeqt::module> add_module_behavior_test::make_module()
+{
+	return std::unique_ptr<injeqt::module>{new T{}};
+}
+
+void add_module_behavior_test::should_make_added_types_available()
+{
+	auto injector = make_injector<core_module>();
+	injector.add_module(make_module<plugin_module>());
+
+	auto plugin = injector.get<plugin_service>();
+	QVERIFY(plugin != nullptr);
+	QCOMPARE(plugin->core(), injector.get<core_service>());
+}
+
+void add_module_behavior_test::should_keep_created_objects()
+{
+	auto injector = make_injector<core_module>();
+	auto core = injector.get<core_service>();
+	injector.add_module(make_module<plugin_module>());
+
+	QCOMPARE(injector.get<core_service>(), core);
+	QCOMPARE(injector.get<plugin_service>()->core(), core);
+	QCOMPARE(core_service::instances, 1);
+}
+
+void add_module_behavior_test::should_make_shared_interface_unavailable()
+{
+	auto injector = make_injector<core_module>();
+	QCOMPARE(injector.get<base_service>(), static_cast<base_service *>(injector.get<core_service>()));
+	injector.add_module(make_module<plugin_module>());
+
+	expect<injeqt::exception::unknown_type>({"base_service"}, [&]{
+		injector.get<base_service>();
+	});
+	QVERIFY(injector.get<core_service>() != nullptr);
+}
+
+void add_module_behavior_test::should_throw_when_type_already_configured()
+{
+	auto injector = make_injector<core_module>();
+
+	expect<injeqt::exception::ambiguous_types>({"core_service"}, [&]{
+		injector.add_module(make_module<core_module>());
+	});
+}
+
+void add_module_behavior_test::should_throw_when_added_type_is_doubled()
+{
+	auto injector = make_injector<core_module>();
+
+	expect<injeqt::exception::ambiguous_types>({"plugin_service"}, [&]{
+		injector.add_module(make_module<doubled_plugin_module>());
+	});
+	QVERIFY(injector.get<core_service>() != nullptr);
+}
+
+void add_module_behavior_test::should_throw_when_shared_interface_is_used()
+{
+	auto injector = make_injector<core_with_user_module>();
+
+	expect<injeqt::exception::unresolvable_dependencies>({"base_service"}, [&]{
+		injector.add_module(make_module<plugin_module>());
+	});
+	QVERIFY(injector.get<base_service_user>() != nullptr);
+	expect<injeqt::exception::unknown_type>({"plugin_service"}, [&]{
+		injector.get<plugin_service>();
+	});
+}
+
+void add_module_behavior_test::should_not_modify_injector_when_module_is_invalid()
+{
+	auto injector = make_injector<core_module>();
+
+	expect<injeqt::exception::invalid_setter>({"broken_plugin_service"}, [&]{
+		injector.add_module(make_module<broken_plugin_module>());
+	});
+	expect<injeqt::exception::unknown_type>({"broken_plugin_service"}, [&]{
+		injector.get<broken_plugin_service>();
+	});
+	injector.add_module(make_module<plugin_module>());
+	QVERIFY(injector.get<plugin_service>() != nullptr);
+}
+
+QTEST_APPLESS_MAIN(add_module_behavior_test)
+#include "add-module-behavior-test.moc"
@@ -0,0 +1,209 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/invalid-setter.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class network : public QObject
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+
+	Q_INVOKABLE network() { instances++; }
+	virtual ~network() { instances--; }
+
+};
+
+int network::instances = 0;
+
+class buffer : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE buffer() {}
+
+};
+
+class connection : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit connection(int id) : _id{id}, _initialized{false} {}
+
+	int id() const { return _id; }
+	bool initialized() const { return _initialized; }
+	network * used_network() const { return _network; }
+	buffer * used_buffer() const { return _buffer; }
+
+private slots:
+	INJEQT_INIT void init() { _initialized = _network != nullptr; }
+	INJEQT_SET void set_network(network *n) { _network = n; }
+	INJEQT_SET void set_buffer(buffer *b) { _buffer = b; }
+
+private:
+	int _id;
+	bool _initialized;
+	QPointer<network> _network;
+	QPointer<buffer> _buffer;
+
+};
+
+class document : public QObject
+{
+	Q_OBJECT
+
+public:
+	document(QString title, std::unique_ptr<buffer> content) :
+		_title{std::move(title)},
+		_content{std::move(content)}
+	{
+	}
+
+	const QString & title() const { return _title; }
+	buffer * content() const { return _content.get(); }
+	network * used_network() const { return _network; }
+
+private slots:
+	INJEQT_SET void set_network(network *n) { _network = n; }
+
+private:
+	QString _title;
+	std::unique_ptr<buffer> _content;
+	QPointer<network> _network;
+
+};
+
+class invalid_document : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit invalid_document(int) {}
+
+private slots:
+	INJEQT_SET void set_network(network *, network *) {}
+
+};
+
+class assisted_module : public injeqt::module
+{
+public:
+	assisted_module()
+	{
+		add_type<network>();
+		add_prototype<buffer>();
+	}
+	virtual ~assisted_module() {}
+};
+
+class assisted_factory_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_create_objects_with_runtime_arguments();
+	void should_instantiate_dependencies_when_factory_is_created();
+	void should_inject_new_prototype_into_each_object();
+	void should_forward_move_only_arguments();
+	void should_throw_when_setter_is_invalid();
+
+private:
+	injeqt::injector make_injector();
+
+};
+
+injeqt::injector assisted_factory_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new assisted_module{}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void assisted_factory_behavior_test::should_create_objects_with_runtime_arguments()
+{
+	auto injector = make_injector();
+	auto make_connection = injector.make_assisted_factory<connection, int>();
+
+	auto c1 = make_connection(1);
+	auto c2 = make_connection(2);
+	QCOMPARE(c1->id(), 1);
+	QCOMPARE(c2->id(), 2);
+	QVERIFY(c1->initialized());
+	QVERIFY(c2->initialized());
+	QCOMPARE(c1->used_network(), injector.get<network>());
+	QCOMPARE(c2->used_network(), injector.get<network>());
+}
+
+void assisted_factory_behavior_test::should_instantiate_dependencies_when_factory_is_created()
+{
+	auto injector = make_injector();
+	QCOMPARE(network::instances, 0);
+
+	auto make_connection = injector.make_assisted_factory<connection, int>();
+	QCOMPARE(network::instances, 1);
+
+	auto c = make_connection(1);
+	QCOMPARE(network::instances, 1);
+}
+
+void assisted_factory_behavior_test::should_inject_new_prototype_into_each_object()
+{
+	auto injector = make_injector();
+	auto make_connection = injector.make_assisted_factory<connection, int>();
+
+	auto c1 = make_connection(1);
+	auto c2 = make_connection(2);
+	QVERIFY(c1->used_buffer() != nullptr);
+	QVERIFY(c2->used_buffer() != nullptr);
+	QVERIFY(c1->used_buffer() != c2->used_buffer());
+}
+
+void assisted_factory_behavior_test::should_forward_move_only_arguments()
+{
+	auto injector = make_injector();
+	auto make_document = injector.make_assisted_factory<document, QString, std::unique_ptr<buffer>>();
+
+	auto content = new buffer{};
+	auto d = make_document(QString{"title"}, std::unique_ptr<buffer>{content});
+	QCOMPARE(d->title(), QString{"title"});
+	QCOMPARE(d->content(), content);
+	QCOMPARE(d->used_network(), injector.get<network>());
+}
+
+void assisted_factory_behavior_test::should_throw_when_setter_is_invalid()
+{
+	auto injector = make_injector();
+
+	expect<injeqt::exception::invalid_setter>({"set_network"}, [&]{
+		injector.make_assisted_factory<invalid_document, int>();
+	});
+}
+
+QTEST_APPLESS_MAIN(assisted_factory_behavior_test)
+#include "assisted-factory-behavior-test.moc"
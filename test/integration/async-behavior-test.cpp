@@ -0,0 +1,195 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/unknown-type.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+#include <atomic>
+
+class dependency_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	static std::atomic<int> instances;
+
+	Q_INVOKABLE dependency_service() { instances++; }
+	virtual ~dependency_service() { instances--; }
+
+};
+
+std::atomic<int> dependency_service::instances{0};
+
+class async_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE async_service() : _init_thread{nullptr} {}
+
+	dependency_service * dependency() const { return _dependency; }
+	QThread * init_thread() const { return _init_thread; }
+
+private slots:
+	INJEQT_INIT void init() { _init_thread = QThread::currentThread(); }
+	INJEQT_SET void set_dependency_service(dependency_service *x) { _dependency = x; }
+
+private:
+	QPointer<dependency_service> _dependency;
+	QThread *_init_thread;
+
+};
+
+class unknown_service : public QObject
+{
+	Q_OBJECT
+
+};
+
+class async_module : public injeqt::module
+{
+public:
+	async_module()
+	{
+		add_type<dependency_service>();
+		add_type<async_service>();
+	}
+	virtual ~async_module() {}
+};
+
+class async_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_return_object_from_event_loop();
+	void should_return_finished_future_for_existing_object();
+	void should_instantiate_object();
+	void should_reuse_object_created_in_meantime();
+	void should_cancel_when_injector_is_destroyed();
+	void should_allow_get_async_from_callback();
+	void should_throw_when_type_is_unknown();
+
+private:
+	std::unique_ptr<injeqt::injector> make_injector();
+
+};
+
+std::unique_ptr<injeqt::injector> async_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new async_module{}});
+	return std::unique_ptr<injeqt::injector>{new injeqt::injector{std::move(modules)}};
+}
+
+void async_behavior_test::should_return_object_from_event_loop()
+{
+	auto injector = make_injector();
+	auto future = injector->get_async<async_service>();
+
+	QTRY_VERIFY(future.isFinished());
+	QVERIFY(!future.isCanceled());
+	auto service = future.result();
+	QVERIFY(service != nullptr);
+	QCOMPARE(service, injector->get<async_service>());
+	QCOMPARE(service->thread(), QThread::currentThread());
+	QCOMPARE(service->init_thread(), QThread::currentThread());
+	QVERIFY(service->dependency() != nullptr);
+	QCOMPARE(service->dependency()->thread(), QThread::currentThread());
+	QCOMPARE(dependency_service::instances.load(), 1);
+}
+
+void async_behavior_test::should_return_finished_future_for_existing_object()
+{
+	auto injector = make_injector();
+	auto service = injector->get<async_service>();
+	auto future = injector->get_async<async_service>();
+
+	QVERIFY(future.isFinished());
+	QCOMPARE(future.result(), service);
+}
+
+void async_behavior_test::should_instantiate_object()
+{
+	auto injector = make_injector();
+	auto future = injector->instantiate_async<async_service>();
+
+	QTRY_VERIFY(future.isFinished());
+	QVERIFY(!future.isCanceled());
+	QCOMPARE(dependency_service::instances.load(), 1);
+}
+
+void async_behavior_test::should_reuse_object_created_in_meantime()
+{
+	auto injector = make_injector();
+	auto future = injector->get_async<async_service>();
+	auto service = injector->get<async_service>();
+
+	QTRY_VERIFY(future.isFinished());
+	QCOMPARE(future.result(), service);
+	QTRY_COMPARE(dependency_service::instances.load(), 1);
+}
+
+void async_behavior_test::should_cancel_when_injector_is_destroyed()
+{
+	auto injector = make_injector();
+	auto future = injector->get_async<async_service>();
+	injector.reset();
+
+	QVERIFY(future.isFinished());
+	QVERIFY(future.isCanceled());
+	QTRY_COMPARE(dependency_service::instances.load(), 0);
+}
+
+void async_behavior_test::should_allow_get_async_from_callback()
+{
+	auto injector = make_injector();
+	auto nested = static_cast<QObject *>(nullptr);
+	auto done = false;
+	// nested call removes finished construction that is still running this callback
+	injector->get_async(injeqt::make_type<async_service>(), [&](QObject *object){
+		QVERIFY(object != nullptr);
+		injector->get_async(injeqt::make_type<dependency_service>(), [&](QObject *dependency){ nested = dependency; });
+		done = true;
+	});
+
+	QTRY_VERIFY(done);
+	QCOMPARE(nested, injector->get<dependency_service>());
+
+	auto second = injector->get_async<async_service>();
+	QVERIFY(second.isFinished());
+	QCOMPARE(second.result(), injector->get<async_service>());
+}
+
+void async_behavior_test::should_throw_when_type_is_unknown()
+{
+	auto injector = make_injector();
+
+	expect<injeqt::exception::unknown_type>({"unknown_service"}, [&]{
+		injector->get_async<unknown_service>();
+	});
+}
+
+QTEST_GUILESS_MAIN(async_behavior_test)
+#include "async-behavior-test.moc"
@@ -0,0 +1,229 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/invalid-dependency.h>
+#include <injeqt/exception/unavailable-required-types.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class storage : public QObject
+{
+	Q_OBJECT
+
+public:
+	virtual ~storage() {}
+
+};
+
+class database : public storage
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE database() {}
+
+};
+
+class logger : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE logger() {}
+
+};
+
+class cache : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE cache() {}
+
+};
+
+class repository : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE repository(storage *s, logger *l) : _storage{s}, _logger{l}, _cache{nullptr}, _initialized_with_cache{false} {}
+
+	storage * used_storage() const { return _storage; }
+	logger * used_logger() const { return _logger; }
+	cache * used_cache() const { return _cache; }
+	bool initialized_with_cache() const { return _initialized_with_cache; }
+
+private slots:
+	INJEQT_INIT void init() { _initialized_with_cache = _cache != nullptr; }
+	INJEQT_SET void set_cache(cache *c) { _cache = c; }
+
+private:
+	storage *_storage;
+	logger *_logger;
+	cache *_cache;
+	bool _initialized_with_cache;
+
+};
+
+class controller : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE controller(repository *r) : _repository{r} {}
+
+	repository * used_repository() const { return _repository; }
+
+private:
+	repository *_repository;
+
+};
+
+class first_in_cycle;
+
+class second_in_cycle : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE second_in_cycle(first_in_cycle *) {}
+
+};
+
+class first_in_cycle : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE first_in_cycle(second_in_cycle *) {}
+
+};
+
+class repository_module : public injeqt::module
+{
+public:
+	repository_module()
+	{
+		add_type<database>();
+		add_type<logger>();
+		add_type<cache>();
+		add_type<repository>();
+		add_type<controller>();
+	}
+	virtual ~repository_module() {}
+};
+
+class missing_storage_module : public injeqt::module
+{
+public:
+	missing_storage_module()
+	{
+		add_type<logger>();
+		add_type<cache>();
+		add_type<repository>();
+	}
+	virtual ~missing_storage_module() {}
+};
+
+class cycle_module : public injeqt::module
+{
+public:
+	cycle_module()
+	{
+		add_type<first_in_cycle>();
+		add_type<second_in_cycle>();
+	}
+	virtual ~cycle_module() {}
+};
+
+class constructor_injection_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_pass_dependencies_to_constructor();
+	void should_call_setters_and_init_methods_after_constructor();
+	void should_create_chain_of_constructor_injected_objects();
+	void should_throw_when_parameter_type_is_not_available();
+	void should_throw_when_parameters_require_each_other();
+
+private:
+	template<typename T>
+	injeqt::injector make_injector();
+
+};
+
+template<typename T>
+injeqt::injector constructor_injection_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new T{}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void constructor_injection_behavior_test::should_pass_dependencies_to_constructor()
+{
+	auto injector = make_injector<repository_module>();
+	auto r = injector.get<repository>();
+
+	QVERIFY(r->used_storage() != nullptr);
+	QCOMPARE(r->used_storage(), static_cast<storage *>(injector.get<database>()));
+	QCOMPARE(r->used_logger(), injector.get<logger>());
+}
+
+void constructor_injection_behavior_test::should_call_setters_and_init_methods_after_constructor()
+{
+	auto injector = make_injector<repository_module>();
+	auto r = injector.get<repository>();
+
+	QCOMPARE(r->used_cache(), injector.get<cache>());
+	QVERIFY(r->initialized_with_cache());
+}
+
+void constructor_injection_behavior_test::should_create_chain_of_constructor_injected_objects()
+{
+	auto injector = make_injector<repository_module>();
+	auto c = injector.get<controller>();
+
+	QCOMPARE(c->used_repository(), injector.get<repository>());
+	QVERIFY(c->used_repository()->used_logger() != nullptr);
+}
+
+void constructor_injection_behavior_test::should_throw_when_parameter_type_is_not_available()
+{
+	expect<injeqt::exception::unavailable_required_types>({"storage"}, [&]{
+		make_injector<missing_storage_module>();
+	});
+}
+
+void constructor_injection_behavior_test::should_throw_when_parameters_require_each_other()
+{
+	expect<injeqt::exception::invalid_dependency>({"cycle"}, [&]{
+		make_injector<cycle_module>();
+	});
+}
+
+QTEST_APPLESS_MAIN(constructor_injection_behavior_test)
+#include "constructor-injection-behavior-test.moc"
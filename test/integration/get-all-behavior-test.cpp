@@ -0,0 +1,228 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/qobject-type.h>
+#include <injeqt/exception/unknown-type.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+#include <injeqt/type.h>
+
+#include <QtTest/QtTest>
+
+using injeqt::make_type;
+using injeqt::type;
+
+static int init_calls = 0;
+
+class leaf_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE leaf_service() {}
+
+};
+
+class first_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE first_service() : _initialized_with_leaf{false} {}
+
+	leaf_service * leaf() const { return _leaf; }
+	bool initialized_with_leaf() const { return _initialized_with_leaf; }
+
+private slots:
+	INJEQT_INIT void init() { _initialized_with_leaf = _leaf != nullptr; init_calls++; }
+	INJEQT_SET void set_leaf_service(leaf_service *x) { _leaf = x; }
+
+private:
+	QPointer<leaf_service> _leaf;
+	bool _initialized_with_leaf;
+
+};
+
+class second_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE second_service() {}
+
+	first_service * first() const { return _first; }
+
+private slots:
+	INJEQT_INIT void init() { init_calls++; }
+	INJEQT_SET void set_first_service(first_service *x) { _first = x; }
+
+private:
+	QPointer<first_service> _first;
+
+};
+
+class scoped_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE scoped_service() {}
+
+};
+
+class unknown_service : public QObject
+{
+	Q_OBJECT
+
+};
+
+class get_all_module : public injeqt::module
+{
+public:
+	get_all_module()
+	{
+		add_type<leaf_service>();
+		add_type<first_service>();
+		add_type<second_service>();
+		add_scoped_type<scoped_service>();
+	}
+	virtual ~get_all_module() {}
+};
+
+class get_all_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void init();
+	void should_return_empty_list_for_no_types();
+	void should_return_objects_in_request_order();
+	void should_resolve_and_init_objects_once();
+	void should_return_already_created_objects();
+	void should_return_scoped_objects();
+	void should_return_objects_from_super_injector();
+	void should_throw_when_type_unknown();
+	void should_throw_when_type_is_qobject();
+
+private:
+	injeqt::injector make_injector();
+
+};
+
+void get_all_behavior_test::init()
+{
+	init_calls = 0;
+}
+
+injeqt::injector get_all_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new get_all_module{}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void get_all_behavior_test::should_return_empty_list_for_no_types()
+{
+	auto injector = make_injector();
+
+	QVERIFY(injector.get_all({}).empty());
+	QCOMPARE(init_calls, 0);
+}
+
+void get_all_behavior_test::should_return_objects_in_request_order()
+{
+	auto injector = make_injector();
+	auto objects = injector.get_all({make_type<second_service>(), make_type<leaf_service>(), make_type<first_service>()});
+
+	QVERIFY(objects.size() == 3);
+	QCOMPARE(objects[0], static_cast<QObject *>(injector.get<second_service>()));
+	QCOMPARE(objects[1], static_cast<QObject *>(injector.get<leaf_service>()));
+	QCOMPARE(objects[2], static_cast<QObject *>(injector.get<first_service>()));
+}
+
+void get_all_behavior_test::should_resolve_and_init_objects_once()
+{
+	auto injector = make_injector();
+	auto objects = injector.get_all({make_type<second_service>(), make_type<first_service>(), make_type<second_service>()});
+
+	auto second = qobject_cast<second_service *>(objects[0]);
+	auto first = qobject_cast<first_service *>(objects[1]);
+	QCOMPARE(objects[2], objects[0]);
+	QCOMPARE(second->first(), first);
+	QCOMPARE(first->leaf(), injector.get<leaf_service>());
+	QVERIFY(first->initialized_with_leaf());
+	QCOMPARE(init_calls, 2);
+}
+
+void get_all_behavior_test::should_return_already_created_objects()
+{
+	auto injector = make_injector();
+	auto first = injector.get<first_service>();
+	auto objects = injector.get_all({make_type<first_service>(), make_type<second_service>()});
+
+	QCOMPARE(objects[0], static_cast<QObject *>(first));
+	QCOMPARE(qobject_cast<second_service *>(objects[1])->first(), first);
+	QCOMPARE(init_calls, 2);
+}
+
+void get_all_behavior_test::should_return_scoped_objects()
+{
+	auto injector = make_injector();
+	injector.enter_scope();
+	auto objects = injector.get_all({make_type<scoped_service>(), make_type<leaf_service>()});
+
+	QCOMPARE(objects[0], static_cast<QObject *>(injector.get<scoped_service>()));
+	QCOMPARE(objects[1], static_cast<QObject *>(injector.get<leaf_service>()));
+	injector.leave_scope();
+}
+
+void get_all_behavior_test::should_return_objects_from_super_injector()
+{
+	auto super_injector = make_injector();
+	auto sub_injector = injeqt::injector{std::vector<injeqt::injector *>{&super_injector}, {}};
+	auto objects = sub_injector.get_all({make_type<first_service>(), make_type<second_service>()});
+
+	QCOMPARE(objects[0], static_cast<QObject *>(super_injector.get<first_service>()));
+	QCOMPARE(objects[1], static_cast<QObject *>(super_injector.get<second_service>()));
+}
+
+void get_all_behavior_test::should_throw_when_type_unknown()
+{
+	auto injector = make_injector();
+
+	expect<injeqt::exception::unknown_type>({"unknown_service"}, [&]{
+		injector.get_all({make_type<first_service>(), make_type<unknown_service>()});
+	});
+	QCOMPARE(init_calls, 0);
+}
+
+void get_all_behavior_test::should_throw_when_type_is_qobject()
+{
+	auto injector = make_injector();
+
+	expect<injeqt::exception::qobject_type>([&]{
+		injector.get_all({make_type<first_service>(), make_type<QObject>()});
+	});
+}
+
+QTEST_APPLESS_MAIN(get_all_behavior_test)
+#include "get-all-behavior-test.moc"
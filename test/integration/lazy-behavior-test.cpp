@@ -0,0 +1,194 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/unknown-type.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+#include <thread>
+#include <vector>
+
+class heavy_dependency : public QObject
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+
+	Q_INVOKABLE heavy_dependency() { instances++; }
+	virtual ~heavy_dependency() { instances--; }
+
+};
+
+int heavy_dependency::instances = 0;
+
+class heavy_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+
+	Q_INVOKABLE heavy_service() { instances++; }
+	virtual ~heavy_service() { instances--; }
+
+	heavy_dependency * dependency() const { return _dependency; }
+
+private slots:
+	INJEQT_SET void set_heavy_dependency(heavy_dependency *x) { _dependency = x; }
+
+private:
+	QPointer<heavy_dependency> _dependency;
+
+};
+
+int heavy_service::instances = 0;
+
+class lazy_client : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE lazy_client() {}
+
+	injeqt::lazy<heavy_service> service() const { return _service; }
+
+private slots:
+	INJEQT_SET void set_heavy_service(injeqt::lazy<heavy_service> x) { _service = x; }
+
+private:
+	injeqt::lazy<heavy_service> _service;
+
+};
+
+class unknown_service : public QObject
+{
+	Q_OBJECT
+
+};
+
+class lazy_module : public injeqt::module
+{
+public:
+	lazy_module()
+	{
+		add_type<heavy_dependency>();
+		add_type<heavy_service>();
+		add_type<lazy_client>();
+	}
+	virtual ~lazy_module() {}
+};
+
+class lazy_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_not_create_object_when_handle_is_returned();
+	void should_create_object_on_first_access();
+	void should_inject_handle_without_creating_object();
+	void should_create_object_once_for_many_threads();
+	void should_throw_when_type_is_unknown();
+
+private:
+	injeqt::injector make_injector();
+
+};
+
+injeqt::injector lazy_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new lazy_module{}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void lazy_behavior_test::should_not_create_object_when_handle_is_returned()
+{
+	auto injector = make_injector();
+	auto service = injector.get_lazy<heavy_service>();
+
+	QVERIFY(!service.is_empty());
+	QVERIFY(!service.is_resolved());
+	QCOMPARE(service.object_type(), injeqt::make_type<heavy_service>());
+	QCOMPARE(heavy_service::instances, 0);
+	QCOMPARE(heavy_dependency::instances, 0);
+}
+
+void lazy_behavior_test::should_create_object_on_first_access()
+{
+	auto injector = make_injector();
+	auto service = injector.get_lazy<heavy_service>();
+
+	auto object = service.get<heavy_service>();
+	QVERIFY(object != nullptr);
+	QVERIFY(service.is_resolved());
+	QVERIFY(object->dependency() != nullptr);
+	QCOMPARE(object, injector.get<heavy_service>());
+	QCOMPARE(service.get<heavy_service>(), object);
+	QCOMPARE(heavy_service::instances, 1);
+	QCOMPARE(heavy_dependency::instances, 1);
+}
+
+void lazy_behavior_test::should_inject_handle_without_creating_object()
+{
+	auto injector = make_injector();
+	auto client = injector.get<lazy_client>();
+
+	QVERIFY(!client->service().is_empty());
+	QVERIFY(!client->service().is_resolved());
+	QCOMPARE(heavy_service::instances, 0);
+	QCOMPARE(heavy_dependency::instances, 0);
+
+	QCOMPARE(client->service().get<heavy_service>(), injector.get<heavy_service>());
+	QCOMPARE(heavy_service::instances, 1);
+	QCOMPARE(heavy_dependency::instances, 1);
+}
+
+void lazy_behavior_test::should_create_object_once_for_many_threads()
+{
+	auto injector = make_injector();
+	auto service = injector.get_lazy<heavy_service>();
+
+	auto results = std::vector<QObject *>(8, nullptr);
+	auto threads = std::vector<std::thread>{};
+	for (auto i = 0u; i < results.size(); i++)
+		threads.emplace_back([&, i]{ results[i] = service.get(); });
+	for (auto &&t : threads)
+		t.join();
+
+	QCOMPARE(heavy_service::instances, 1);
+	for (auto &&r : results)
+		QCOMPARE(r, static_cast<QObject *>(injector.get<heavy_service>()));
+}
+
+void lazy_behavior_test::should_throw_when_type_is_unknown()
+{
+	auto injector = make_injector();
+
+	expect<injeqt::exception::unknown_type>({"unknown_service"}, [&]{
+		injector.get_lazy<unknown_service>();
+	});
+}
+
+QTEST_APPLESS_MAIN(lazy_behavior_test)
+#include "lazy-behavior-test.moc"
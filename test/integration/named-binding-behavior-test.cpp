@@ -0,0 +1,299 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/ambiguous-types.h>
+#include <injeqt/exception/unknown-type.h>
+#include <injeqt/exception/unresolvable-dependencies.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class logger : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE logger() {}
+
+};
+
+class pool : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE pool() {}
+
+	logger * used_logger() const { return _logger; }
+	bool initialized() const { return _initialized; }
+
+private slots:
+	INJEQT_INIT void init() { _initialized = true; }
+	INJEQT_SET void set_logger(logger *l) { _logger = l; }
+
+private:
+	QPointer<logger> _logger;
+	bool _initialized = false;
+
+};
+
+class client : public QObject
+{
+	Q_OBJECT
+	INJEQT_NAMED(set_primary_pool, "primary")
+	INJEQT_NAMED(set_secondary_pool, "secondary")
+
+public:
+	Q_INVOKABLE client() {}
+
+	pool * primary_pool() const { return _primary_pool; }
+	pool * secondary_pool() const { return _secondary_pool; }
+
+private slots:
+	INJEQT_SET void set_primary_pool(pool *p) { _primary_pool = p; }
+	INJEQT_SET void set_secondary_pool(pool *p) { _secondary_pool = p; }
+
+private:
+	QPointer<pool> _primary_pool;
+	QPointer<pool> _secondary_pool;
+
+};
+
+class other_client : public QObject
+{
+	Q_OBJECT
+	INJEQT_NAMED(set_primary_pool, "primary")
+
+public:
+	Q_INVOKABLE other_client() {}
+
+	pool * primary_pool() const { return _primary_pool; }
+	pool * default_pool() const { return _default_pool; }
+
+private slots:
+	INJEQT_SET void set_primary_pool(pool *p) { _primary_pool = p; }
+	INJEQT_SET void set_default_pool(pool *p) { _default_pool = p; }
+
+private:
+	QPointer<pool> _primary_pool;
+	QPointer<pool> _default_pool;
+
+};
+
+class pool_module : public injeqt::module
+{
+public:
+	pool_module()
+	{
+		add_type<logger>();
+		add_type<pool>("primary");
+		add_type<pool>("secondary");
+	}
+	virtual ~pool_module() {}
+};
+
+class ready_pool_module : public injeqt::module
+{
+public:
+	ready_pool_module()
+	{
+		add_ready_object<pool>(&_primary_pool, "primary");
+		add_ready_object<pool>(&_secondary_pool, "secondary");
+	}
+	virtual ~ready_pool_module() {}
+
+	pool * primary_pool() { return &_primary_pool; }
+	pool * secondary_pool() { return &_secondary_pool; }
+
+private:
+	pool _primary_pool;
+	pool _secondary_pool;
+
+};
+
+class client_module : public injeqt::module
+{
+public:
+	client_module()
+	{
+		add_type<client>();
+	}
+	virtual ~client_module() {}
+};
+
+class other_client_module : public injeqt::module
+{
+public:
+	other_client_module()
+	{
+		add_type<other_client>();
+		add_type<pool>();
+	}
+	virtual ~other_client_module() {}
+};
+
+class duplicating_module : public injeqt::module
+{
+public:
+	duplicating_module()
+	{
+		add_type<pool>("primary");
+	}
+	virtual ~duplicating_module() {}
+};
+
+class named_binding_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_inject_named_objects_by_name();
+	void should_inject_the_same_named_object_into_many_objects();
+	void should_inject_named_ready_objects();
+	void should_inject_dependencies_into_named_objects();
+	void should_inject_named_and_unnamed_objects_of_the_same_type();
+	void should_not_make_named_objects_available_by_type();
+	void should_throw_when_name_is_not_configured();
+	void should_throw_when_name_is_duplicated();
+	void should_inject_named_objects_from_added_module();
+	void should_throw_when_removing_module_with_used_named_object();
+
+private:
+	template<typename ...T>
+	std::vector<std::unique_ptr<injeqt::module>> make_modules();
+
+};
+
+template<typename ...T>
+std::vector<std::unique_ptr<injeqt::module>> named_binding_behavior_test::make_modules()
+{
+	auto result = std::vector<std::unique_ptr<injeqt::module>>{};
+	int add[] = {0, (result.emplace_back(std::unique_ptr<injeqt::module>{new T{}}), 0)...};
+	(void)add;
+	return result;
+}
+
+void named_binding_behavior_test::should_inject_named_objects_by_name()
+{
+	auto injector = injeqt::injector{make_modules<pool_module, client_module>()};
+	auto c = injector.get<client>();
+
+	QVERIFY(c->primary_pool() != nullptr);
+	QVERIFY(c->secondary_pool() != nullptr);
+	QVERIFY(c->primary_pool() != c->secondary_pool());
+}
+
+void named_binding_behavior_test::should_inject_the_same_named_object_into_many_objects()
+{
+	auto injector = injeqt::injector{make_modules<pool_module, client_module, other_client_module>()};
+
+	auto c = injector.get<client>();
+	auto o = injector.get<other_client>();
+	QVERIFY(o->primary_pool() != nullptr);
+	QCOMPARE(o->primary_pool(), c->primary_pool());
+}
+
+void named_binding_behavior_test::should_inject_named_ready_objects()
+{
+	auto modules = make_modules<client_module>();
+	auto ready_module = new ready_pool_module{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{ready_module});
+	auto injector = injeqt::injector{std::move(modules)};
+
+	auto c = injector.get<client>();
+	QCOMPARE(c->primary_pool(), ready_module->primary_pool());
+	QCOMPARE(c->secondary_pool(), ready_module->secondary_pool());
+	QVERIFY(!c->primary_pool()->initialized());
+}
+
+void named_binding_behavior_test::should_inject_dependencies_into_named_objects()
+{
+	auto injector = injeqt::injector{make_modules<pool_module, client_module>()};
+	auto c = injector.get<client>();
+
+	QVERIFY(c->primary_pool()->initialized());
+	QVERIFY(c->secondary_pool()->initialized());
+	QCOMPARE(c->primary_pool()->used_logger(), injector.get<logger>());
+	QCOMPARE(c->secondary_pool()->used_logger(), injector.get<logger>());
+}
+
+void named_binding_behavior_test::should_inject_named_and_unnamed_objects_of_the_same_type()
+{
+	auto injector = injeqt::injector{make_modules<pool_module, other_client_module>()};
+	auto o = injector.get<other_client>();
+
+	QVERIFY(o->primary_pool() != nullptr);
+	QCOMPARE(o->default_pool(), injector.get<pool>());
+	QVERIFY(o->primary_pool() != o->default_pool());
+}
+
+void named_binding_behavior_test::should_not_make_named_objects_available_by_type()
+{
+	auto injector = injeqt::injector{make_modules<pool_module, client_module>()};
+
+	expect<injeqt::exception::unknown_type>({"pool"}, [&]{
+		injector.get<pool>();
+	});
+}
+
+void named_binding_behavior_test::should_throw_when_name_is_not_configured()
+{
+	expect<injeqt::exception::unresolvable_dependencies>({"set_secondary_pool", "secondary"}, [&]{
+		auto modules = make_modules<client_module>();
+		auto injector = injeqt::injector{std::move(modules)};
+	});
+}
+
+void named_binding_behavior_test::should_throw_when_name_is_duplicated()
+{
+	expect<injeqt::exception::ambiguous_types>({"pool named primary"}, [&]{
+		auto modules = make_modules<pool_module, duplicating_module>();
+		auto injector = injeqt::injector{std::move(modules)};
+	});
+}
+
+void named_binding_behavior_test::should_inject_named_objects_from_added_module()
+{
+	auto injector = injeqt::injector{make_modules<pool_module>()};
+	injector.add_module(std::unique_ptr<injeqt::module>{new client_module{}});
+
+	auto c = injector.get<client>();
+	QVERIFY(c->primary_pool() != nullptr);
+	QVERIFY(c->secondary_pool() != nullptr);
+}
+
+void named_binding_behavior_test::should_throw_when_removing_module_with_used_named_object()
+{
+	auto modules = make_modules<client_module>();
+	auto removed_module = new pool_module{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{removed_module});
+	auto injector = injeqt::injector{std::move(modules)};
+
+	expect<injeqt::exception::unresolvable_dependencies>({"set_primary_pool"}, [&]{
+		injector.remove_module(removed_module);
+	});
+	QVERIFY(injector.get<client>()->primary_pool() != nullptr);
+}
+
+QTEST_APPLESS_MAIN(named_binding_behavior_test)
+#include "named-binding-behavior-test.moc"
@@ -0,0 +1,357 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/dependency-on-scoped-type.h>
+#include <injeqt/exception/invalid-dependency.h>
+#include <injeqt/exception/invalid-qobject.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service() {}
+
+};
+
+class buffer : public QObject
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+	static int init_calls;
+	static int reset_calls;
+	static int done_calls;
+
+	Q_INVOKABLE buffer() { instances++; }
+	virtual ~buffer() { instances--; }
+
+	service * get_service() const { return _service; }
+	int value = 0;
+
+private slots:
+	INJEQT_SET void set_service(service *x) { _service = x; }
+	INJEQT_INIT void init() { init_calls++; }
+	INJEQT_RESET void reset() { reset_calls++; value = 0; }
+	INJEQT_DONE void done() { done_calls++; }
+
+private:
+	QPointer<service> _service;
+
+};
+
+int buffer::instances = 0;
+int buffer::init_calls = 0;
+int buffer::reset_calls = 0;
+int buffer::done_calls = 0;
+
+class buffer_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE buffer_user() {}
+
+	buffer * get_buffer() const { return _buffer; }
+
+private slots:
+	INJEQT_SET void set_buffer(buffer *x) { _buffer = x; }
+
+private:
+	QPointer<buffer> _buffer;
+
+};
+
+class other_buffer_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE other_buffer_user() {}
+
+	buffer * get_buffer() const { return _buffer; }
+
+private slots:
+	INJEQT_SET void set_buffer(buffer *x) { _buffer = x; }
+
+private:
+	QPointer<buffer> _buffer;
+
+};
+
+class cyclic_prototype_2;
+
+class cyclic_prototype_1 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE cyclic_prototype_1() {}
+
+private slots:
+	INJEQT_SET void set_cyclic_prototype_2(cyclic_prototype_2 *) {}
+
+};
+
+class cyclic_prototype_2 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE cyclic_prototype_2() {}
+
+private slots:
+	INJEQT_SET void set_cyclic_prototype_1(cyclic_prototype_1 *) {}
+
+};
+
+class scoped_data : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE scoped_data() {}
+
+};
+
+class prototype_with_scoped : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE prototype_with_scoped() {}
+
+private slots:
+	INJEQT_SET void set_scoped_data(scoped_data *) {}
+
+};
+
+class prototype_module : public injeqt::module
+{
+public:
+	explicit prototype_module(std::size_t pool_capacity)
+	{
+		add_type<service>();
+		add_type<buffer_user>();
+		add_type<other_buffer_user>();
+		add_prototype<buffer>(pool_capacity);
+	}
+	virtual ~prototype_module() {}
+};
+
+class cyclic_module : public injeqt::module
+{
+public:
+	cyclic_module()
+	{
+		add_prototype<cyclic_prototype_1>();
+		add_prototype<cyclic_prototype_2>();
+	}
+	virtual ~cyclic_module() {}
+};
+
+class prototype_with_scoped_module : public injeqt::module
+{
+public:
+	prototype_with_scoped_module()
+	{
+		add_scoped_type<scoped_data>();
+		add_prototype<prototype_with_scoped>();
+	}
+	virtual ~prototype_with_scoped_module() {}
+};
+
+class prototype_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void init();
+	void should_return_new_object_for_each_request();
+	void should_inject_new_object_for_each_injection_point();
+	void should_share_dependencies_of_prototypes();
+	void should_destroy_released_object_without_pool();
+	void should_reuse_released_object_from_pool();
+	void should_keep_pool_bounded();
+	void should_destroy_all_objects_with_injector();
+	void should_throw_when_releasing_unknown_object();
+	void should_throw_on_prototype_cycle();
+	void should_throw_when_prototype_depends_on_scoped_type();
+
+private:
+	injeqt::injector make_injector(std::size_t pool_capacity);
+
+};
+
+injeqt::injector prototype_behavior_test::make_injector(std::size_t pool_capacity)
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new prototype_module{pool_capacity}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void prototype_behavior_test::init()
+{
+	buffer::init_calls = 0;
+	buffer::reset_calls = 0;
+	buffer::done_calls = 0;
+}
+
+void prototype_behavior_test::should_return_new_object_for_each_request()
+{
+	auto injector = make_injector(0);
+
+	auto b1 = injector.get<buffer>();
+	auto b2 = injector.get<buffer>();
+	QVERIFY(b1 != nullptr);
+	QVERIFY(b2 != nullptr);
+	QVERIFY(b1 != b2);
+	QCOMPARE(buffer::instances, 2);
+	QCOMPARE(buffer::init_calls, 2);
+}
+
+void prototype_behavior_test::should_inject_new_object_for_each_injection_point()
+{
+	auto injector = make_injector(0);
+
+	auto u1 = injector.get<buffer_user>();
+	auto u2 = injector.get<other_buffer_user>();
+	QVERIFY(u1->get_buffer() != nullptr);
+	QVERIFY(u2->get_buffer() != nullptr);
+	QVERIFY(u1->get_buffer() != u2->get_buffer());
+	QCOMPARE(injector.get<buffer_user>(), u1);
+}
+
+void prototype_behavior_test::should_share_dependencies_of_prototypes()
+{
+	auto injector = make_injector(0);
+
+	auto b1 = injector.get<buffer>();
+	auto b2 = injector.get<buffer>();
+	QVERIFY(b1->get_service() != nullptr);
+	QCOMPARE(b1->get_service(), b2->get_service());
+	QCOMPARE(b1->get_service(), injector.get<service>());
+}
+
+void prototype_behavior_test::should_destroy_released_object_without_pool()
+{
+	auto injector = make_injector(0);
+
+	auto b = QPointer<buffer>{injector.get<buffer>()};
+	injector.release(b.data());
+
+	QVERIFY(b.isNull());
+	QCOMPARE(buffer::reset_calls, 1);
+	QCOMPARE(buffer::done_calls, 1);
+	QCOMPARE(buffer::instances, 0);
+}
+
+void prototype_behavior_test::should_reuse_released_object_from_pool()
+{
+	auto injector = make_injector(1);
+
+	auto b1 = injector.get<buffer>();
+	b1->value = 5;
+	injector.release(b1);
+	QCOMPARE(buffer::reset_calls, 1);
+	QCOMPARE(buffer::done_calls, 0);
+	QCOMPARE(buffer::instances, 1);
+
+	auto b2 = injector.get<buffer>();
+	QCOMPARE(b2, b1);
+	QCOMPARE(b2->value, 0);
+	QVERIFY(b2->get_service() != nullptr);
+	QCOMPARE(buffer::init_calls, 1);
+	QCOMPARE(buffer::instances, 1);
+}
+
+void prototype_behavior_test::should_keep_pool_bounded()
+{
+	auto injector = make_injector(1);
+
+	auto b1 = injector.get<buffer>();
+	auto b2 = QPointer<buffer>{injector.get<buffer>()};
+	injector.release(b1);
+	injector.release(b2.data());
+
+	QVERIFY(b2.isNull());
+	QCOMPARE(buffer::reset_calls, 2);
+	QCOMPARE(buffer::done_calls, 1);
+	QCOMPARE(buffer::instances, 1);
+}
+
+void prototype_behavior_test::should_destroy_all_objects_with_injector()
+{
+	{
+		auto injector = make_injector(1);
+		injector.get<buffer>();
+		injector.release(injector.get<buffer>());
+		QCOMPARE(buffer::instances, 2);
+	}
+
+	QCOMPARE(buffer::done_calls, 2);
+	QCOMPARE(buffer::instances, 0);
+}
+
+void prototype_behavior_test::should_throw_when_releasing_unknown_object()
+{
+	auto injector = make_injector(1);
+	auto s = injector.get<service>();
+	auto b = injector.get<buffer>();
+	injector.release(b);
+
+	expect<injeqt::exception::invalid_qobject>({"service"}, [&]{
+		injector.release(s);
+	});
+	expect<injeqt::exception::invalid_qobject>({"buffer"}, [&]{
+		injector.release(b);
+	});
+	expect<injeqt::exception::invalid_qobject>([&]{
+		injector.release(nullptr);
+	});
+}
+
+void prototype_behavior_test::should_throw_on_prototype_cycle()
+{
+	expect<injeqt::exception::invalid_dependency>({"cycle"}, [&]{
+		auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+		modules.emplace_back(std::unique_ptr<injeqt::module>{new cyclic_module{}});
+		auto injector = injeqt::injector{std::move(modules)};
+	});
+}
+
+void prototype_behavior_test::should_throw_when_prototype_depends_on_scoped_type()
+{
+	expect<injeqt::exception::dependency_on_scoped_type>({"prototype_with_scoped"}, [&]{
+		auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+		modules.emplace_back(std::unique_ptr<injeqt::module>{new prototype_with_scoped_module{}});
+		auto injector = injeqt::injector{std::move(modules)};
+	});
+}
+
+QTEST_APPLESS_MAIN(prototype_behavior_test)
+#include "prototype-behavior-test.moc"
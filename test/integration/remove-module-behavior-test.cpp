@@ -0,0 +1,341 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/unknown-type.h>
+#include <injeqt/exception/unresolvable-dependencies.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+#include <string>
+#include <vector>
+
+static std::vector<std::string> done_order;
+
+class base_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	base_service() {}
+	virtual ~base_service() {}
+
+};
+
+class core_service : public base_service
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE core_service() {}
+
+private slots:
+	INJEQT_DONE void done() { done_order.push_back("core_service"); }
+
+};
+
+class plugin_helper : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE plugin_helper() {}
+
+private slots:
+	INJEQT_DONE void done() { done_order.push_back("plugin_helper"); }
+
+};
+
+class plugin_service : public base_service
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE plugin_service() {}
+
+	core_service * core() const { return _core; }
+
+private slots:
+	INJEQT_SET void set_core_service(core_service *x) { _core = x; }
+	INJEQT_SET void set_plugin_helper(plugin_helper *x) { _helper = x; }
+	INJEQT_DONE void done() { done_order.push_back(_helper ? "plugin_service" : "plugin_service without helper"); }
+
+private:
+	QPointer<core_service> _core;
+	QPointer<plugin_helper> _helper;
+
+};
+
+class plugin_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE plugin_user() {}
+
+private slots:
+	INJEQT_SET void set_plugin_service(plugin_service *) {}
+
+};
+
+class lazy_plugin_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE lazy_plugin_user() {}
+
+private slots:
+	INJEQT_SET void set_plugin_service(injeqt::lazy<plugin_service>) {}
+
+};
+
+class constructed_plugin_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE constructed_plugin_user(plugin_service *) {}
+
+};
+
+class core_module : public injeqt::module
+{
+public:
+	core_module()
+	{
+		add_type<core_service>();
+	}
+	virtual ~core_module() {}
+};
+
+class plugin_module : public injeqt::module
+{
+public:
+	plugin_module()
+	{
+		add_type<plugin_helper>();
+		add_type<plugin_service>();
+	}
+	virtual ~plugin_module() {}
+};
+
+class plugin_user_module : public injeqt::module
+{
+public:
+	plugin_user_module()
+	{
+		add_type<plugin_user>();
+	}
+	virtual ~plugin_user_module() {}
+};
+
+class dependent_users_module : public injeqt::module
+{
+public:
+	dependent_users_module()
+	{
+		add_type<lazy_plugin_user>();
+		add_type<constructed_plugin_user>();
+	}
+	virtual ~dependent_users_module() {}
+};
+
+class remove_module_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void init();
+	void should_destroy_objects_of_removed_module();
+	void should_call_done_methods_with_dependents_first();
+	void should_keep_other_objects();
+	void should_make_shared_interface_available_again();
+	void should_remove_module_passed_to_constructor();
+	void should_allow_to_add_removed_types_again();
+	void should_throw_when_type_left_depends_on_removed_type();
+	void should_not_tear_down_dependents_of_removed_types();
+
+private:
+	template<typename T>
+	injeqt::injector make_injector();
+	template<typename T>
+	std::unique_ptr<injeqt::module> make_module();
+
+};
+
+template<typename T>
+injeqt::injector remove_module_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(make_module<T>());
+	return injeqt::injector{std::move(modules)};
+}
+
+template<typename T>
+std::unique_ptr<injeqt::module> remove_module_behavior_test::make_module()
+{
+	return std::unique_ptr<injeqt::module>{new T{}};
+}
+
+void remove_module_behavior_test::init()
+{
+	done_order.clear();
+}
+
+void remove_module_behavior_test::should_destroy_objects_of_removed_module()
+{
+	auto injector = make_injector<core_module>();
+	auto module = make_module<plugin_module>();
+	auto plugin_module_pointer = module.get();
+	injector.add_module(std::move(module));
+
+	auto plugin = QPointer<plugin_service>{injector.get<plugin_service>()};
+	auto helper = QPointer<plugin_helper>{injector.get<plugin_helper>()};
+	injector.remove_module(plugin_module_pointer);
+
+	QVERIFY(!plugin);
+	QVERIFY(!helper);
+	expect<injeqt::exception::unknown_type>({"plugin_service"}, [&]{
+		injector.get<plugin_service>();
+	});
+	expect<injeqt::exception::unknown_type>({"plugin_helper"}, [&]{
+		injector.get<plugin_helper>();
+	});
+}
+
+void remove_module_behavior_test::should_call_done_methods_with_dependents_first()
+{
+	auto injector = make_injector<core_module>();
+	auto module = make_module<plugin_module>();
+	auto plugin_module_pointer = module.get();
+	injector.add_module(std::move(module));
+
+	injector.get<plugin_service>();
+	injector.remove_module(plugin_module_pointer);
+
+	QCOMPARE(done_order, (std::vector<std::string>{"plugin_service", "plugin_helper"}));
+}
+
+void remove_module_behavior_test::should_keep_other_objects()
+{
+	auto injector = make_injector<core_module>();
+	auto module = make_module<plugin_module>();
+	auto plugin_module_pointer = module.get();
+	injector.add_module(std::move(module));
+
+	auto core = QPointer<core_service>{injector.get<core_service>()};
+	QCOMPARE(injector.get<plugin_service>()->core(), core.data());
+	injector.remove_module(plugin_module_pointer);
+
+	QVERIFY(core);
+	QCOMPARE(injector.get<core_service>(), core.data());
+	QVERIFY(done_order.end() == std::find(done_order.begin(), done_order.end(), "core_service"));
+}
+
+void remove_module_behavior_test::should_make_shared_interface_available_again()
+{
+	auto injector = make_injector<core_module>();
+	auto module = make_module<plugin_module>();
+	auto plugin_module_pointer = module.get();
+	injector.add_module(std::move(module));
+
+	expect<injeqt::exception::unknown_type>({"base_service"}, [&]{
+		injector.get<base_service>();
+	});
+	injector.remove_module(plugin_module_pointer);
+
+	QCOMPARE(injector.get<base_service>(), static_cast<base_service *>(injector.get<core_service>()));
+}
+
+void remove_module_behavior_test::should_remove_module_passed_to_constructor()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(make_module<core_module>());
+	modules.emplace_back(make_module<plugin_module>());
+	auto plugin_module_pointer = modules.back().get();
+	auto injector = injeqt::injector{std::move(modules)};
+
+	auto plugin = QPointer<plugin_service>{injector.get<plugin_service>()};
+	injector.remove_module(plugin_module_pointer);
+
+	QVERIFY(!plugin);
+	QVERIFY(injector.get<core_service>() != nullptr);
+}
+
+void remove_module_behavior_test::should_allow_to_add_removed_types_again()
+{
+	auto injector = make_injector<core_module>();
+	auto module = make_module<plugin_module>();
+	auto plugin_module_pointer = module.get();
+	injector.add_module(std::move(module));
+	injector.get<plugin_service>();
+	injector.remove_module(plugin_module_pointer);
+
+	injector.add_module(make_module<plugin_module>());
+
+	auto plugin = injector.get<plugin_service>();
+	QVERIFY(plugin != nullptr);
+	QCOMPARE(plugin->core(), injector.get<core_service>());
+}
+
+void remove_module_behavior_test::should_throw_when_type_left_depends_on_removed_type()
+{
+	auto injector = make_injector<core_module>();
+	auto module = make_module<plugin_module>();
+	auto plugin_module_pointer = module.get();
+	injector.add_module(std::move(module));
+	injector.add_module(make_module<plugin_user_module>());
+
+	auto plugin = QPointer<plugin_service>{injector.get<plugin_service>()};
+	expect<injeqt::exception::unresolvable_dependencies>({"plugin_user"}, [&]{
+		injector.remove_module(plugin_module_pointer);
+	});
+
+	QVERIFY(plugin);
+	QVERIFY(done_order.empty());
+	QCOMPARE(injector.get<plugin_service>(), plugin.data());
+	QVERIFY(injector.get<plugin_user>() != nullptr);
+}
+
+void remove_module_behavior_test::should_not_tear_down_dependents_of_removed_types()
+{
+	auto injector = make_injector<core_module>();
+	auto module = make_module<plugin_module>();
+	auto plugin_module_pointer = module.get();
+	injector.add_module(std::move(module));
+	injector.add_module(make_module<dependent_users_module>());
+
+	auto lazy_user = QPointer<lazy_plugin_user>{injector.get<lazy_plugin_user>()};
+	auto constructed_user = QPointer<constructed_plugin_user>{injector.get<constructed_plugin_user>()};
+	expect<injeqt::exception::unresolvable_dependencies>({"lazy_plugin_user", "constructed_plugin_user"}, [&]{
+		injector.remove_module(plugin_module_pointer);
+	});
+
+	QVERIFY(lazy_user);
+	QVERIFY(constructed_user);
+	QVERIFY(done_order.empty());
+	QVERIFY(injector.get<plugin_service>() != nullptr);
+}
+
+QTEST_APPLESS_MAIN(remove_module_behavior_test)
+#include "remove-module-behavior-test.moc"
@@ -0,0 +1,327 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/interface-not-implemented.h>
+#include <injeqt/exception/unknown-type.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class settings : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit settings(int value) : _value{value} {}
+	virtual ~settings() {}
+
+	int value() const { return _value; }
+
+private:
+	int _value;
+
+};
+
+class other_settings : public QObject
+{
+	Q_OBJECT
+
+};
+
+class settings_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+	static int init_calls;
+
+	Q_INVOKABLE settings_user() { instances++; }
+	virtual ~settings_user() { instances--; }
+
+	settings * current_settings() const { return _settings; }
+	int set_calls() const { return _set_calls; }
+
+private slots:
+	INJEQT_INIT void init() { init_calls++; }
+	INJEQT_SET void set_settings(settings *x) { _settings = x; _set_calls++; }
+
+private:
+	settings *_settings = nullptr;
+	int _set_calls = 0;
+
+};
+
+int settings_user::instances = 0;
+int settings_user::init_calls = 0;
+
+class unrelated_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE unrelated_service() {}
+
+};
+
+class scoped_settings_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE scoped_settings_user() {}
+
+	settings * current_settings() const { return _settings; }
+
+private slots:
+	INJEQT_SET void set_settings(settings *x) { _settings = x; }
+
+private:
+	settings *_settings = nullptr;
+
+};
+
+class external_settings_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	settings * current_settings() const { return _settings; }
+
+private slots:
+	INJEQT_SET void set_settings(settings *x) { _settings = x; }
+
+private:
+	settings *_settings = nullptr;
+
+};
+
+class settings_module : public injeqt::module
+{
+public:
+	explicit settings_module(settings *s)
+	{
+		add_ready_object<settings>(s);
+		add_type<settings_user>();
+		add_type<unrelated_service>();
+		add_scoped_type<scoped_settings_user>();
+	}
+	virtual ~settings_module() {}
+};
+
+class sub_settings_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE sub_settings_user() {}
+
+	settings * current_settings() const { return _settings; }
+
+private slots:
+	INJEQT_SET void set_settings(settings *x) { _settings = x; }
+
+private:
+	settings *_settings = nullptr;
+
+};
+
+class sub_settings_module : public injeqt::module
+{
+public:
+	sub_settings_module()
+	{
+		add_type<sub_settings_user>();
+	}
+	virtual ~sub_settings_module() {}
+};
+
+class replace_ready_object_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void init();
+	void should_return_new_object();
+	void should_inject_new_object_into_dependents();
+	void should_not_recreate_dependents();
+	void should_inject_new_object_into_scoped_and_external_objects();
+	void should_inject_new_object_after_many_replacements();
+	void should_use_new_object_for_objects_created_later();
+	void should_inject_new_object_into_objects_of_sub_injectors();
+	void should_throw_when_type_is_not_ready_object();
+	void should_throw_when_object_has_wrong_type();
+
+private:
+	injeqt::injector make_injector(settings *s);
+
+};
+
+injeqt::injector replace_ready_object_behavior_test::make_injector(settings *s)
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new settings_module{s}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void replace_ready_object_behavior_test::init()
+{
+	settings_user::init_calls = 0;
+}
+
+void replace_ready_object_behavior_test::should_return_new_object()
+{
+	settings old_settings{1};
+	settings new_settings{2};
+	auto injector = make_injector(&old_settings);
+
+	QCOMPARE(injector.get<settings>(), &old_settings);
+	injector.replace_ready_object<settings>(&new_settings);
+
+	QCOMPARE(injector.get<settings>(), &new_settings);
+}
+
+void replace_ready_object_behavior_test::should_inject_new_object_into_dependents()
+{
+	settings old_settings{1};
+	settings new_settings{2};
+	auto injector = make_injector(&old_settings);
+
+	auto user = injector.get<settings_user>();
+	QCOMPARE(user->current_settings(), &old_settings);
+	injector.replace_ready_object<settings>(&new_settings);
+
+	QCOMPARE(user->current_settings(), &new_settings);
+	QCOMPARE(user->current_settings()->value(), 2);
+}
+
+void replace_ready_object_behavior_test::should_not_recreate_dependents()
+{
+	settings old_settings{1};
+	settings new_settings{2};
+	auto injector = make_injector(&old_settings);
+
+	auto user = injector.get<settings_user>();
+	auto unrelated = injector.get<unrelated_service>();
+	injector.replace_ready_object<settings>(&new_settings);
+
+	QCOMPARE(injector.get<settings_user>(), user);
+	QCOMPARE(injector.get<unrelated_service>(), unrelated);
+	QCOMPARE(settings_user::instances, 1);
+	QCOMPARE(settings_user::init_calls, 1);
+	QCOMPARE(user->set_calls(), 2);
+}
+
+void replace_ready_object_behavior_test::should_inject_new_object_into_scoped_and_external_objects()
+{
+	settings old_settings{1};
+	settings new_settings{2};
+	auto injector = make_injector(&old_settings);
+
+	external_settings_user external{};
+	injector.inject_into(&external);
+	injector.enter_scope();
+	auto scoped = injector.get<scoped_settings_user>();
+	injector.replace_ready_object<settings>(&new_settings);
+
+	QCOMPARE(external.current_settings(), &new_settings);
+	QCOMPARE(scoped->current_settings(), &new_settings);
+	injector.leave_scope();
+}
+
+void replace_ready_object_behavior_test::should_inject_new_object_after_many_replacements()
+{
+	settings settings_1{1};
+	settings settings_2{2};
+	settings settings_3{3};
+	auto injector = make_injector(&settings_1);
+
+	auto user = injector.get<settings_user>();
+	injector.replace_ready_object<settings>(&settings_2);
+	injector.replace_ready_object<settings>(&settings_3);
+
+	QCOMPARE(user->current_settings(), &settings_3);
+	QCOMPARE(user->set_calls(), 3);
+}
+
+void replace_ready_object_behavior_test::should_use_new_object_for_objects_created_later()
+{
+	settings old_settings{1};
+	settings new_settings{2};
+	auto injector = make_injector(&old_settings);
+
+	injector.replace_ready_object<settings>(&new_settings);
+
+	QCOMPARE(injector.get<settings_user>()->current_settings(), &new_settings);
+	QCOMPARE(injector.get<settings_user>()->set_calls(), 1);
+}
+
+void replace_ready_object_behavior_test::should_inject_new_object_into_objects_of_sub_injectors()
+{
+	settings old_settings{1};
+	settings new_settings{2};
+	auto injector = make_injector(&old_settings);
+
+	auto sub_modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	sub_modules.emplace_back(std::unique_ptr<injeqt::module>{new sub_settings_module{}});
+	auto sub_injector = injeqt::injector{std::vector<injeqt::injector *>{&injector}, std::move(sub_modules)};
+	auto sub_sub_injector = injeqt::injector{std::vector<injeqt::injector *>{&sub_injector}, {}};
+
+	auto sub_user = sub_injector.get<sub_settings_user>();
+	external_settings_user external{};
+	sub_sub_injector.inject_into(&external);
+	QCOMPARE(sub_user->current_settings(), &old_settings);
+	QCOMPARE(external.current_settings(), &old_settings);
+
+	injector.replace_ready_object<settings>(&new_settings);
+
+	QCOMPARE(sub_user->current_settings(), &new_settings);
+	QCOMPARE(external.current_settings(), &new_settings);
+	QCOMPARE(sub_injector.get<settings>(), &new_settings);
+}
+
+void replace_ready_object_behavior_test::should_throw_when_type_is_not_ready_object()
+{
+	settings old_settings{1};
+	auto injector = make_injector(&old_settings);
+	settings_user user{};
+
+	expect<injeqt::exception::unknown_type>({"settings_user"}, [&]{
+		injector.replace_ready_object<settings_user>(&user);
+	});
+}
+
+void replace_ready_object_behavior_test::should_throw_when_object_has_wrong_type()
+{
+	settings old_settings{1};
+	auto injector = make_injector(&old_settings);
+	other_settings wrong{};
+
+	expect<injeqt::exception::interface_not_implemented>({"other_settings", "settings"}, [&]{
+		injector.replace_ready_object<settings>(&wrong);
+	});
+	QCOMPARE(injector.get<settings>(), &old_settings);
+}
+
+QTEST_APPLESS_MAIN(replace_ready_object_behavior_test)
+#include "replace-ready-object-behavior-test.moc"
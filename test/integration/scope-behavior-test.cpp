@@ -0,0 +1,314 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/dependency-on-scoped-type.h>
+#include <injeqt/exception/no-active-scope.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service() {}
+
+};
+
+class request_data : public QObject
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+
+	Q_INVOKABLE request_data() { instances++; }
+	virtual ~request_data() { instances--; }
+
+};
+
+int request_data::instances = 0;
+
+class request_handler : public QObject
+{
+	Q_OBJECT
+
+public:
+	static std::vector<std::string> done_calls;
+
+	Q_INVOKABLE request_handler() {}
+
+	service * get_service() const { return _service; }
+	request_data * data() const { return _request_data; }
+
+private slots:
+	INJEQT_SET void set_service(service *x) { _service = x; }
+	INJEQT_SET void set_request_data(request_data *x) { _request_data = x; }
+	INJEQT_DONE void done()
+	{
+		QVERIFY(_request_data);
+		done_calls.push_back("request_handler");
+	}
+
+private:
+	QPointer<service> _service;
+	QPointer<request_data> _request_data;
+
+};
+
+std::vector<std::string> request_handler::done_calls;
+
+class service_using_request : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_using_request() {}
+
+private slots:
+	INJEQT_SET void set_request_data(request_data *) {}
+
+};
+
+class injectable : public QObject
+{
+	Q_OBJECT
+
+public:
+	request_data * data() const { return _request_data; }
+
+private slots:
+	INJEQT_SET void set_request_data(request_data *x) { _request_data = x; }
+
+private:
+	QPointer<request_data> _request_data;
+
+};
+
+class scoped_module : public injeqt::module
+{
+public:
+	scoped_module()
+	{
+		add_type<service>();
+		add_scoped_type<request_data>();
+		add_scoped_type<request_handler>();
+	}
+	virtual ~scoped_module() {}
+};
+
+class invalid_scoped_module : public injeqt::module
+{
+public:
+	invalid_scoped_module()
+	{
+		add_scoped_type<request_data>();
+		add_type<service_using_request>();
+	}
+	virtual ~invalid_scoped_module() {}
+};
+
+class scope_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void init();
+	void should_throw_when_no_scope_is_active();
+	void should_throw_when_leaving_without_scope();
+	void should_throw_when_unscoped_type_depends_on_scoped_type();
+	void should_return_the_same_object_in_one_scope();
+	void should_return_new_objects_in_new_scope();
+	void should_share_unscoped_objects_between_scopes();
+	void should_destroy_scoped_objects_when_leaving_scope();
+	void should_call_done_methods_when_leaving_scope();
+	void should_use_innermost_scope();
+	void should_leave_active_scopes_on_destruction();
+	void should_inject_scoped_objects_into();
+
+private:
+	injeqt::injector make_injector();
+
+};
+
+injeqt::injector scope_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new scoped_module{}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void scope_behavior_test::init()
+{
+	request_handler::done_calls.clear();
+}
+
+void scope_behavior_test::should_throw_when_no_scope_is_active()
+{
+	auto injector = make_injector();
+
+	expect<injeqt::exception::no_active_scope>({"request_data"}, [&]{
+		injector.get<request_data>();
+	});
+	expect<injeqt::exception::no_active_scope>({"request_handler"}, [&]{
+		injector.get<request_handler>();
+	});
+}
+
+void scope_behavior_test::should_throw_when_leaving_without_scope()
+{
+	auto injector = make_injector();
+
+	expect<injeqt::exception::no_active_scope>([&]{
+		injector.leave_scope();
+	});
+}
+
+void scope_behavior_test::should_throw_when_unscoped_type_depends_on_scoped_type()
+{
+	expect<injeqt::exception::dependency_on_scoped_type>({"service_using_request"}, [&]{
+		auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+		modules.emplace_back(std::unique_ptr<injeqt::module>{new invalid_scoped_module{}});
+		auto injector = injeqt::injector{std::move(modules)};
+	});
+}
+
+void scope_behavior_test::should_return_the_same_object_in_one_scope()
+{
+	auto injector = make_injector();
+	injector.enter_scope();
+
+	auto handler = injector.get<request_handler>();
+	QVERIFY(handler != nullptr);
+	QCOMPARE(injector.get<request_handler>(), handler);
+	QCOMPARE(handler->data(), injector.get<request_data>());
+	QCOMPARE(request_data::instances, 1);
+}
+
+void scope_behavior_test::should_return_new_objects_in_new_scope()
+{
+	auto injector = make_injector();
+
+	injector.enter_scope();
+	auto data1 = QPointer<request_data>{injector.get<request_data>()};
+	injector.leave_scope();
+
+	injector.enter_scope();
+	auto data2 = injector.get<request_data>();
+	QVERIFY(data2 != nullptr);
+	QVERIFY(data1.isNull());
+	QCOMPARE(request_data::instances, 1);
+}
+
+void scope_behavior_test::should_share_unscoped_objects_between_scopes()
+{
+	auto injector = make_injector();
+
+	injector.enter_scope();
+	auto service1 = injector.get<request_handler>()->get_service();
+	injector.leave_scope();
+
+	injector.enter_scope();
+	auto service2 = injector.get<request_handler>()->get_service();
+	injector.leave_scope();
+
+	QVERIFY(service1 != nullptr);
+	QCOMPARE(service1, service2);
+	QCOMPARE(injector.get<service>(), service1);
+}
+
+void scope_behavior_test::should_destroy_scoped_objects_when_leaving_scope()
+{
+	auto injector = make_injector();
+
+	injector.enter_scope();
+	auto handler = QPointer<request_handler>{injector.get<request_handler>()};
+	QCOMPARE(request_data::instances, 1);
+	injector.leave_scope();
+
+	QVERIFY(handler.isNull());
+	QCOMPARE(request_data::instances, 0);
+}
+
+void scope_behavior_test::should_call_done_methods_when_leaving_scope()
+{
+	auto injector = make_injector();
+
+	injector.enter_scope();
+	injector.get<request_handler>();
+	QVERIFY(request_handler::done_calls.empty());
+	injector.leave_scope();
+
+	QCOMPARE(request_handler::done_calls, (std::vector<std::string>{"request_handler"}));
+}
+
+void scope_behavior_test::should_use_innermost_scope()
+{
+	auto injector = make_injector();
+
+	injector.enter_scope();
+	auto outer = injector.get<request_data>();
+
+	injector.enter_scope();
+	auto inner = injector.get<request_data>();
+	QVERIFY(inner != outer);
+	QCOMPARE(request_data::instances, 2);
+	injector.leave_scope();
+
+	QCOMPARE(injector.get<request_data>(), outer);
+	QCOMPARE(request_data::instances, 1);
+	injector.leave_scope();
+}
+
+void scope_behavior_test::should_leave_active_scopes_on_destruction()
+{
+	{
+		auto injector = make_injector();
+		injector.enter_scope();
+		injector.get<request_handler>();
+		injector.enter_scope();
+		injector.get<request_handler>();
+		QCOMPARE(request_data::instances, 2);
+	}
+
+	QCOMPARE(request_data::instances, 0);
+	QVERIFY(request_handler::done_calls.size() == 2);
+}
+
+void scope_behavior_test::should_inject_scoped_objects_into()
+{
+	auto injector = make_injector();
+	auto object = injectable{};
+
+	injector.enter_scope();
+	injector.inject_into(&object);
+	QVERIFY(object.data() != nullptr);
+	QCOMPARE(object.data(), injector.get<request_data>());
+	injector.leave_scope();
+
+	QVERIFY(object.data() == nullptr);
+}
+
+QTEST_APPLESS_MAIN(scope_behavior_test)
+#include "scope-behavior-test.moc"
@@ -0,0 +1,273 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/unavailable-required-types.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class plugin : public QObject
+{
+	Q_OBJECT
+
+public:
+	virtual ~plugin() {}
+
+};
+
+class first_plugin : public plugin
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE first_plugin() {}
+
+};
+
+class second_plugin : public plugin
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE second_plugin() {}
+
+};
+
+class third_plugin : public plugin
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE third_plugin() {}
+
+};
+
+class unused_set : public QObject
+{
+	Q_OBJECT
+};
+
+class plugin_registry : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE plugin_registry() {}
+
+	const injeqt::set_of<plugin> & plugins() const { return _plugins; }
+
+private slots:
+	INJEQT_SET void set_plugins(injeqt::set_of<plugin> plugins) { _plugins = plugins; }
+
+private:
+	injeqt::set_of<plugin> _plugins;
+
+};
+
+class other_plugin_registry : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE other_plugin_registry() {}
+
+	const injeqt::set_of<plugin> & plugins() const { return _plugins; }
+
+private slots:
+	INJEQT_SET void set_plugins(injeqt::set_of<plugin> plugins) { _plugins = plugins; }
+
+private:
+	injeqt::set_of<plugin> _plugins;
+
+};
+
+class registry_module : public injeqt::module
+{
+public:
+	registry_module()
+	{
+		add_type<plugin_registry>();
+		add_type<other_plugin_registry>();
+	}
+	virtual ~registry_module() {}
+};
+
+class first_plugin_module : public injeqt::module
+{
+public:
+	first_plugin_module()
+	{
+		add_type<first_plugin>();
+		add_to_set<plugin, first_plugin>();
+	}
+	virtual ~first_plugin_module() {}
+};
+
+class second_plugin_module : public injeqt::module
+{
+public:
+	second_plugin_module()
+	{
+		add_type<second_plugin>();
+		add_to_set<plugin, second_plugin>();
+	}
+	virtual ~second_plugin_module() {}
+};
+
+class third_plugin_module : public injeqt::module
+{
+public:
+	third_plugin_module()
+	{
+		add_type<third_plugin>();
+		add_to_set<plugin, third_plugin>();
+	}
+	virtual ~third_plugin_module() {}
+};
+
+class not_configured_plugin_module : public injeqt::module
+{
+public:
+	not_configured_plugin_module()
+	{
+		add_to_set<plugin, third_plugin>();
+	}
+	virtual ~not_configured_plugin_module() {}
+};
+
+class set_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_inject_all_members_in_order_of_modules();
+	void should_share_one_list_between_consumers();
+	void should_return_empty_set_without_members();
+	void should_throw_when_member_is_not_configured();
+	void should_start_with_members_of_super_injector();
+	void should_include_members_of_added_module();
+	void should_inject_set_without_members_of_removed_module();
+
+private:
+	std::vector<std::unique_ptr<injeqt::module>> make_modules();
+
+};
+
+std::vector<std::unique_ptr<injeqt::module>> set_behavior_test::make_modules()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new registry_module{}});
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new first_plugin_module{}});
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new second_plugin_module{}});
+	return modules;
+}
+
+void set_behavior_test::should_inject_all_members_in_order_of_modules()
+{
+	auto injector = injeqt::injector{make_modules()};
+
+	auto plugins = injector.get<plugin_registry>()->plugins();
+	QVERIFY(plugins.set_type() == injeqt::make_type<plugin>());
+	QCOMPARE(plugins.size(), std::size_t{2});
+	QCOMPARE(plugins.at<first_plugin>(0), injector.get<first_plugin>());
+	QCOMPARE(plugins.at<second_plugin>(1), injector.get<second_plugin>());
+}
+
+void set_behavior_test::should_share_one_list_between_consumers()
+{
+	auto injector = injeqt::injector{make_modules()};
+
+	auto &plugins = injector.get<plugin_registry>()->plugins().objects();
+	auto &other_plugins = injector.get<other_plugin_registry>()->plugins().objects();
+	QCOMPARE(&plugins, &other_plugins);
+	QCOMPARE(&injector.get_set<plugin>().objects(), &plugins);
+}
+
+void set_behavior_test::should_return_empty_set_without_members()
+{
+	auto injector = injeqt::injector{make_modules()};
+
+	auto unused = injector.get_set<unused_set>();
+	QVERIFY(unused.empty());
+	QVERIFY(unused.begin() == unused.end());
+}
+
+void set_behavior_test::should_throw_when_member_is_not_configured()
+{
+	expect<injeqt::exception::unavailable_required_types>({"third_plugin"}, [&]{
+		auto modules = make_modules();
+		modules.emplace_back(std::unique_ptr<injeqt::module>{new not_configured_plugin_module{}});
+		auto injector = injeqt::injector{std::move(modules)};
+	});
+}
+
+void set_behavior_test::should_start_with_members_of_super_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new first_plugin_module{}});
+	auto super = injeqt::injector{std::move(modules)};
+
+	modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new registry_module{}});
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new second_plugin_module{}});
+	auto sub = injeqt::injector{std::vector<injeqt::injector *>{&super}, std::move(modules)};
+
+	auto plugins = sub.get<plugin_registry>()->plugins();
+	QCOMPARE(plugins.size(), std::size_t{2});
+	QCOMPARE(plugins.at<first_plugin>(0), super.get<first_plugin>());
+	QCOMPARE(plugins.at<second_plugin>(1), sub.get<second_plugin>());
+	QCOMPARE(super.get_set<plugin>().size(), std::size_t{1});
+}
+
+void set_behavior_test::should_include_members_of_added_module()
+{
+	auto injector = injeqt::injector{make_modules()};
+	auto plugins = injector.get_set<plugin>();
+
+	injector.add_module(std::unique_ptr<injeqt::module>{new third_plugin_module{}});
+
+	auto new_plugins = injector.get_set<plugin>();
+	QCOMPARE(plugins.size(), std::size_t{2});
+	QCOMPARE(new_plugins.size(), std::size_t{3});
+	QCOMPARE(new_plugins.at<third_plugin>(2), injector.get<third_plugin>());
+}
+
+void set_behavior_test::should_inject_set_without_members_of_removed_module()
+{
+	auto modules = make_modules();
+	auto removed_module = modules.back().get();
+	auto injector = injeqt::injector{std::move(modules)};
+	auto registry = QPointer<plugin_registry>{injector.get<plugin_registry>()};
+	QCOMPARE(registry->plugins().size(), std::size_t{2});
+
+	injector.remove_module(removed_module);
+
+	QVERIFY(registry);
+	QCOMPARE(injector.get<plugin_registry>(), registry.data());
+	QCOMPARE(registry->plugins().size(), std::size_t{1});
+	QCOMPARE(registry->plugins().at<first_plugin>(0), injector.get<first_plugin>());
+	QCOMPARE(&injector.get_set<plugin>().objects(), &registry->plugins().objects());
+}
+
+QTEST_APPLESS_MAIN(set_behavior_test)
+#include "set-behavior-test.moc"
@@ -0,0 +1,159 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QtTest>
+#include <fstream>
+
+class early_dependency : public QObject
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+
+	Q_INVOKABLE early_dependency() { instances++; }
+	virtual ~early_dependency() { instances--; }
+
+};
+
+int early_dependency::instances = 0;
+
+class early_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+
+	Q_INVOKABLE early_service() { instances++; }
+	virtual ~early_service() { instances--; }
+
+private slots:
+	INJEQT_SET void set_early_dependency(early_dependency *) {}
+
+};
+
+int early_service::instances = 0;
+
+class late_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+
+	Q_INVOKABLE late_service() { instances++; }
+	virtual ~late_service() { instances--; }
+
+};
+
+int late_service::instances = 0;
+
+class profile_module : public injeqt::module
+{
+public:
+	profile_module()
+	{
+		add_type<early_dependency>();
+		add_type<early_service>();
+		add_type<late_service>();
+	}
+	virtual ~profile_module() {}
+};
+
+class startup_profile_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_prewarm_types_recorded_in_previous_run();
+	void should_skip_types_not_configured_anymore();
+	void should_not_prewarm_without_profile();
+
+private:
+	injeqt::injector make_injector();
+	std::string file_name(const QTemporaryDir &dir);
+
+};
+
+injeqt::injector startup_profile_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new profile_module{}});
+	return injeqt::injector{std::move(modules)};
+}
+
+std::string startup_profile_behavior_test::file_name(const QTemporaryDir &dir)
+{
+	return (dir.path() + "/profile").toStdString();
+}
+
+void startup_profile_behavior_test::should_prewarm_types_recorded_in_previous_run()
+{
+	QTemporaryDir dir;
+	{
+		auto injector = make_injector();
+		injector.start_profile_recording(std::chrono::milliseconds{60000});
+		injector.get<early_service>();
+		QVERIFY(injector.save_profile(file_name(dir)));
+	}
+
+	auto injector = make_injector();
+	auto finished = 0;
+	QVERIFY(injector.start_prewarm_from_profile(file_name(dir), std::chrono::milliseconds{4}, [&]{ finished++; }));
+	QCOMPARE(early_service::instances, 0);
+
+	QTRY_COMPARE(finished, 1);
+	QCOMPARE(early_service::instances, 1);
+	QCOMPARE(early_dependency::instances, 1);
+	QCOMPARE(late_service::instances, 0);
+}
+
+void startup_profile_behavior_test::should_skip_types_not_configured_anymore()
+{
+	QTemporaryDir dir;
+	{
+		std::ofstream file{file_name(dir)};
+		file << "injeqt-startup-profile 1\n" << "0 1 removed_service\n" << "5 1 late_service\n";
+	}
+
+	auto injector = make_injector();
+	QVERIFY(injector.start_prewarm_from_profile(file_name(dir)));
+
+	QTRY_VERIFY(!injector.is_warming_up());
+	QCOMPARE(late_service::instances, 1);
+	QCOMPARE(early_service::instances, 0);
+}
+
+void startup_profile_behavior_test::should_not_prewarm_without_profile()
+{
+	QTemporaryDir dir;
+	auto injector = make_injector();
+
+	QVERIFY(!injector.start_prewarm_from_profile(file_name(dir)));
+	QVERIFY(!injector.is_warming_up());
+}
+
+QTEST_GUILESS_MAIN(startup_profile_behavior_test)
+#include "startup-profile-behavior-test.moc"
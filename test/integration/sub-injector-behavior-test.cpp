@@ -0,0 +1,238 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/ambiguous-types.h>
+#include <injeqt/exception/unknown-type.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class base_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	base_service() {}
+	virtual ~base_service() {}
+
+};
+
+class parent_service : public base_service
+{
+	Q_OBJECT
+
+public:
+	static int instances;
+
+	Q_INVOKABLE parent_service() { instances++; }
+	virtual ~parent_service() { instances--; }
+
+};
+
+int parent_service::instances = 0;
+
+class other_parent_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE other_parent_service() {}
+
+};
+
+class child_service : public base_service
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE child_service() {}
+	parent_service * parent() const { return _parent_service; }
+
+private slots:
+	INJEQT_SET void set_parent_service(parent_service *x) { _parent_service = x; }
+
+private:
+	QPointer<parent_service> _parent_service;
+
+};
+
+class parent_module : public injeqt::module
+{
+public:
+	parent_module()
+	{
+		add_type<parent_service>();
+		add_type<other_parent_service>();
+	}
+	virtual ~parent_module() {}
+};
+
+class child_module : public injeqt::module
+{
+public:
+	child_module()
+	{
+		add_type<child_service>();
+	}
+	virtual ~child_module() {}
+};
+
+class duplicating_module : public injeqt::module
+{
+public:
+	duplicating_module()
+	{
+		add_type<parent_service>();
+	}
+	virtual ~duplicating_module() {}
+};
+
+class sub_injector_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_not_instantiate_parent_objects_on_creation();
+	void should_inject_objects_from_parent();
+	void should_return_objects_from_parent();
+	void should_not_make_common_supertype_available();
+	void should_throw_when_type_configured_in_parent();
+	void should_work_with_many_children();
+	void should_inject_objects_from_deep_chain();
+
+private:
+	injeqt::injector make_parent_injector();
+
+};
+
+injeqt::injector sub_injector_behavior_test::make_parent_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new parent_module{}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void sub_injector_behavior_test::should_not_instantiate_parent_objects_on_creation()
+{
+	auto parent = make_parent_injector();
+
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new child_module{}});
+	auto child = injeqt::injector{std::vector<injeqt::injector *>{&parent}, std::move(modules)};
+
+	QCOMPARE(parent_service::instances, 0);
+}
+
+void sub_injector_behavior_test::should_inject_objects_from_parent()
+{
+	auto parent = make_parent_injector();
+
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new child_module{}});
+	auto child = injeqt::injector{std::vector<injeqt::injector *>{&parent}, std::move(modules)};
+
+	auto service = child.get<child_service>();
+	QVERIFY(service->parent() != nullptr);
+	QCOMPARE(service->parent(), parent.get<parent_service>());
+	QCOMPARE(parent_service::instances, 1);
+}
+
+void sub_injector_behavior_test::should_return_objects_from_parent()
+{
+	auto parent = make_parent_injector();
+
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new child_module{}});
+	auto child = injeqt::injector{std::vector<injeqt::injector *>{&parent}, std::move(modules)};
+
+	auto from_child = child.get<other_parent_service>();
+	QVERIFY(from_child != nullptr);
+	QCOMPARE(from_child, parent.get<other_parent_service>());
+}
+
+void sub_injector_behavior_test::should_not_make_common_supertype_available()
+{
+	auto parent = make_parent_injector();
+
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new child_module{}});
+	auto child = injeqt::injector{std::vector<injeqt::injector *>{&parent}, std::move(modules)};
+
+	QVERIFY(parent.get<base_service>() != nullptr);
+	expect<injeqt::exception::unknown_type>([&]{
+		child.get<base_service>();
+	});
+}
+
+void sub_injector_behavior_test::should_throw_when_type_configured_in_parent()
+{
+	auto parent = make_parent_injector();
+
+	expect<injeqt::exception::ambiguous_types>({"parent_service"}, [&]{
+		auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+		modules.emplace_back(std::unique_ptr<injeqt::module>{new duplicating_module{}});
+		auto child = injeqt::injector{std::vector<injeqt::injector *>{&parent}, std::move(modules)};
+	});
+}
+
+void sub_injector_behavior_test::should_work_with_many_children()
+{
+	auto parent = make_parent_injector();
+	auto first_parent_service = static_cast<parent_service *>(nullptr);
+
+	for (auto i = 0; i < 10; i++)
+	{
+		auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+		modules.emplace_back(std::unique_ptr<injeqt::module>{new child_module{}});
+		auto child = injeqt::injector{std::vector<injeqt::injector *>{&parent}, std::move(modules)};
+
+		auto service = child.get<child_service>();
+		if (!first_parent_service)
+			first_parent_service = service->parent();
+		QCOMPARE(service->parent(), first_parent_service);
+	}
+
+	QCOMPARE(parent_service::instances, 1);
+}
+
+void sub_injector_behavior_test::should_inject_objects_from_deep_chain()
+{
+	auto chain = std::vector<std::unique_ptr<injeqt::injector>>{};
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new parent_module{}});
+	chain.emplace_back(std::unique_ptr<injeqt::injector>{new injeqt::injector{std::move(modules)}});
+	for (auto i = 0; i < 8; i++)
+		chain.emplace_back(std::unique_ptr<injeqt::injector>{new injeqt::injector{std::vector<injeqt::injector *>{chain.back().get()}, {}}});
+
+	modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new child_module{}});
+	auto leaf = injeqt::injector{std::vector<injeqt::injector *>{chain.back().get()}, std::move(modules)};
+
+	auto service = leaf.get<child_service>();
+	QCOMPARE(service->parent(), chain.front()->get<parent_service>());
+	QCOMPARE(leaf.get<other_parent_service>(), chain.front()->get<other_parent_service>());
+	QCOMPARE(parent_service::instances, 1);
+}
+
+QTEST_APPLESS_MAIN(sub_injector_behavior_test)
+#include "sub-injector-behavior-test.moc"
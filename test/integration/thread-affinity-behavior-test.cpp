@@ -0,0 +1,200 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/instantiation-failed.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class dependency_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE dependency_service() : _constructor_thread{QThread::currentThread()} {}
+
+	QThread * constructor_thread() const { return _constructor_thread; }
+
+private:
+	QThread *_constructor_thread;
+
+};
+
+class affine_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE affine_service() : _constructor_thread{QThread::currentThread()}, _init_thread{nullptr} {}
+
+	QThread * constructor_thread() const { return _constructor_thread; }
+	QThread * init_thread() const { return _init_thread; }
+	dependency_service * dependency() const { return _dependency; }
+
+private slots:
+	INJEQT_INIT void init() { _init_thread = QThread::currentThread(); }
+	INJEQT_SET void set_dependency_service(dependency_service *x) { _dependency = x; }
+
+private:
+	QThread *_constructor_thread;
+	QThread *_init_thread;
+	QPointer<dependency_service> _dependency;
+
+};
+
+class moving_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	static QThread *target_thread;
+
+	Q_INVOKABLE moving_service() : _init_thread{nullptr} { moveToThread(target_thread); }
+
+	QThread * init_thread() const { return _init_thread; }
+
+private slots:
+	INJEQT_INIT void init() { _init_thread = QThread::currentThread(); }
+
+private:
+	QThread *_init_thread;
+
+};
+
+QThread *moving_service::target_thread = nullptr;
+
+class moving_module : public injeqt::module
+{
+public:
+	moving_module()
+	{
+		add_type<moving_service>();
+	}
+	virtual ~moving_module() {}
+};
+
+class affine_module : public injeqt::module
+{
+public:
+	explicit affine_module(QThread *thread)
+	{
+		add_type<dependency_service>();
+		add_thread_affine_type<affine_service>(thread);
+	}
+	virtual ~affine_module() {}
+};
+
+class thread_affinity_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_construct_and_init_on_running_thread();
+	void should_move_to_not_running_thread();
+	void should_construct_once_on_running_thread();
+	void should_init_moved_object_of_not_affine_type_on_current_thread();
+
+private:
+	injeqt::injector make_injector(QThread *thread);
+
+};
+
+injeqt::injector thread_affinity_behavior_test::make_injector(QThread *thread)
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new affine_module{thread}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void thread_affinity_behavior_test::should_construct_and_init_on_running_thread()
+{
+	QThread thread;
+	thread.start();
+
+	{
+		auto injector = make_injector(&thread);
+		auto service = injector.get<affine_service>();
+
+		QCOMPARE(service->constructor_thread(), &thread);
+		QCOMPARE(service->init_thread(), &thread);
+		QCOMPARE(service->thread(), &thread);
+		QVERIFY(service->dependency() != nullptr);
+		QCOMPARE(service->dependency()->constructor_thread(), QThread::currentThread());
+		QCOMPARE(service->dependency()->thread(), QThread::currentThread());
+	}
+
+	thread.quit();
+	thread.wait();
+}
+
+void thread_affinity_behavior_test::should_move_to_not_running_thread()
+{
+	QThread thread;
+	auto injector = make_injector(&thread);
+	auto service = injector.get<affine_service>();
+
+	QCOMPARE(service->constructor_thread(), QThread::currentThread());
+	QCOMPARE(service->init_thread(), QThread::currentThread());
+	QCOMPARE(service->thread(), &thread);
+}
+
+void thread_affinity_behavior_test::should_construct_once_on_running_thread()
+{
+	QThread thread;
+	thread.start();
+
+	{
+		auto injector = make_injector(&thread);
+		auto service = injector.get<affine_service>();
+
+		QCOMPARE(injector.get<affine_service>(), service);
+		QCOMPARE(service->thread(), &thread);
+	}
+
+	thread.quit();
+	thread.wait();
+}
+
+void thread_affinity_behavior_test::should_init_moved_object_of_not_affine_type_on_current_thread()
+{
+	QThread thread;
+	thread.start();
+	moving_service::target_thread = &thread;
+
+	{
+		auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+		modules.emplace_back(std::unique_ptr<injeqt::module>{new moving_module{}});
+		auto injector = injeqt::injector{std::move(modules)};
+		auto service = injector.get<moving_service>();
+
+		QCOMPARE(service->thread(), &thread);
+		QCOMPARE(service->init_thread(), QThread::currentThread());
+	}
+
+	moving_service::target_thread = nullptr;
+	thread.quit();
+	thread.wait();
+}
+
+QTEST_GUILESS_MAIN(thread_affinity_behavior_test)
+#include "thread-affinity-behavior-test.moc"
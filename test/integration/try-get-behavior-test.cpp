@@ -0,0 +1,175 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/instantiation-failed.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class configured_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE configured_service() {}
+
+};
+
+class unknown_service : public QObject
+{
+	Q_OBJECT
+
+};
+
+class broken_service : public QObject
+{
+	Q_OBJECT
+
+};
+
+class broken_service_factory : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE broken_service_factory() {}
+	Q_INVOKABLE broken_service * create() { return nullptr; }
+
+};
+
+class try_get_module : public injeqt::module
+{
+public:
+	try_get_module()
+	{
+		add_type<configured_service>();
+		add_type<broken_service_factory>();
+		add_factory<broken_service, broken_service_factory>();
+	}
+	virtual ~try_get_module() {}
+};
+
+class try_get_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_return_configured_object();
+	void should_return_null_for_unknown_type();
+	void should_throw_when_instantiation_failed();
+	void should_report_status();
+	void should_instantiate_configured_object();
+	void should_not_instantiate_unknown_type();
+	void should_report_instantiation_status();
+	void should_return_objects_from_super_injector();
+
+private:
+	injeqt::injector make_injector();
+
+};
+
+injeqt::injector try_get_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new try_get_module{}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void try_get_behavior_test::should_return_configured_object()
+{
+	auto injector = make_injector();
+	auto service = injector.try_get<configured_service>();
+
+	QVERIFY(service != nullptr);
+	QCOMPARE(service, injector.get<configured_service>());
+}
+
+void try_get_behavior_test::should_return_null_for_unknown_type()
+{
+	auto injector = make_injector();
+
+	QVERIFY(injector.try_get<unknown_service>() == nullptr);
+	QVERIFY(injector.try_get<QObject>() == nullptr);
+}
+
+void try_get_behavior_test::should_throw_when_instantiation_failed()
+{
+	auto injector = make_injector();
+
+	expect<injeqt::exception::instantiation_failed>([&]{
+		injector.try_get<broken_service>();
+	});
+}
+
+void try_get_behavior_test::should_report_status()
+{
+	auto injector = make_injector();
+	auto status = injeqt::try_status::ok;
+
+	QVERIFY(injector.try_get<configured_service>(status) != nullptr);
+	QVERIFY(status == injeqt::try_status::ok);
+	QVERIFY(injector.try_get<unknown_service>(status) == nullptr);
+	QVERIFY(status == injeqt::try_status::unknown_type);
+	QVERIFY(injector.try_get<broken_service>(status) == nullptr);
+	QVERIFY(status == injeqt::try_status::failed);
+}
+
+void try_get_behavior_test::should_instantiate_configured_object()
+{
+	auto injector = make_injector();
+
+	QVERIFY(injector.try_instantiate<configured_service>());
+	QVERIFY(injector.get<configured_service>() != nullptr);
+}
+
+void try_get_behavior_test::should_not_instantiate_unknown_type()
+{
+	auto injector = make_injector();
+
+	QVERIFY(!injector.try_instantiate<unknown_service>());
+}
+
+void try_get_behavior_test::should_report_instantiation_status()
+{
+	auto injector = make_injector();
+	auto status = injeqt::try_status::ok;
+
+	QVERIFY(injector.try_instantiate<configured_service>(status));
+	QVERIFY(status == injeqt::try_status::ok);
+	QVERIFY(!injector.try_instantiate<unknown_service>(status));
+	QVERIFY(status == injeqt::try_status::unknown_type);
+	QVERIFY(!injector.try_instantiate<broken_service>(status));
+	QVERIFY(status == injeqt::try_status::failed);
+}
+
+void try_get_behavior_test::should_return_objects_from_super_injector()
+{
+	auto super_injector = make_injector();
+	auto sub_injector = injeqt::injector{std::vector<injeqt::injector *>{&super_injector}, {}};
+
+	QCOMPARE(sub_injector.try_get<configured_service>(), super_injector.get<configured_service>());
+	QVERIFY(sub_injector.try_get<unknown_service>() == nullptr);
+}
+
+QTEST_APPLESS_MAIN(try_get_behavior_test)
+#include "try-get-behavior-test.moc"
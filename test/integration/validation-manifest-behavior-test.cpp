@@ -0,0 +1,199 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../unit/expect.h"
+
+#include <injeqt/exception/unresolvable-dependencies.h>
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+
+class service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service() {}
+
+};
+
+class other_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE other_service() {}
+
+};
+
+class service_user : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_user() {}
+
+	service * used_service() const { return _service; }
+
+private slots:
+	INJEQT_SET void set_service(service *x) { _service = x; }
+
+private:
+	service *_service = nullptr;
+
+};
+
+class service_module : public injeqt::module
+{
+public:
+	service_module()
+	{
+		add_type<service>();
+		add_type<service_user>();
+	}
+	virtual ~service_module() {}
+};
+
+class other_service_module : public injeqt::module
+{
+public:
+	other_service_module()
+	{
+		add_type<other_service>();
+	}
+	virtual ~other_service_module() {}
+};
+
+class user_module : public injeqt::module
+{
+public:
+	user_module()
+	{
+		add_type<service_user>();
+	}
+	virtual ~user_module() {}
+};
+
+class prototype_service_module : public injeqt::module
+{
+public:
+	prototype_service_module()
+	{
+		add_prototype<service>();
+		add_type<service_user>();
+	}
+	virtual ~prototype_service_module() {}
+};
+
+class validation_manifest_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_return_the_same_manifest_for_the_same_configuration();
+	void should_not_depend_on_order_of_modules();
+	void should_return_other_manifest_for_other_types();
+	void should_return_other_manifest_for_other_kinds_of_types();
+	void should_include_types_of_super_injectors();
+	void should_work_with_matching_manifest();
+	void should_validate_when_manifest_does_not_match();
+
+private:
+	template<typename... T>
+	std::vector<std::unique_ptr<injeqt::module>> make_modules();
+
+};
+
+template<typename... T>
+std::vector<std::unique_ptr<injeqt::module>> validation_manifest_behavior_test::make_modules()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	int add[] = {0, (modules.emplace_back(std::unique_ptr<injeqt::module>{new T{}}), 0)...};
+	(void)add;
+	return modules;
+}
+
+void validation_manifest_behavior_test::should_return_the_same_manifest_for_the_same_configuration()
+{
+	auto injector_1 = injeqt::injector{make_modules<service_module>()};
+	auto injector_2 = injeqt::injector{make_modules<service_module>()};
+
+	QVERIFY(!injector_1.validation_manifest().empty());
+	QCOMPARE(injector_1.validation_manifest(), injector_2.validation_manifest());
+}
+
+void validation_manifest_behavior_test::should_not_depend_on_order_of_modules()
+{
+	auto injector_1 = injeqt::injector{make_modules<service_module, other_service_module>()};
+	auto injector_2 = injeqt::injector{make_modules<other_service_module, service_module>()};
+
+	QCOMPARE(injector_1.validation_manifest(), injector_2.validation_manifest());
+}
+
+void validation_manifest_behavior_test::should_return_other_manifest_for_other_types()
+{
+	auto injector_1 = injeqt::injector{make_modules<service_module>()};
+	auto injector_2 = injeqt::injector{make_modules<service_module, other_service_module>()};
+
+	QVERIFY(injector_1.validation_manifest() != injector_2.validation_manifest());
+}
+
+void validation_manifest_behavior_test::should_return_other_manifest_for_other_kinds_of_types()
+{
+	auto injector_1 = injeqt::injector{make_modules<service_module>()};
+	auto injector_2 = injeqt::injector{make_modules<prototype_service_module>()};
+
+	QVERIFY(injector_1.validation_manifest() != injector_2.validation_manifest());
+}
+
+void validation_manifest_behavior_test::should_include_types_of_super_injectors()
+{
+	auto super_1 = injeqt::injector{make_modules<service_module>()};
+	auto super_2 = injeqt::injector{make_modules<service_module, other_service_module>()};
+	auto sub_1 = injeqt::injector{std::vector<injeqt::injector *>{&super_1}, make_modules<>()};
+	auto sub_2 = injeqt::injector{std::vector<injeqt::injector *>{&super_2}, make_modules<>()};
+
+	QVERIFY(sub_1.validation_manifest() != sub_2.validation_manifest());
+}
+
+void validation_manifest_behavior_test::should_work_with_matching_manifest()
+{
+	auto manifest = injeqt::injector{make_modules<service_module>()}.validation_manifest();
+	auto injector = injeqt::injector{make_modules<service_module>(), manifest};
+
+	QCOMPARE(injector.validation_manifest(), manifest);
+	QCOMPARE(injector.get<service_user>()->used_service(), injector.get<service>());
+}
+
+void validation_manifest_behavior_test::should_validate_when_manifest_does_not_match()
+{
+	auto manifest = injeqt::injector{make_modules<service_module>()}.validation_manifest();
+
+	expect<injeqt::exception::unresolvable_dependencies>({"service"}, [&]{
+		auto injector = injeqt::injector{make_modules<user_module>(), manifest};
+	});
+	expect<injeqt::exception::unresolvable_dependencies>({"service"}, [&]{
+		auto injector = injeqt::injector{make_modules<user_module>(), std::string{"injeqt-validation-manifest 3 0000000000000000"}};
+	});
+}
+
+QTEST_APPLESS_MAIN(validation_manifest_behavior_test)
+#include "validation-manifest-behavior-test.moc"
@@ -0,0 +1,161 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <injeqt/injector.h>
+#include <injeqt/module.h>
+
+#include <QtTest/QtTest>
+#include <vector>
+
+#define SERVICE_ROLE "service"
+
+static std::vector<std::string> created;
+
+class storage : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE storage() { created.push_back("storage"); }
+
+};
+
+class first_service : public QObject
+{
+	Q_OBJECT
+	INJEQT_TYPE_ROLE(SERVICE_ROLE)
+
+public:
+	Q_INVOKABLE first_service() { created.push_back("first_service"); }
+
+private slots:
+	INJEQT_SET void set_storage(storage *) {}
+
+};
+
+class second_service : public QObject
+{
+	Q_OBJECT
+	INJEQT_TYPE_ROLE(SERVICE_ROLE)
+
+public:
+	Q_INVOKABLE second_service() { created.push_back("second_service"); }
+
+private slots:
+	INJEQT_SET void set_first_service(first_service *) {}
+
+};
+
+class unrelated : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE unrelated() { created.push_back("unrelated"); }
+
+};
+
+class warmup_module : public injeqt::module
+{
+public:
+	warmup_module()
+	{
+		add_type<second_service>();
+		add_type<first_service>();
+		add_type<storage>();
+		add_type<unrelated>();
+	}
+	virtual ~warmup_module() {}
+};
+
+class warmup_behavior_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void init();
+	void should_not_instantiate_before_event_loop();
+	void should_instantiate_all_with_type_role_in_slices();
+	void should_skip_objects_requested_during_warmup();
+	void should_stop_when_injector_is_destroyed();
+
+private:
+	injeqt::injector make_injector();
+
+};
+
+void warmup_behavior_test::init()
+{
+	created.clear();
+}
+
+injeqt::injector warmup_behavior_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<injeqt::module>>{};
+	modules.emplace_back(std::unique_ptr<injeqt::module>{new warmup_module{}});
+	return injeqt::injector{std::move(modules)};
+}
+
+void warmup_behavior_test::should_not_instantiate_before_event_loop()
+{
+	auto injector = make_injector();
+	injector.start_warmup_with_type_role(SERVICE_ROLE);
+
+	QVERIFY(injector.is_warming_up());
+	QVERIFY(created.empty());
+}
+
+void warmup_behavior_test::should_instantiate_all_with_type_role_in_slices()
+{
+	auto injector = make_injector();
+	auto finished = 0;
+	injector.start_warmup_with_type_role(SERVICE_ROLE, std::chrono::milliseconds{0}, [&]{ finished++; });
+
+	QTRY_VERIFY(!injector.is_warming_up());
+	QCOMPARE(finished, 1);
+	QCOMPARE(created, (std::vector<std::string>{"storage", "first_service", "second_service"}));
+}
+
+void warmup_behavior_test::should_skip_objects_requested_during_warmup()
+{
+	auto injector = make_injector();
+	injector.start_warmup_with_type_role(SERVICE_ROLE, std::chrono::milliseconds{0});
+	injector.get<second_service>();
+
+	QVERIFY(created.size() == 3);
+	QTRY_VERIFY(!injector.is_warming_up());
+	QVERIFY(created.size() == 3);
+}
+
+void warmup_behavior_test::should_stop_when_injector_is_destroyed()
+{
+	auto finished = 0;
+	{
+		auto injector = make_injector();
+		injector.start_warmup_with_type_role(SERVICE_ROLE, std::chrono::milliseconds{0}, [&]{ finished++; });
+	}
+
+	QTest::qWait(20);
+	QCOMPARE(finished, 0);
+	QVERIFY(created.empty());
+}
+
+QTEST_GUILESS_MAIN(warmup_behavior_test)
+#include "warmup-behavior-test.moc"
@@ -35,6 +35,6 @@ public:
 	virtual ~mocked_provider_configuration() {}
 
     virtual std::vector<type> types() const override { return {}; }
-	virtual std::unique_ptr<provider> create_provider(const types_by_name &) const override { return nullptr; }
+	virtual std::unique_ptr<provider> create_provider(const types_by_name &, const wiring_tables &) const override { return nullptr; }
 
 };
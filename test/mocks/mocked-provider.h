@@ -53,6 +53,14 @@ public:
 
 	virtual bool require_resolving() const override { return true; }
 
+	virtual bool is_scoped() const override { return false; }
+
+	virtual bool is_prototype() const override { return false; }
+
+	virtual bool is_default_constructed() const override { return false; }
+
+	virtual bool is_ready() const override { return false; }
+
 	QObject * object() const { return _object; }
 
 private:
@@ -51,6 +51,7 @@ public:
 public slots:
 	INJEQT_INIT void tagged_init_action_slot() { v = 1; }
 	INJEQT_DONE void tagged_done_action_slot() { }
+	INJEQT_RESET void tagged_reset_action_slot() { }
 	INJEQT_INIT void invalid_init_action_arguments(int) { }
 	INJEQT_DONE void invalid_done_action_arguments(int) { }
 	INVALID_ACTION_TAG void invalid_action_invalid_tag() { }
@@ -106,6 +107,10 @@ void action_method_test::should_create_valid_from_tagged_action_slot()
 	make_action_method(get_method<test_type>("tagged_done_action_slot()"));
 	QVERIFY(!action.is_empty());
 	QCOMPARE(action.object_type(), make_type<test_type>());
+
+	make_action_method(get_method<test_type>("tagged_reset_action_slot()"));
+	QVERIFY(!action.is_empty());
+	QCOMPARE(action.object_type(), make_type<test_type>());
 }
 
 void action_method_test::should_invoke_have_results()
@@ -0,0 +1,210 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include <injeqt/exception/default-constructor-not-found.h>
+#include <injeqt/exception/invalid-setter.h>
+#include <injeqt/module.h>
+
+#include "internal/analysis-threads.h"
+#include "internal/injector-impl.h"
+#include "internal/types-model.h"
+
+#include <QtTest/QtTest>
+
+using namespace injeqt::internal;
+using namespace injeqt::v1;
+
+class base_service : public QObject
+{
+	Q_OBJECT
+
+};
+
+class service_1 : public base_service
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_1() {}
+
+};
+
+class service_2 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_2() {}
+
+private slots:
+	INJEQT_SET void set_base_service(base_service *) {}
+
+};
+
+class service_3 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_3() {}
+
+private slots:
+	INJEQT_SET void set_service_1(service_1 *) {}
+	INJEQT_SET void set_service_2(service_2 *) {}
+
+};
+
+class service_4 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE service_4() {}
+
+private slots:
+	INJEQT_SET void set_service_3(service_3 *) {}
+
+};
+
+class broken_setter_service : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE broken_setter_service() {}
+
+private slots:
+	INJEQT_SET void set_services(service_1 *, service_2 *) {}
+
+};
+
+class no_constructor_service : public QObject
+{
+	Q_OBJECT
+
+};
+
+class services_module : public module
+{
+public:
+	services_module()
+	{
+		add_type<service_1>();
+		add_type<service_2>();
+		add_type<service_3>();
+		add_type<service_4>();
+	}
+	virtual ~services_module() {}
+};
+
+template<typename T>
+class broken_module : public module
+{
+public:
+	broken_module()
+	{
+		add_type<T>();
+	}
+	virtual ~broken_module() {}
+};
+
+class analysis_threads_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void cleanup();
+
+	void should_create_the_same_injector_with_many_analysis_threads();
+	void should_rethrow_invalid_setter_from_analysis_thread();
+	void should_rethrow_provider_error_from_analysis_thread();
+
+private:
+	std::unique_ptr<injector_impl> make_injector();
+
+	template<typename T>
+	std::unique_ptr<injector_impl> make_broken_injector();
+
+};
+
+std::unique_ptr<injector_impl> analysis_threads_test::make_injector()
+{
+	auto modules = std::vector<std::unique_ptr<module>>{};
+	modules.emplace_back(std::unique_ptr<module>{new services_module{}});
+	return std::unique_ptr<injector_impl>{new injector_impl{std::move(modules)}};
+}
+
+template<typename T>
+std::unique_ptr<injector_impl> analysis_threads_test::make_broken_injector()
+{
+	// broken type is configured after many valid ones, so it is usually analyzed by one of worker threads
+	auto modules = std::vector<std::unique_ptr<module>>{};
+	modules.emplace_back(std::unique_ptr<module>{new services_module{}});
+	modules.emplace_back(std::unique_ptr<module>{new broken_module<T>{}});
+	return std::unique_ptr<injector_impl>{new injector_impl{std::move(modules)}};
+}
+
+void analysis_threads_test::cleanup()
+{
+	set_analysis_thread_count(1);
+}
+
+void analysis_threads_test::should_create_the_same_injector_with_many_analysis_threads()
+{
+	auto serial = make_injector();
+
+	set_analysis_thread_count(4);
+	QCOMPARE(analysis_thread_count(), 4u);
+	auto parallel = make_injector();
+
+	QCOMPARE(parallel->core().model().available_types(), serial->core().model().available_types());
+	QCOMPARE(parallel->core().model().mapped_dependencies(), serial->core().model().mapped_dependencies());
+	QCOMPARE(parallel->core().model().ambiguous_types(), serial->core().model().ambiguous_types());
+	QCOMPARE(parallel->provided_types(), serial->provided_types());
+
+	QVERIFY(parallel->get(make_type<service_4>()) != nullptr);
+	QCOMPARE(parallel->get(make_type<base_service>()), parallel->get(make_type<service_1>()));
+}
+
+void analysis_threads_test::should_rethrow_invalid_setter_from_analysis_thread()
+{
+	set_analysis_thread_count(4);
+
+	expect<exception::invalid_setter>({"set_services"}, [&]{
+		make_broken_injector<broken_setter_service>();
+	});
+
+	// threads are joined before exception is thrown, so next injector can be created normally
+	QVERIFY(make_injector()->get(make_type<service_4>()) != nullptr);
+}
+
+void analysis_threads_test::should_rethrow_provider_error_from_analysis_thread()
+{
+	set_analysis_thread_count(4);
+
+	expect<exception::default_constructor_not_found>({"no_constructor_service"}, [&]{
+		make_broken_injector<no_constructor_service>();
+	});
+}
+
+QTEST_APPLESS_MAIN(analysis_threads_test)
+#include "analysis-threads-test.moc"
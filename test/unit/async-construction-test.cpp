@@ -0,0 +1,111 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/async-construction.h"
+
+#include <QtTest/QtTest>
+#include <memory>
+
+using namespace injeqt::v1;
+using namespace injeqt::internal;
+
+class type_1 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE type_1() {}
+
+};
+
+class type_2 : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE type_2() {}
+
+};
+
+class async_construction_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_construct_objects_on_current_thread_event_loop();
+	void should_finish_with_no_constructors();
+	void should_cancel_when_destroyed();
+
+};
+
+void async_construction_test::should_construct_objects_on_current_thread_event_loop()
+{
+	auto constructed = std::vector<std::unique_ptr<QObject>>{};
+	auto calls = 0;
+	async_construction c{{
+		make_default_constructor_method(make_type<type_1>()),
+		make_default_constructor_method(make_type<type_2>())
+	}, [&](std::vector<std::unique_ptr<QObject>> objects){
+		calls++;
+		constructed = std::move(objects);
+	}, []{ QFAIL("canceled"); }};
+
+	QVERIFY(!c.is_finished());
+	QTRY_VERIFY(c.is_finished());
+	QCOMPARE(calls, 1);
+	QVERIFY(constructed.size() == 2);
+	QCOMPARE(constructed[0]->metaObject(), &type_1::staticMetaObject);
+	QCOMPARE(constructed[1]->metaObject(), &type_2::staticMetaObject);
+	QCOMPARE(constructed[0]->thread(), QThread::currentThread());
+	QCOMPARE(constructed[1]->thread(), QThread::currentThread());
+}
+
+void async_construction_test::should_finish_with_no_constructors()
+{
+	auto calls = 0;
+	async_construction c{{}, [&](std::vector<std::unique_ptr<QObject>> objects){
+		calls++;
+		QVERIFY(objects.empty());
+	}, []{ QFAIL("canceled"); }};
+
+	QCOMPARE(calls, 0);
+	QTRY_VERIFY(c.is_finished());
+	QCOMPARE(calls, 1);
+}
+
+void async_construction_test::should_cancel_when_destroyed()
+{
+	auto constructed_calls = 0;
+	auto canceled_calls = 0;
+	{
+		async_construction c{{make_default_constructor_method(make_type<type_1>())},
+			[&](std::vector<std::unique_ptr<QObject>>){ constructed_calls++; },
+			[&]{ canceled_calls++; }};
+	}
+
+	QTest::qWait(50);
+	QCOMPARE(constructed_calls, 0);
+	QCOMPARE(canceled_calls, 1);
+}
+
+QTEST_GUILESS_MAIN(async_construction_test)
+#include "async-construction-test.moc"
@@ -0,0 +1,166 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+#include "utils.h"
+
+#include <injeqt/exception/unavailable-required-types.h>
+
+#include "internal/constructor-method.h"
+
+#include <QtTest/QtTest>
+
+using namespace injeqt::internal;
+using namespace injeqt::v1;
+
+class service : public QObject
+{
+	Q_OBJECT
+};
+
+class other_service : public QObject
+{
+	Q_OBJECT
+};
+
+class unknown_service : public QObject
+{
+	Q_OBJECT
+};
+
+class with_injection_constructor : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE with_injection_constructor(int a) : _service{nullptr}, _other_service{nullptr} { (void)a; }
+	Q_INVOKABLE with_injection_constructor(service *s, other_service *o) : _service{s}, _other_service{o} {}
+
+	service * used_service() const { return _service; }
+	other_service * used_other_service() const { return _other_service; }
+
+private:
+	service *_service;
+	other_service *_other_service;
+
+};
+
+class with_parent_constructor : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE with_parent_constructor(QObject *parent) : QObject{parent} {}
+
+};
+
+class with_unknown_parameter : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE with_unknown_parameter(unknown_service *) {}
+
+};
+
+class constructor_method_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void init();
+	void should_return_empty_when_default_constructed();
+	void should_return_empty_when_there_is_no_injection_constructor();
+	void should_return_empty_for_constructor_with_qobject_parameter();
+	void should_throw_when_parameter_type_is_not_known();
+	void should_create_valid_with_injection_constructor();
+	void should_create_object_with_arguments();
+	void should_properly_compare();
+
+private:
+	types_by_name known_types;
+
+};
+
+void constructor_method_test::init()
+{
+	known_types = types_by_name{std::vector<type>{
+		make_type<service>(),
+		make_type<other_service>()
+	}};
+}
+
+void constructor_method_test::should_return_empty_when_default_constructed()
+{
+	auto c = constructor_method{};
+	QVERIFY(c.is_empty());
+}
+
+void constructor_method_test::should_return_empty_when_there_is_no_injection_constructor()
+{
+	auto c = make_constructor_method(known_types, make_type<service>());
+	QVERIFY(c.is_empty());
+}
+
+void constructor_method_test::should_return_empty_for_constructor_with_qobject_parameter()
+{
+	auto c = make_constructor_method(known_types, make_type<with_parent_constructor>());
+	QVERIFY(c.is_empty());
+}
+
+void constructor_method_test::should_throw_when_parameter_type_is_not_known()
+{
+	expect<injeqt::exception::unavailable_required_types>({"unknown_service"}, [&]{
+		make_constructor_method(known_types, make_type<with_unknown_parameter>());
+	});
+}
+
+void constructor_method_test::should_create_valid_with_injection_constructor()
+{
+	auto c = make_constructor_method(known_types, make_type<with_injection_constructor>());
+	QVERIFY(!c.is_empty());
+	QCOMPARE(c.object_type(), make_type<with_injection_constructor>());
+	QCOMPARE(c.parameter_types(), (std::vector<type>{make_type<service>(), make_type<other_service>()}));
+}
+
+void constructor_method_test::should_create_object_with_arguments()
+{
+	auto c = make_constructor_method(known_types, make_type<with_injection_constructor>());
+	service s;
+	other_service o;
+
+	auto object = c.invoke(std::vector<QObject *>{&s, &o});
+	auto cast = qobject_cast<with_injection_constructor *>(object.get());
+	QVERIFY(cast != nullptr);
+	QCOMPARE(cast->used_service(), &s);
+	QCOMPARE(cast->used_other_service(), &o);
+}
+
+void constructor_method_test::should_properly_compare()
+{
+	auto c_empty = constructor_method{};
+	auto c1a = make_constructor_method(known_types, make_type<with_injection_constructor>());
+	auto c1b = make_constructor_method(known_types, make_type<with_injection_constructor>());
+
+	test_compare<constructor_method>({{c_empty}, {c1a, c1b}});
+}
+
+QTEST_APPLESS_MAIN(constructor_method_test)
+#include "constructor-method-test.moc"
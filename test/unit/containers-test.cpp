@@ -0,0 +1,80 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/containers.h"
+
+#include <QtTest/QtTest>
+#include <stdexcept>
+
+using namespace injeqt::internal;
+
+class containers_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_transform_in_order();
+	void should_transform_in_order_on_many_threads();
+	void should_rethrow_first_exception_from_many_threads();
+
+};
+
+void containers_test::should_transform_in_order()
+{
+	auto source = std::vector<int>{1, 2, 3};
+	auto result = parallel_transform(source, std::function<int(const int &)>{[](const int &x){ return x * 2; }}, 1);
+
+	QCOMPARE(result, (std::vector<int>{2, 4, 6}));
+}
+
+void containers_test::should_transform_in_order_on_many_threads()
+{
+	auto source = std::vector<int>{};
+	auto expected = std::vector<std::string>{};
+	for (auto i = 0; i < 1000; i++)
+	{
+		source.push_back(i);
+		expected.push_back(std::to_string(i));
+	}
+
+	auto result = parallel_transform(source, std::function<std::string(const int &)>{[](const int &x){ return std::to_string(x); }}, 8);
+
+	QCOMPARE(result, expected);
+}
+
+void containers_test::should_rethrow_first_exception_from_many_threads()
+{
+	auto source = std::vector<int>{};
+	for (auto i = 0; i < 1000; i++)
+		source.push_back(i);
+
+	expect<std::runtime_error>({"10"}, [&]{
+		parallel_transform(source, std::function<int(const int &)>{[](const int &x){
+			if (x % 10 == 0 && x > 0)
+				throw std::runtime_error{std::to_string(x)};
+			return x;
+		}}, 8);
+	});
+}
+
+QTEST_APPLESS_MAIN(containers_test)
+#include "containers-test.moc"
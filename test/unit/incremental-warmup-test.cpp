@@ -0,0 +1,133 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/incremental-warmup.h"
+
+#include <injeqt/exception/instantiation-failed.h>
+
+#include <QtTest/QtTest>
+#include <chrono>
+#include <thread>
+
+using namespace injeqt::v1;
+using namespace injeqt::internal;
+
+class type_1 : public QObject
+{
+	Q_OBJECT
+};
+
+class type_2 : public QObject
+{
+	Q_OBJECT
+};
+
+class type_3 : public QObject
+{
+	Q_OBJECT
+};
+
+class incremental_warmup_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_be_finished_with_empty_plan();
+	void should_process_one_step_per_slice_with_zero_budget();
+	void should_process_many_steps_per_slice();
+	void should_skip_failed_types();
+	void should_run_slices_from_event_loop();
+
+};
+
+void incremental_warmup_test::should_be_finished_with_empty_plan()
+{
+	auto finished = 0;
+	incremental_warmup w{{}, [](const type &){}, std::chrono::milliseconds{0}, [&]{ finished++; }};
+
+	QVERIFY(w.is_finished());
+	QVERIFY(w.remaining() == 0);
+	QVERIFY(w.run_slice());
+	QCOMPARE(finished, 0);
+}
+
+void incremental_warmup_test::should_process_one_step_per_slice_with_zero_budget()
+{
+	auto instantiated = std::vector<type>{};
+	auto finished = 0;
+	incremental_warmup w{{make_type<type_1>(), make_type<type_2>(), make_type<type_3>()},
+		[&](const type &t){ instantiated.push_back(t); }, std::chrono::milliseconds{0}, [&]{ finished++; }};
+
+	QVERIFY(w.remaining() == 3);
+	QVERIFY(!w.run_slice());
+	QVERIFY(w.remaining() == 2);
+	QVERIFY(!w.run_slice());
+	QVERIFY(w.remaining() == 1);
+	QCOMPARE(finished, 0);
+	QVERIFY(w.run_slice());
+	QVERIFY(w.is_finished());
+	QCOMPARE(finished, 1);
+	QCOMPARE(instantiated, (std::vector<type>{make_type<type_1>(), make_type<type_2>(), make_type<type_3>()}));
+}
+
+void incremental_warmup_test::should_process_many_steps_per_slice()
+{
+	auto instantiated = std::vector<type>{};
+	incremental_warmup w{{make_type<type_1>(), make_type<type_2>(), make_type<type_3>()},
+		[&](const type &t){ instantiated.push_back(t); }, std::chrono::milliseconds{1000}, {}};
+
+	QVERIFY(w.run_slice());
+	QVERIFY(instantiated.size() == 3);
+}
+
+void incremental_warmup_test::should_skip_failed_types()
+{
+	auto instantiated = std::vector<type>{};
+	incremental_warmup w{{make_type<type_1>(), make_type<type_2>(), make_type<type_3>()}, [&](const type &t){
+		if (t == make_type<type_2>())
+			throw injeqt::exception::instantiation_failed{t.name()};
+		instantiated.push_back(t);
+	}, std::chrono::milliseconds{1000}, {}};
+
+	QVERIFY(w.run_slice());
+	QCOMPARE(instantiated, (std::vector<type>{make_type<type_1>(), make_type<type_3>()}));
+	QCOMPARE(w.failed_types(), std::vector<type>{make_type<type_2>()});
+}
+
+void incremental_warmup_test::should_run_slices_from_event_loop()
+{
+	auto instantiated = std::vector<type>{};
+	auto finished = 0;
+	incremental_warmup w{{make_type<type_1>(), make_type<type_2>(), make_type<type_3>()}, [&](const type &t){
+		std::this_thread::sleep_for(std::chrono::milliseconds{2});
+		instantiated.push_back(t);
+	}, std::chrono::milliseconds{1}, [&]{ finished++; }};
+
+	w.start();
+	QVERIFY(instantiated.empty());
+	QTRY_VERIFY(w.is_finished());
+	QVERIFY(instantiated.size() == 3);
+	QCOMPARE(finished, 1);
+}
+
+QTEST_GUILESS_MAIN(incremental_warmup_test)
+#include "incremental-warmup-test.moc"
@@ -209,7 +209,7 @@ void injector_core_test::should_not_accept_doubled_type()
 	configuration.push_back(make_mocked_provider<type_1>());
 	configuration.push_back(make_mocked_provider<type_1>());
 
-	expect<exception::ambiguous_types>({}, [&](){
+	expect<exception::ambiguous_types>({"type_1"}, [&](){
 		auto i = injector_core{types_by_name{}, std::move(configuration)};
 	});
 }
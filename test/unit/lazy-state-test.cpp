@@ -0,0 +1,123 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/lazy-state.h"
+
+#include <QtTest/QtTest>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace injeqt::v1;
+using namespace injeqt::internal;
+
+class type_1 : public QObject
+{
+	Q_OBJECT
+};
+
+class lazy_state_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_not_resolve_on_creation();
+	void should_resolve_once();
+	void should_retry_after_exception();
+	void should_resolve_once_from_many_threads();
+
+};
+
+void lazy_state_test::should_not_resolve_on_creation()
+{
+	auto calls = 0;
+	type_1 o;
+	lazy_state s{make_type<type_1>(), std::make_shared<std::recursive_mutex>(), [&]() -> QObject * {
+		calls++;
+		return &o;
+	}};
+
+	QCOMPARE(s.object_type(), make_type<type_1>());
+	QVERIFY(!s.is_resolved());
+	QCOMPARE(calls, 0);
+}
+
+void lazy_state_test::should_resolve_once()
+{
+	auto calls = 0;
+	type_1 o;
+	lazy_state s{make_type<type_1>(), std::make_shared<std::recursive_mutex>(), [&]() -> QObject * {
+		calls++;
+		return &o;
+	}};
+
+	QCOMPARE(s.get(), &o);
+	QCOMPARE(s.get(), &o);
+	QVERIFY(s.is_resolved());
+	QCOMPARE(calls, 1);
+}
+
+void lazy_state_test::should_retry_after_exception()
+{
+	auto calls = 0;
+	type_1 o;
+	lazy_state s{make_type<type_1>(), std::make_shared<std::recursive_mutex>(), [&]() -> QObject * {
+		if (calls++ == 0)
+			throw std::runtime_error{"first call"};
+		return &o;
+	}};
+
+	expect<std::runtime_error>([&]{
+		s.get();
+	});
+	QVERIFY(!s.is_resolved());
+	QCOMPARE(s.get(), &o);
+	QCOMPARE(calls, 2);
+}
+
+void lazy_state_test::should_resolve_once_from_many_threads()
+{
+	std::atomic<int> calls{0};
+	type_1 o;
+	lazy_state s{make_type<type_1>(), std::make_shared<std::recursive_mutex>(), [&]() -> QObject * {
+		calls++;
+		std::this_thread::sleep_for(std::chrono::milliseconds{10});
+		return &o;
+	}};
+
+	auto results = std::vector<QObject *>(8, nullptr);
+	auto threads = std::vector<std::thread>{};
+	for (auto i = 0u; i < results.size(); i++)
+		threads.emplace_back([&, i]{ results[i] = s.get(); });
+	for (auto &&t : threads)
+		t.join();
+
+	QCOMPARE(calls.load(), 1);
+	for (auto &&r : results)
+		QCOMPARE(r, static_cast<QObject *>(&o));
+}
+
+QTEST_APPLESS_MAIN(lazy_state_test)
+#include "lazy-state-test.moc"
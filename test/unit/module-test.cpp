@@ -22,6 +22,8 @@
 #include "expect.h"
 #include "utils.h"
 
+#include <injeqt/exception/interface-not-implemented.h>
+#include <injeqt/exception/qobject-type.h>
 #include <injeqt/module.h>
 
 #include <QtTest/QtTest>
@@ -89,6 +91,9 @@ private slots:
 	void should_accept_supertype_factory_type();
 	void should_accept_subtype_factory_type();
 	void should_accept_double_factory_type();
+	void should_throw_when_adding_to_qobject_set();
+	void should_throw_when_adding_to_not_implemented_set();
+	void should_accept_set_member();
 
 };
 
@@ -300,5 +305,51 @@ void module_test::should_accept_double_factory_type()
 	test_module{};
 }
 
+void module_test::should_throw_when_adding_to_qobject_set()
+{
+	class test_module : public module
+	{
+	public:
+		test_module()
+		{
+			add_to_set<QObject, default_constructible_type>();
+		}
+	};
+
+	expect<injeqt::exception::qobject_type>([]{
+		test_module{};
+	});
+}
+
+void module_test::should_throw_when_adding_to_not_implemented_set()
+{
+	class test_module : public module
+	{
+	public:
+		test_module()
+		{
+			add_to_set<not_default_constructible_type, default_constructible_type>();
+		}
+	};
+
+	expect<injeqt::exception::interface_not_implemented>({"default_constructible_type", "not_default_constructible_type"}, []{
+		test_module{};
+	});
+}
+
+void module_test::should_accept_set_member()
+{
+	class test_module : public module
+	{
+	public:
+		test_module()
+		{
+			add_to_set<not_default_constructible_type, not_default_constructible_type_subtype>();
+		}
+	};
+
+	test_module{};
+}
+
 QTEST_APPLESS_MAIN(module_test)
 #include "module-test.moc"
@@ -0,0 +1,208 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/once-object.h"
+
+#include <injeqt/exception/instantiation-cycle.h>
+#include <injeqt/exception/instantiation-failed.h>
+
+#include <QtTest/QtTest>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace injeqt::v1;
+using namespace injeqt::internal;
+
+class type_1 : public QObject
+{
+	Q_OBJECT
+};
+
+class once_object_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_be_uninitialized_on_creation();
+	void should_construct_once();
+	void should_throw_when_constructed_null();
+	void should_retry_after_exception();
+	void should_throw_on_reentrant_request();
+	void should_construct_once_from_many_threads();
+	void should_pass_exception_to_waiting_threads();
+	void should_adopt_when_empty();
+	void should_not_adopt_when_ready();
+
+};
+
+void once_object_test::should_be_uninitialized_on_creation()
+{
+	once_object o{make_type<type_1>()};
+
+	QCOMPARE(o.object_type(), make_type<type_1>());
+	QVERIFY(o.current_state() == once_object::state::uninitialized);
+	QVERIFY(o.object() == nullptr);
+}
+
+void once_object_test::should_construct_once()
+{
+	auto calls = 0;
+	once_object o{make_type<type_1>()};
+	auto construct = [&]{
+		calls++;
+		return std::unique_ptr<QObject>{new type_1{}};
+	};
+
+	auto result = o.get(construct);
+	QVERIFY(result != nullptr);
+	QCOMPARE(o.get(construct), result);
+	QCOMPARE(o.object(), result);
+	QVERIFY(o.current_state() == once_object::state::ready);
+	QCOMPARE(calls, 1);
+}
+
+void once_object_test::should_throw_when_constructed_null()
+{
+	once_object o{make_type<type_1>()};
+
+	expect<exception::instantiation_failed>({"type_1"}, [&]{
+		o.get([]{ return std::unique_ptr<QObject>{}; });
+	});
+	QVERIFY(o.current_state() == once_object::state::failed);
+}
+
+void once_object_test::should_retry_after_exception()
+{
+	auto calls = 0;
+	once_object o{make_type<type_1>()};
+	auto construct = [&]{
+		if (calls++ == 0)
+			throw std::runtime_error{"first call"};
+		return std::unique_ptr<QObject>{new type_1{}};
+	};
+
+	expect<std::runtime_error>([&]{
+		o.get(construct);
+	});
+	QVERIFY(o.current_state() == once_object::state::failed);
+	QVERIFY(o.get(construct) != nullptr);
+	QVERIFY(o.current_state() == once_object::state::ready);
+	QCOMPARE(calls, 2);
+}
+
+void once_object_test::should_throw_on_reentrant_request()
+{
+	once_object o{make_type<type_1>()};
+	auto construct = std::function<std::unique_ptr<QObject>()>{};
+	construct = [&]{
+		o.get(construct);
+		return std::unique_ptr<QObject>{new type_1{}};
+	};
+
+	expect<exception::instantiation_cycle>({"type_1"}, [&]{
+		o.get(construct);
+	});
+	QVERIFY(o.current_state() == once_object::state::failed);
+}
+
+void once_object_test::should_construct_once_from_many_threads()
+{
+	std::atomic<int> calls{0};
+	once_object o{make_type<type_1>()};
+	auto construct = [&]{
+		calls++;
+		std::this_thread::sleep_for(std::chrono::milliseconds{10});
+		return std::unique_ptr<QObject>{new type_1{}};
+	};
+
+	auto results = std::vector<QObject *>(8, nullptr);
+	auto threads = std::vector<std::thread>{};
+	for (auto i = 0u; i < results.size(); i++)
+		threads.emplace_back([&, i]{ results[i] = o.get(construct); });
+	for (auto &&t : threads)
+		t.join();
+
+	QCOMPARE(calls.load(), 1);
+	for (auto &&r : results)
+		QCOMPARE(r, o.object());
+}
+
+void once_object_test::should_pass_exception_to_waiting_threads()
+{
+	std::atomic<int> calls{0};
+	std::atomic<int> failures{0};
+	once_object o{make_type<type_1>()};
+	auto construct = [&]() -> std::unique_ptr<QObject> {
+		calls++;
+		std::this_thread::sleep_for(std::chrono::milliseconds{50});
+		throw std::runtime_error{"construction"};
+	};
+	auto request = [&]{
+		try
+		{
+			o.get(construct);
+		}
+		catch (std::runtime_error &)
+		{
+			failures++;
+		}
+	};
+
+	auto constructing = std::thread{request};
+	while (o.current_state() != once_object::state::constructing)
+		std::this_thread::yield();
+	auto waiting = std::thread{request};
+	constructing.join();
+	waiting.join();
+
+	QCOMPARE(calls.load(), 1);
+	QCOMPARE(failures.load(), 2);
+}
+
+void once_object_test::should_adopt_when_empty()
+{
+	once_object o{make_type<type_1>()};
+	auto object = std::unique_ptr<QObject>{new type_1{}};
+	auto object_pointer = object.get();
+
+	QVERIFY(o.adopt(std::move(object)) == nullptr);
+	QCOMPARE(o.object(), object_pointer);
+	QCOMPARE(o.get([]{ return std::unique_ptr<QObject>{new type_1{}}; }), object_pointer);
+}
+
+void once_object_test::should_not_adopt_when_ready()
+{
+	once_object o{make_type<type_1>()};
+	auto constructed = o.get([]{ return std::unique_ptr<QObject>{new type_1{}}; });
+	auto object = std::unique_ptr<QObject>{new type_1{}};
+	auto object_pointer = object.get();
+
+	QCOMPARE(o.adopt(std::move(object)).get(), object_pointer);
+	QCOMPARE(o.object(), constructed);
+}
+
+QTEST_APPLESS_MAIN(once_object_test)
+#include "once-object-test.moc"
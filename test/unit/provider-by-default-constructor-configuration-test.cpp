@@ -25,6 +25,7 @@
 
 #include "internal/injector-core.h"
 #include "internal/provider-by-default-constructor-configuration.h"
+#include "internal/wiring-table.h"
 
 #include <QtTest/QtTest>
 #include <memory>
@@ -46,6 +47,15 @@ class not_default_constructor_type : public QObject
 	Q_OBJECT
 };
 
+class injection_constructor_type : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE injection_constructor_type(default_constructor_type *) {}
+
+};
+
 class provider_by_default_constructor_configuration_test : public QObject
 {
 	Q_OBJECT
@@ -54,6 +64,7 @@ private slots:
 	void should_accept_qobject_type_and_throw_on_create();
 	void should_accept_type_without_default_constructor_and_throw_on_create();
 	void should_accept_valid_configuration();
+	void should_create_provider_for_injection_constructor();
 
 };
 
@@ -62,7 +73,7 @@ void provider_by_default_constructor_configuration_test::should_accept_qobject_t
 	auto pc = provider_by_default_constructor_configuration{make_type<QObject>()};
 
 	expect<exception::qobject_type>([&](){
-		pc.create_provider({});
+		pc.create_provider({}, wiring_tables{pc.types()});
 	});
 }
 
@@ -71,7 +82,7 @@ void provider_by_default_constructor_configuration_test::should_accept_type_with
 	auto pc = provider_by_default_constructor_configuration{make_type<not_default_constructor_type>()};
 
 	expect<exception::default_constructor_not_found>([&](){
-		pc.create_provider({});
+		pc.create_provider({}, wiring_tables{pc.types()});
 	});
 }
 
@@ -79,10 +90,22 @@ void provider_by_default_constructor_configuration_test::should_accept_valid_con
 {
 	auto i = injector_core{};
 	auto pc = provider_by_default_constructor_configuration{make_type<default_constructor_type>()};
-	auto p = pc.create_provider({});
+	auto p = pc.create_provider({}, wiring_tables{pc.types()});
 
 	QVERIFY(nullptr != p->provide(i));
 }
 
+void provider_by_default_constructor_configuration_test::should_create_provider_for_injection_constructor()
+{
+	auto known_types = types_by_name{std::vector<type>{make_type<default_constructor_type>()}};
+	auto pc = provider_by_default_constructor_configuration{make_type<injection_constructor_type>()};
+	auto p = pc.create_provider(known_types, wiring_tables{pc.types()});
+
+	QCOMPARE(p->provided_type(), make_type<injection_constructor_type>());
+	QVERIFY(p->required_types().contains(make_type<default_constructor_type>()));
+	QVERIFY(!p->is_default_constructed());
+	QVERIFY(p->require_resolving());
+}
+
 QTEST_APPLESS_MAIN(provider_by_default_constructor_configuration_test)
 #include "provider-by-default-constructor-configuration-test.moc"
@@ -44,6 +44,8 @@ class provider_by_default_constructor_test : public QObject
 
 private slots:
 	void should_return_always_the_same_object();
+	void should_return_adopted_object();
+	void should_not_adopt_when_object_exists();
 
 };
 
@@ -64,5 +66,29 @@ void provider_by_default_constructor_test::should_return_always_the_same_object(
 	QCOMPARE(o->metaObject(), &default_constructor_type::staticMetaObject);
 }
 
+void provider_by_default_constructor_test::should_return_adopted_object()
+{
+	auto empty_injector = injector_core{};
+	auto c = make_default_constructor_method(make_type<default_constructor_type>());
+	auto p = std::unique_ptr<provider_by_default_constructor>{new provider_by_default_constructor{c}};
+	auto o = new default_constructor_type{};
+
+	QVERIFY(p->adopt(std::unique_ptr<QObject>{o}) == nullptr);
+	QCOMPARE(p->provide(empty_injector), static_cast<QObject *>(o));
+}
+
+void provider_by_default_constructor_test::should_not_adopt_when_object_exists()
+{
+	auto empty_injector = injector_core{};
+	auto c = make_default_constructor_method(make_type<default_constructor_type>());
+	auto p = std::unique_ptr<provider_by_default_constructor>{new provider_by_default_constructor{c}};
+	auto provided = p->provide(empty_injector);
+	auto o = new default_constructor_type{};
+
+	auto not_adopted = p->adopt(std::unique_ptr<QObject>{o});
+	QCOMPARE(not_adopted.get(), static_cast<QObject *>(o));
+	QCOMPARE(p->provide(empty_injector), provided);
+}
+
 QTEST_APPLESS_MAIN(provider_by_default_constructor_test)
 #include "provider-by-default-constructor-test.moc"
@@ -26,6 +26,7 @@
 #include "internal/provider-by-factory-configuration.h"
 #include "internal/provider.h"
 #include "internal/types.h"
+#include "internal/wiring-table.h"
 
 #include <QtTest/QtTest>
 #include <memory>
@@ -108,7 +109,7 @@ void provider_by_factory_configuration_test::should_accept_qobject_object_type_a
 	auto pc = provider_by_factory_configuration{make_type<QObject>(), make_type<factory_type>()};
 
 	expect<exception::qobject_type>([&](){
-		pc.create_provider(known_types);
+		pc.create_provider(known_types, wiring_tables{pc.types()});
 	});
 }
 
@@ -117,7 +118,7 @@ void provider_by_factory_configuration_test::should_accept_qobject_factory_type_
 	auto pc = provider_by_factory_configuration{make_type<type_1>(), make_type<QObject>()};
 
 	expect<exception::qobject_type>([&](){
-		pc.create_provider(known_types);
+		pc.create_provider(known_types, wiring_tables{pc.types()});
 	});
 }
 
@@ -126,7 +127,7 @@ void provider_by_factory_configuration_test::should_accept_factory_without_facto
 	auto pc = provider_by_factory_configuration{make_type<type_2>(), make_type<factory_type>()};
 
 	expect<exception::unique_factory_method_not_found>([&](){
-		pc.create_provider(known_types);
+		pc.create_provider(known_types, wiring_tables{pc.types()});
 	});
 }
 
@@ -135,7 +136,7 @@ void provider_by_factory_configuration_test::should_accept_factory_without_uniqu
 	auto pc = provider_by_factory_configuration{make_type<type_2>(), make_type<non_unique_factory_type>()};
 
 	expect<exception::unique_factory_method_not_found>([&](){
-		pc.create_provider(known_types);
+		pc.create_provider(known_types, wiring_tables{pc.types()});
 	});
 }
 
@@ -144,14 +145,14 @@ void provider_by_factory_configuration_test::should_accept_supertype_factory_and
 	auto pc = provider_by_factory_configuration{make_type<type_1_subtype_1>(), make_type<factory_type>()};
 
 	expect<exception::unique_factory_method_not_found>([&](){
-		pc.create_provider(known_types);
+		pc.create_provider(known_types, wiring_tables{pc.types()});
 	});
 }
 
 void provider_by_factory_configuration_test::should_accept_valid_configuration()
 {
 	auto pc = provider_by_factory_configuration{make_type<type_1>(), make_type<factory_type>()};
-	auto p = pc.create_provider(known_types);
+	auto p = pc.create_provider(known_types, wiring_tables{pc.types()});
 
 	QCOMPARE(types{make_type<factory_type>()}, p->required_types());
 	QCOMPARE(make_type<type_1>(), p->provided_type());
@@ -160,7 +161,7 @@ void provider_by_factory_configuration_test::should_accept_valid_configuration()
 void provider_by_factory_configuration_test::should_accept_subtype_configuration()
 {
 	auto pc = provider_by_factory_configuration{make_type<type_1>(), make_type<subtype_factory_type>()};
-	auto p = pc.create_provider(known_types);
+	auto p = pc.create_provider(known_types, wiring_tables{pc.types()});
 
 	QCOMPARE(types{make_type<subtype_factory_type>()}, p->required_types());
 	QCOMPARE(make_type<type_1_subtype_1>(), p->provided_type());
@@ -0,0 +1,109 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/injector-core.h"
+#include "internal/provider-prototype.h"
+
+#include <QtTest/QtTest>
+#include <memory>
+
+using namespace injeqt::v1;
+using namespace injeqt::internal;
+
+class default_constructor_type : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE default_constructor_type() {}
+
+};
+
+class provider_prototype_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_return_new_object_each_time();
+	void should_keep_objects_in_bounded_pool();
+	void should_not_allocate_pool_up_front();
+
+};
+
+void provider_prototype_test::should_return_new_object_each_time()
+{
+	auto empty_injector = injector_core{};
+	auto c = make_default_constructor_method(make_type<default_constructor_type>());
+	auto p = std::unique_ptr<provider_prototype>{new provider_prototype{c, 0}};
+
+	QCOMPARE(p->provided_type(), make_type<default_constructor_type>());
+	QCOMPARE(p->required_types(), types{});
+	QCOMPARE(p->constructor(), c);
+	QVERIFY(p->require_resolving());
+	QVERIFY(!p->is_scoped());
+	QVERIFY(p->is_prototype());
+
+	auto o1 = std::unique_ptr<QObject>{p->provide(empty_injector)};
+	auto o2 = std::unique_ptr<QObject>{p->provide(empty_injector)};
+	QVERIFY(o1.get() != o2.get());
+	QCOMPARE(o1->metaObject(), &default_constructor_type::staticMetaObject);
+	QCOMPARE(o2->metaObject(), &default_constructor_type::staticMetaObject);
+}
+
+void provider_prototype_test::should_keep_objects_in_bounded_pool()
+{
+	auto empty_injector = injector_core{};
+	auto c = make_default_constructor_method(make_type<default_constructor_type>());
+	auto p = std::unique_ptr<provider_prototype>{new provider_prototype{c, 1}};
+	QVERIFY(p->pool_capacity() == 1);
+	QVERIFY(!p->take_from_pool());
+
+	auto o1 = p->provide(empty_injector);
+	auto o2 = p->provide(empty_injector);
+	QVERIFY(!p->put_to_pool(std::unique_ptr<QObject>{o1}));
+	QVERIFY(p->pool().size() == 1);
+
+	auto not_pooled = p->put_to_pool(std::unique_ptr<QObject>{o2});
+	QCOMPARE(not_pooled.get(), o2);
+	QVERIFY(p->pool().size() == 1);
+
+	auto pooled = p->take_from_pool();
+	QCOMPARE(pooled.get(), o1);
+	QVERIFY(p->pool().empty());
+}
+
+void provider_prototype_test::should_not_allocate_pool_up_front()
+{
+	auto empty_injector = injector_core{};
+	auto c = make_default_constructor_method(make_type<default_constructor_type>());
+	auto p = std::unique_ptr<provider_prototype>{new provider_prototype{c, 100000}};
+
+	QVERIFY(p->pool_capacity() == 100000);
+	QVERIFY(p->pool().capacity() == 0);
+
+	QVERIFY(!p->put_to_pool(std::unique_ptr<QObject>{p->provide(empty_injector)}));
+	QVERIFY(p->pool().size() == 1);
+	QVERIFY(p->pool().capacity() < 100000);
+}
+
+QTEST_APPLESS_MAIN(provider_prototype_test)
+#include "provider-prototype-test.moc"
@@ -27,6 +27,7 @@
 
 #include "internal/injector-core.h"
 #include "internal/provider-ready-configuration.h"
+#include "internal/wiring-table.h"
 
 #include <QtTest/QtTest>
 #include <memory>
@@ -61,7 +62,7 @@ void provider_ready_configuration_test::should_accept_qobject_type_and_throw_on_
 	auto pc = provider_ready_configuration{make_type<QObject>(), nullptr};
 
 	expect<exception::qobject_type>([&](){
-		pc.create_provider({});
+		pc.create_provider({}, wiring_tables{});
 	});
 }
 
@@ -70,7 +71,7 @@ void provider_ready_configuration_test::should_accept_nullptr_object_and_throw_o
 	auto pc = provider_ready_configuration{make_type<type_1>(), nullptr};
 
 	expect<exception::invalid_qobject>([&](){
-		pc.create_provider({});
+		pc.create_provider({}, wiring_tables{});
 	});
 }
 
@@ -80,7 +81,7 @@ void provider_ready_configuration_test::should_accept_not_implemented_interface_
 	auto pc = provider_ready_configuration{make_type<type_1>(), o.get()};
 
 	expect<exception::interface_not_implemented>([&](){
-		pc.create_provider({});
+		pc.create_provider({}, wiring_tables{});
 	});
 }
 
@@ -89,7 +90,7 @@ void provider_ready_configuration_test::should_accept_valid_configuration()
 	auto i = injector_core{};
 	auto o = make_object<type_1>();
 	auto pc = provider_ready_configuration{make_type<type_1>(), o.get()};
-	auto p = pc.create_provider({});
+	auto p = pc.create_provider({}, wiring_tables{});
 
 	QCOMPARE(o.get(), p->provide(i));
 }
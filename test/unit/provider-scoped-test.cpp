@@ -0,0 +1,71 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/injector-core.h"
+#include "internal/provider-scoped.h"
+
+#include <QtTest/QtTest>
+#include <memory>
+
+using namespace injeqt::v1;
+using namespace injeqt::internal;
+
+class default_constructor_type : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE default_constructor_type() {}
+
+};
+
+class provider_scoped_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_return_new_object_each_time();
+
+};
+
+void provider_scoped_test::should_return_new_object_each_time()
+{
+	auto empty_injector = injector_core{};
+	auto c = make_default_constructor_method(make_type<default_constructor_type>());
+	auto p = std::unique_ptr<provider_scoped>{new provider_scoped{c}};
+
+	QCOMPARE(p->provided_type(), make_type<default_constructor_type>());
+	QCOMPARE(p->required_types(), types{});
+	QCOMPARE(p->constructor(), c);
+	QVERIFY(p->require_resolving());
+	QVERIFY(p->is_scoped());
+	QVERIFY(!p->is_prototype());
+
+	auto o1 = std::unique_ptr<QObject>{p->provide(empty_injector)};
+	auto o2 = std::unique_ptr<QObject>{p->provide(empty_injector)};
+	QVERIFY(o1.get() != o2.get());
+	QCOMPARE(o1->metaObject(), &default_constructor_type::staticMetaObject);
+	QCOMPARE(o2->metaObject(), &default_constructor_type::staticMetaObject);
+}
+
+QTEST_APPLESS_MAIN(provider_scoped_test)
+#include "provider-scoped-test.moc"
@@ -0,0 +1,142 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+#include "utils.h"
+
+#include "internal/reverse-dependencies.h"
+
+#include <QtTest/QtTest>
+
+using namespace injeqt::internal;
+using namespace injeqt::v1;
+
+class type_1 : public QObject
+{
+	Q_OBJECT
+};
+
+class injected_type : public QObject
+{
+	Q_OBJECT
+
+public slots:
+	INJEQT_SET void setter_1(type_1 *) {}
+
+};
+
+class reverse_dependencies_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_not_record_not_tracked_objects();
+	void should_return_recorded_dependents_on_rebind();
+	void should_move_tracking_on_rebind();
+	void should_skip_destroyed_dependents();
+	void should_forget_untracked_objects();
+
+};
+
+void reverse_dependencies_test::should_not_record_not_tracked_objects()
+{
+	auto object_1 = make_object<type_1>();
+	auto dependent = make_object<injected_type>();
+	auto index = reverse_dependencies{};
+
+	index.add(object_1.get(), dependent.get(), make_test_setter_method<injected_type, type_1>("setter_1(type_1*)"));
+
+	QVERIFY(!index.is_tracked(object_1.get()));
+}
+
+void reverse_dependencies_test::should_return_recorded_dependents_on_rebind()
+{
+	auto object_1 = make_object<type_1>();
+	auto object_2 = make_object<type_1>();
+	auto dependent_1 = make_object<injected_type>();
+	auto dependent_2 = make_object<injected_type>();
+	auto setter = make_test_setter_method<injected_type, type_1>("setter_1(type_1*)");
+	auto index = reverse_dependencies{};
+
+	index.track(object_1.get());
+	index.add(object_1.get(), dependent_1.get(), setter);
+	index.add(object_1.get(), dependent_2.get(), setter);
+	auto dependents = index.rebind(object_1.get(), object_2.get());
+
+	QVERIFY(dependents.size() == 2);
+	QCOMPARE(dependents[0].object.data(), dependent_1.get());
+	QCOMPARE(dependents[1].object.data(), dependent_2.get());
+	QVERIFY(dependents[0].setter == setter);
+}
+
+void reverse_dependencies_test::should_move_tracking_on_rebind()
+{
+	auto object_1 = make_object<type_1>();
+	auto object_2 = make_object<type_1>();
+	auto object_3 = make_object<type_1>();
+	auto dependent = make_object<injected_type>();
+	auto index = reverse_dependencies{};
+
+	index.track(object_1.get());
+	index.add(object_1.get(), dependent.get(), make_test_setter_method<injected_type, type_1>("setter_1(type_1*)"));
+	index.rebind(object_1.get(), object_2.get());
+
+	QVERIFY(!index.is_tracked(object_1.get()));
+	QVERIFY(index.is_tracked(object_2.get()));
+	QVERIFY(index.rebind(object_2.get(), object_3.get()).size() == 1);
+}
+
+void reverse_dependencies_test::should_skip_destroyed_dependents()
+{
+	auto object_1 = make_object<type_1>();
+	auto object_2 = make_object<type_1>();
+	auto dependent_1 = make_object<injected_type>();
+	auto dependent_2 = make_object<injected_type>();
+	auto setter = make_test_setter_method<injected_type, type_1>("setter_1(type_1*)");
+	auto index = reverse_dependencies{};
+
+	index.track(object_1.get());
+	index.add(object_1.get(), dependent_1.get(), setter);
+	index.add(object_1.get(), dependent_2.get(), setter);
+	dependent_1.reset();
+	auto dependents = index.rebind(object_1.get(), object_2.get());
+
+	QVERIFY(dependents.size() == 1);
+	QCOMPARE(dependents[0].object.data(), dependent_2.get());
+}
+
+void reverse_dependencies_test::should_forget_untracked_objects()
+{
+	auto object_1 = make_object<type_1>();
+	auto dependent = make_object<injected_type>();
+	auto setter = make_test_setter_method<injected_type, type_1>("setter_1(type_1*)");
+	auto index = reverse_dependencies{};
+
+	index.track(object_1.get());
+	index.add(object_1.get(), dependent.get(), setter);
+	index.untrack(object_1.get());
+
+	QVERIFY(!index.is_tracked(object_1.get()));
+	index.track(object_1.get());
+	QVERIFY(index.rebind(object_1.get(), dependent.get()).empty());
+}
+
+QTEST_APPLESS_MAIN(reverse_dependencies_test)
+#include "reverse-dependencies-test.moc"
@@ -0,0 +1,140 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/scope.h"
+
+#include <QtTest/QtTest>
+#include <memory>
+
+using namespace injeqt::v1;
+using namespace injeqt::internal;
+
+class type_1 : public QObject
+{
+	Q_OBJECT
+};
+
+class type_1_subtype_1 : public type_1
+{
+	Q_OBJECT
+};
+
+class type_2 : public QObject
+{
+	Q_OBJECT
+};
+
+class scope_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_be_empty_after_creation();
+	void should_return_added_object_under_all_types();
+	void should_keep_resolved_objects_in_order();
+	void should_destroy_all_objects_with_scope();
+	void should_remove_only_given_object();
+
+};
+
+void scope_test::should_be_empty_after_creation()
+{
+	auto s = scope{};
+
+	QVERIFY(s.size() == 0);
+	QVERIFY(s.get(make_type<type_1>()) == nullptr);
+	QVERIFY(s.resolved_objects().empty());
+}
+
+void scope_test::should_return_added_object_under_all_types()
+{
+	auto s = scope{};
+	auto o = new type_1_subtype_1{};
+	s.add(std::unique_ptr<QObject>{o}, {
+		implementation{make_type<type_1>(), o},
+		implementation{make_type<type_1_subtype_1>(), o}
+	});
+
+	QVERIFY(s.size() == 1);
+	QCOMPARE(s.get(make_type<type_1>()), o);
+	QCOMPARE(s.get(make_type<type_1_subtype_1>()), o);
+	QVERIFY(s.get(make_type<type_2>()) == nullptr);
+	QVERIFY(s.resolved_objects().empty());
+}
+
+void scope_test::should_keep_resolved_objects_in_order()
+{
+	auto s = scope{};
+	auto o1 = new type_1{};
+	auto o2 = new type_2{};
+	s.add(std::unique_ptr<QObject>{o1}, {implementation{make_type<type_1>(), o1}});
+	s.add(std::unique_ptr<QObject>{o2}, {implementation{make_type<type_2>(), o2}});
+	s.mark_resolved(o2);
+	s.mark_resolved(o1);
+
+	QCOMPARE(s.resolved_objects(), (std::vector<QObject *>{o2, o1}));
+}
+
+void scope_test::should_destroy_all_objects_with_scope()
+{
+	auto o1 = QPointer<QObject>{};
+	auto o2 = QPointer<QObject>{};
+
+	{
+		auto s = scope{};
+		o1 = new type_1{};
+		o2 = new type_2{};
+		s.add(std::unique_ptr<QObject>{o1.data()}, {implementation{make_type<type_1>(), o1.data()}});
+		s.add(std::unique_ptr<QObject>{o2.data()}, {implementation{make_type<type_2>(), o2.data()}});
+		QVERIFY(o1);
+		QVERIFY(o2);
+	}
+
+	QVERIFY(!o1);
+	QVERIFY(!o2);
+}
+
+void scope_test::should_remove_only_given_object()
+{
+	auto s = scope{};
+	auto o1 = new type_1_subtype_1{};
+	auto o2 = new type_2{};
+	s.add(std::unique_ptr<QObject>{o1}, {
+		implementation{make_type<type_1>(), o1},
+		implementation{make_type<type_1_subtype_1>(), o1}
+	});
+	s.add(std::unique_ptr<QObject>{o2}, {implementation{make_type<type_2>(), o2}});
+	s.mark_resolved(o1);
+	s.mark_resolved(o2);
+
+	auto removed = s.remove(o1);
+
+	QCOMPARE(removed.get(), static_cast<QObject *>(o1));
+	QVERIFY(s.size() == 1);
+	QVERIFY(s.get(make_type<type_1>()) == nullptr);
+	QVERIFY(s.get(make_type<type_1_subtype_1>()) == nullptr);
+	QCOMPARE(s.get(make_type<type_2>()), o2);
+	QCOMPARE(s.resolved_objects(), (std::vector<QObject *>{o2}));
+}
+
+QTEST_APPLESS_MAIN(scope_test)
+#include "scope-test.moc"
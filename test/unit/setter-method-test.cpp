@@ -22,6 +22,8 @@
 #include "utils.h"
 
 #include <injeqt/exception/invalid-setter.h>
+#include <injeqt/lazy.h>
+#include <injeqt/object-set.h>
 
 #include "internal/types-by-name.h"
 
@@ -61,6 +63,8 @@ public:
 public slots:
 	INJEQT_SET void tagged_setter_slot_1(injectable_type1 *a) { _1 = a; }
 	INJEQT_SETTER void tagged_setter_slot_2(injectable_type1 *a) { _1 = a; }
+	INJEQT_SET void lazy_setter_slot(injeqt::lazy<injectable_type1>) { }
+	INJEQT_SET void set_setter_slot(injeqt::set_of<injectable_type1>) { }
 	INJEQT_SETTER void invalid_setter_multi_arguments(injectable_type1 *, injectable_type2 *) { }
 	INVALID_SETTER_TAG void invalid_setter_invalid_tag(injectable_type1 *) { }
 	void invalid_setter_no_tag(injectable_type1 *) { }
@@ -91,6 +95,7 @@ private slots:
 	void should_throw_when_no_tag();
 	void should_throw_when_signal();
 	void should_throw_when_constructor();
+	void should_throw_when_named_setter_does_not_accept_plain_pointer();
 
 };
 
@@ -188,5 +193,16 @@ void setter_method_test::should_throw_when_constructor()
 	});
 }
 
+void setter_method_test::should_throw_when_named_setter_does_not_accept_plain_pointer()
+{
+	QVERIFY(!make_setter_method(_known_types, get_method<test_type>("tagged_setter_slot_1(injectable_type1*)"), "primary").is_empty());
+	expect<exception::invalid_setter>({"named setter must accept plain pointer", "test_type::lazy_setter_slot"}, [&]{
+		make_setter_method(_known_types, get_method<test_type>("lazy_setter_slot(injeqt::lazy<injectable_type1>)"), "primary");
+	});
+	expect<exception::invalid_setter>({"named setter must accept plain pointer", "test_type::set_setter_slot"}, [&]{
+		make_setter_method(_known_types, get_method<test_type>("set_setter_slot(injeqt::set_of<injectable_type1>)"), "primary");
+	});
+}
+
 QTEST_APPLESS_MAIN(setter_method_test)
 #include "setter-method-test.moc"
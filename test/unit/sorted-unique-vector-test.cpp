@@ -21,6 +21,7 @@
 #include "sorted-unique-vector.h"
 
 #include <QtTest/QtTest>
+#include <memory>
 
 using namespace injeqt::internal;
 
@@ -39,7 +40,13 @@ class sorted_unique_vector_test : public QObject
 	}
 
 	using suv_int = sorted_unique_vector<int, int, extract_key>;
+	static int extract_key_unique(const std::unique_ptr<int> &x)
+	{
+		return *x;
+	}
+
 	using suv_pair = sorted_unique_vector<int, std::pair<int, std::string>, extract_key_pair>;
+	using suv_unique = sorted_unique_vector<int, std::unique_ptr<int>, extract_key_unique>;
 
 private slots:
 	void should_be_empty_after_default_construction();
@@ -62,6 +69,9 @@ private slots:
 	void should_be_valid_after_merging_misc_unique_elements();
 	void should_be_valid_after_merging_greater_or_equal_elements();
 	void should_be_valid_after_merging_greater_elements();
+	void should_be_valid_after_moving_merge_of_move_only_elements();
+	void should_be_valid_after_removing_element();
+	void should_not_change_after_removing_missing_element();
 	void should_match_return_nothing_for_two_empty_vectors();
 	void should_match_return_only_unresolved_for_first_empty_vector();
 	void should_match_return_only_unresolved_for_second_empty_vector();
@@ -372,6 +382,38 @@ void sorted_unique_vector_test::should_return_true_for_contains_when_contains_ke
 	QVERIFY(data.contains_key(0));
 }
 
+void sorted_unique_vector_test::should_be_valid_after_moving_merge_of_move_only_elements()
+{
+	auto data = suv_unique{};
+	data.add(std::unique_ptr<int>{new int{3}});
+	data.add(std::unique_ptr<int>{new int{1}});
+	auto data_to_add = suv_unique{};
+	data_to_add.add(std::unique_ptr<int>{new int{2}});
+	data_to_add.add(std::unique_ptr<int>{new int{3}});
+	data.merge(std::move(data_to_add));
+
+	QCOMPARE(data.size(), size_t{3});
+	QCOMPARE(*data.content()[0], 1);
+	QCOMPARE(*data.content()[1], 2);
+	QCOMPARE(*data.content()[2], 3);
+}
+
+void sorted_unique_vector_test::should_be_valid_after_removing_element()
+{
+	auto data = suv_int{0, 5, 10, 1};
+
+	QVERIFY(data.remove(5));
+	QCOMPARE(data.content(), (std::vector<int>{0, 1, 10}));
+}
+
+void sorted_unique_vector_test::should_not_change_after_removing_missing_element()
+{
+	auto data = suv_int{0, 5, 10, 1};
+
+	QVERIFY(!data.remove(4));
+	QVERIFY(!data.remove(11));
+	QCOMPARE(data.content(), (std::vector<int>{0, 1, 5, 10}));
+}
 
 QTEST_APPLESS_MAIN(sorted_unique_vector_test)
 #include "sorted-unique-vector-test.moc"
@@ -0,0 +1,128 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/startup-profile.h"
+
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QtTest>
+#include <fstream>
+
+using namespace injeqt::internal;
+
+class startup_profile_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_not_record_before_start();
+	void should_record_only_first_use();
+	void should_not_record_after_window();
+	void should_save_and_load();
+	void should_not_load_missing_file();
+	void should_not_load_invalid_file();
+
+private:
+	std::string file_name(const QTemporaryDir &dir);
+
+};
+
+std::string startup_profile_test::file_name(const QTemporaryDir &dir)
+{
+	return (dir.path() + "/profile").toStdString();
+}
+
+void startup_profile_test::should_not_record_before_start()
+{
+	auto p = startup_profile{};
+	p.record("type_1", true);
+
+	QVERIFY(!p.is_recording());
+	QVERIFY(p.entries().empty());
+}
+
+void startup_profile_test::should_record_only_first_use()
+{
+	auto p = startup_profile{};
+	p.start_recording(std::chrono::milliseconds{60000});
+	p.record("type_1", true);
+	p.record("type_2", false);
+	p.record("type_1", false);
+
+	QVERIFY(p.is_recording());
+	QVERIFY(p.entries().size() == 2);
+	QCOMPARE(p.entries()[0].type_name, std::string{"type_1"});
+	QVERIFY(p.entries()[0].critical);
+	QCOMPARE(p.entries()[1].type_name, std::string{"type_2"});
+	QVERIFY(!p.entries()[1].critical);
+	QVERIFY(p.entries()[0].offset <= p.entries()[1].offset);
+}
+
+void startup_profile_test::should_not_record_after_window()
+{
+	auto p = startup_profile{};
+	p.start_recording(std::chrono::milliseconds{1});
+	QTest::qSleep(10);
+	p.record("type_1", true);
+
+	QVERIFY(!p.is_recording());
+	QVERIFY(p.entries().empty());
+}
+
+void startup_profile_test::should_save_and_load()
+{
+	QTemporaryDir dir;
+	auto saved = startup_profile{};
+	saved.start_recording(std::chrono::milliseconds{60000});
+	saved.record("type_1", true);
+	saved.record("ns::type_2", false);
+
+	QVERIFY(saved.save(file_name(dir)));
+
+	auto loaded = startup_profile{};
+	QVERIFY(loaded.load(file_name(dir)));
+	QVERIFY(loaded.entries() == saved.entries());
+	QVERIFY(!loaded.is_recording());
+}
+
+void startup_profile_test::should_not_load_missing_file()
+{
+	QTemporaryDir dir;
+	auto p = startup_profile{};
+
+	QVERIFY(!p.load(file_name(dir)));
+}
+
+void startup_profile_test::should_not_load_invalid_file()
+{
+	QTemporaryDir dir;
+	{
+		std::ofstream file{file_name(dir)};
+		file << "injeqt-startup-profile 1\n" << "12 2 type_1\n";
+	}
+
+	auto p = startup_profile{};
+	QVERIFY(!p.load(file_name(dir)));
+	QVERIFY(p.entries().empty());
+}
+
+QTEST_APPLESS_MAIN(startup_profile_test)
+#include "startup-profile-test.moc"
@@ -0,0 +1,114 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/thread-invoke.h"
+
+#include <QtTest/QtTest>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using namespace injeqt::internal;
+
+class no_event_loop_thread : public QThread
+{
+	Q_OBJECT
+
+protected:
+	virtual void run() override
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds{50});
+	}
+
+};
+
+class thread_invoke_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_invoke_directly_without_thread();
+	void should_invoke_directly_on_not_running_thread();
+	void should_invoke_on_running_thread();
+	void should_pass_exception_from_running_thread();
+	void should_invoke_directly_when_thread_finishes_without_event_loop();
+
+};
+
+void thread_invoke_test::should_invoke_directly_without_thread()
+{
+	auto called_on = static_cast<QThread *>(nullptr);
+	invoke_on_thread(nullptr, [&]{ called_on = QThread::currentThread(); });
+
+	QCOMPARE(called_on, QThread::currentThread());
+}
+
+void thread_invoke_test::should_invoke_directly_on_not_running_thread()
+{
+	QThread thread;
+	auto called_on = static_cast<QThread *>(nullptr);
+	invoke_on_thread(&thread, [&]{ called_on = QThread::currentThread(); });
+
+	QCOMPARE(called_on, QThread::currentThread());
+}
+
+void thread_invoke_test::should_invoke_on_running_thread()
+{
+	QThread thread;
+	thread.start();
+
+	auto called_on = static_cast<QThread *>(nullptr);
+	invoke_on_thread(&thread, [&]{ called_on = QThread::currentThread(); });
+
+	thread.quit();
+	thread.wait();
+
+	QCOMPARE(called_on, &thread);
+}
+
+void thread_invoke_test::should_pass_exception_from_running_thread()
+{
+	QThread thread;
+	thread.start();
+
+	expect<std::runtime_error>({"on thread"}, [&]{
+		invoke_on_thread(&thread, []{ throw std::runtime_error{"on thread"}; });
+	});
+
+	thread.quit();
+	thread.wait();
+}
+
+void thread_invoke_test::should_invoke_directly_when_thread_finishes_without_event_loop()
+{
+	no_event_loop_thread thread;
+	thread.start();
+
+	auto called_on = static_cast<QThread *>(nullptr);
+	invoke_on_thread(&thread, [&]{ called_on = QThread::currentThread(); });
+	thread.wait();
+
+	QCOMPARE(called_on, QThread::currentThread());
+}
+
+QTEST_GUILESS_MAIN(thread_invoke_test)
+#include "thread-invoke-test.moc"
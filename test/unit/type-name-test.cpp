@@ -0,0 +1,99 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+
+#include "internal/type-name.h"
+
+#include <QtTest/QtTest>
+
+using namespace injeqt::internal;
+using namespace injeqt::v1;
+
+class type_name_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_compare_views_by_content();
+	void should_order_views_like_strings();
+	void should_return_name_of_type();
+	void should_match_pointer_name_of_type();
+	void should_not_match_other_names();
+
+};
+
+class named_type : public QObject
+{
+	Q_OBJECT
+};
+
+class other_named_type : public QObject
+{
+	Q_OBJECT
+};
+
+void type_name_test::should_compare_views_by_content()
+{
+	auto owned = std::string{"named_type"};
+
+	QVERIFY(name_view{"named_type"} == name_view{owned});
+	QVERIFY(name_view{"named_type*", 10} == name_view{owned});
+	QVERIFY(name_view{"named_type*"} != name_view{owned});
+	QVERIFY(name_view{} == name_view{""});
+	QVERIFY(name_view{} != name_view{owned});
+}
+
+void type_name_test::should_order_views_like_strings()
+{
+	auto names = std::vector<std::string>{"", "a", "ab", "abc", "b", "ba"};
+	for (auto &&x : names)
+		for (auto &&y : names)
+		{
+			QCOMPARE(name_view{x} < name_view{y}, x < y);
+			QCOMPARE(name_view{x} == name_view{y}, x == y);
+		}
+}
+
+void type_name_test::should_return_name_of_type()
+{
+	QVERIFY(name_of(make_type<named_type>()) == name_view{"named_type"});
+	QCOMPARE(name_of(make_type<named_type>()).data(), named_type::staticMetaObject.className());
+}
+
+void type_name_test::should_match_pointer_name_of_type()
+{
+	QVERIFY(is_pointer_name_of("named_type*", make_type<named_type>()));
+	QVERIFY(is_pointer_name_of("other_named_type*", make_type<other_named_type>()));
+	QVERIFY(is_pointer_name_of(name_view{"named_type**", 11}, make_type<named_type>()));
+}
+
+void type_name_test::should_not_match_other_names()
+{
+	QVERIFY(!is_pointer_name_of("named_type", make_type<named_type>()));
+	QVERIFY(!is_pointer_name_of("named_type**", make_type<named_type>()));
+	QVERIFY(!is_pointer_name_of("other_named_type*", make_type<named_type>()));
+	QVERIFY(!is_pointer_name_of("named_typ*", make_type<named_type>()));
+	QVERIFY(!is_pointer_name_of("", make_type<named_type>()));
+	QVERIFY(!is_pointer_name_of("*", make_type<named_type>()));
+}
+
+QTEST_APPLESS_MAIN(type_name_test)
+#include "type-name-test.moc"
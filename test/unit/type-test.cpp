@@ -35,6 +35,7 @@ private slots:
 	void should_return_empty_when_created_with_null_meta_object();
 	void should_return_qobject_when_created_with_qobject_meta_object();
 	void should_return_valid_meta_object();
+	void should_return_class_name();
 	void should_properly_compare();
 
 };
@@ -69,6 +70,14 @@ void type_test::should_return_valid_meta_object()
 	QCOMPARE(t.meta_object(), &valid_type::staticMetaObject);
 }
 
+void type_test::should_return_class_name()
+{
+	auto t = make_type<valid_type>();
+
+	QCOMPARE(t.name(), std::string{"valid_type"});
+	QCOMPARE(t.c_name(), valid_type::staticMetaObject.className());
+}
+
 void type_test::should_properly_compare()
 {
 	auto t1a = type{};
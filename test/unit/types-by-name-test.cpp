@@ -53,6 +53,10 @@ private slots:
 	void should_return_empty_for_type_name();
 	void should_return_valid_for_type_name_with_asterix();
 	void should_return_empty_for_unknown_type_name_with_asterix();
+	void should_extract_lazy_type_name();
+	void should_return_empty_lazy_type_name_for_other_types();
+	void should_extract_set_type_name();
+	void should_return_empty_set_type_name_for_other_types();
 
 private:
 	types_by_name _known_types;
@@ -100,5 +104,39 @@ void types_by_name_test::should_return_empty_for_unknown_type_name_with_asterix(
 	QVERIFY(t.is_empty());
 }
 
+void types_by_name_test::should_extract_lazy_type_name()
+{
+	QCOMPARE(lazy_type_name("lazy<type_1>"), std::string{"type_1"});
+	QCOMPARE(lazy_type_name("injeqt::lazy<type_1>"), std::string{"type_1"});
+	QCOMPARE(lazy_type_name("injeqt::v1::lazy<type_1>"), std::string{"type_1"});
+	QCOMPARE(lazy_type_name("v1::lazy<ns::type_2>"), std::string{"ns::type_2"});
+}
+
+void types_by_name_test::should_return_empty_lazy_type_name_for_other_types()
+{
+	QVERIFY(lazy_type_name("").empty());
+	QVERIFY(lazy_type_name("type_1*").empty());
+	QVERIFY(lazy_type_name("lazy<>").empty());
+	QVERIFY(lazy_type_name("lazy<type_1").empty());
+	QVERIFY(lazy_type_name("not_lazy<type_1>").empty());
+}
+
+void types_by_name_test::should_extract_set_type_name()
+{
+	QCOMPARE(set_type_name("set_of<type_1>"), std::string{"type_1"});
+	QCOMPARE(set_type_name("injeqt::set_of<type_1>"), std::string{"type_1"});
+	QCOMPARE(set_type_name("injeqt::v1::set_of<type_1>"), std::string{"type_1"});
+	QCOMPARE(set_type_name("v1::set_of<ns::type_2>"), std::string{"ns::type_2"});
+}
+
+void types_by_name_test::should_return_empty_set_type_name_for_other_types()
+{
+	QVERIFY(set_type_name("").empty());
+	QVERIFY(set_type_name("type_1*").empty());
+	QVERIFY(set_type_name("set_of<>").empty());
+	QVERIFY(set_type_name("set_of<type_1").empty());
+	QVERIFY(set_type_name("lazy<type_1>").empty());
+}
+
 QTEST_APPLESS_MAIN(types_by_name_test)
 #include "types-by-name-test.moc"
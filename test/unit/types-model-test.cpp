@@ -25,6 +25,7 @@
 #include <injeqt/exception/unresolvable-dependencies.h>
 #include <injeqt/type.h>
 
+#include "internal/analysis-threads.h"
 #include "internal/types-model.h"
 
 #include <QtTest/QtTest>
@@ -77,6 +78,15 @@ private slots:
 	void should_create_with_common_supertype();
 	void should_create_with_dependencies();
 	void should_throw_when_unresolvable_dependency();
+	void should_create_layered_types_model();
+	void should_throw_when_type_configured_in_super_model();
+	void should_hide_supertype_common_with_super_model();
+	void should_find_owner_in_deep_chain();
+	void should_create_the_same_model_with_many_analysis_threads();
+	void should_extend_to_the_same_model_as_created_with_all_types();
+	void should_throw_when_extended_with_unresolvable_dependency();
+	void should_reduce_to_the_same_model_as_created_with_types_left();
+	void should_throw_when_reduced_type_is_required();
 
 private:
 	types_by_name known_types;
@@ -218,5 +228,130 @@ void types_model_test::should_throw_when_unresolvable_dependency()
 	});
 }
 
+void types_model_test::should_create_layered_types_model()
+{
+	auto super = make_types_model(known_types, {type_1_subtype_1_type, type_1_subtype_2_type}, {type_1_subtype_1_type, type_1_subtype_2_type});
+	auto m = make_types_model(known_types, {type_1_subtype_3_type}, {type_1_subtype_3_type}, {&super});
+
+	QCOMPARE(m.available_types(), (implemented_by_mapping
+	{
+		implemented_by{type_1_subtype_3_type, type_1_subtype_3_type}
+	}));
+	QCOMPARE(m.mapped_dependencies(), (types_dependencies
+	{
+		make_type_dependencies(known_types, type_1_subtype_3_type)
+	}));
+	QVERIFY(m.contains(type_1_subtype_1_type));
+	QVERIFY(m.contains(type_1_subtype_2_type));
+	QVERIFY(m.contains(type_1_subtype_3_type));
+	QVERIFY(!m.contains(type_1_type));
+	QVERIFY(m.get_unresolvable_dependencies().empty());
+	QCOMPARE(m.implementation_type(type_1_subtype_1_type), type_1_subtype_1_type);
+	QCOMPARE(m.owner_of(type_1_subtype_1_type), &super);
+	QCOMPARE(m.owner_of(type_1_subtype_3_type), &m);
+}
+
+void types_model_test::should_throw_when_type_configured_in_super_model()
+{
+	auto super = make_types_model(known_types, {type_1_subtype_1_type}, {type_1_subtype_1_type});
+
+	expect<exception::ambiguous_types>({"type_1_subtype_1"}, [&]{
+		make_types_model(known_types, {type_1_subtype_1_type}, {type_1_subtype_1_type}, {&super});
+	});
+
+	expect<exception::ambiguous_types>({"type_1"}, [&]{
+		make_types_model(known_types, {type_1_type}, {type_1_type}, {&super});
+	});
+}
+
+void types_model_test::should_hide_supertype_common_with_super_model()
+{
+	auto super = make_types_model(known_types, {type_1_subtype_1_type}, {type_1_subtype_1_type});
+	auto m = make_types_model(known_types, {type_1_subtype_2_type}, {type_1_subtype_2_type}, {&super});
+
+	QVERIFY(super.contains(type_1_type));
+	QVERIFY(!m.contains(type_1_type));
+	QVERIFY(m.ambiguous_types().contains(type_1_type));
+	QVERIFY(m.contains(type_1_subtype_1_type));
+	QVERIFY(m.contains(type_1_subtype_2_type));
+}
+
+void types_model_test::should_find_owner_in_deep_chain()
+{
+	auto root = make_types_model(known_types, {type_1_subtype_1_type}, {type_1_subtype_1_type});
+	auto middle = make_types_model(known_types, {type_1_subtype_2_type}, {type_1_subtype_2_type}, {&root});
+	auto leaf = make_types_model(known_types, {type_1_subtype_3_type}, {type_1_subtype_3_type}, {&middle});
+
+	QCOMPARE(leaf.owner_of(type_1_subtype_1_type), &root);
+	QCOMPARE(leaf.owner_of(type_1_subtype_2_type), &middle);
+	QCOMPARE(leaf.owner_of(type_1_subtype_3_type), &leaf);
+	QCOMPARE(leaf.owner_of(type_1_type), static_cast<const types_model *>(nullptr));
+	QVERIFY(leaf.get_unresolvable_dependencies().empty());
+}
+
+void types_model_test::should_create_the_same_model_with_many_analysis_threads()
+{
+	auto all_types = std::vector<type>{type_1_subtype_1_type, type_1_subtype_2_subtype_1_type, type_1_subtype_3_type};
+	auto serial = make_types_model(known_types, all_types, all_types);
+
+	set_analysis_thread_count(4);
+	auto parallel = make_types_model(known_types, all_types, all_types);
+	expect<exception::unresolvable_dependencies>({"set_type_1_subtype_1", "set_type_1_subtype_2"}, [&]{
+		make_types_model(known_types, {type_1_subtype_3_type}, {type_1_subtype_3_type});
+	});
+	set_analysis_thread_count(1);
+
+	QCOMPARE(parallel.available_types(), serial.available_types());
+	QCOMPARE(parallel.mapped_dependencies(), serial.mapped_dependencies());
+}
+
+void types_model_test::should_extend_to_the_same_model_as_created_with_all_types()
+{
+	auto base = make_types_model(known_types, {type_1_subtype_1_type, type_1_subtype_2_type}, {type_1_subtype_1_type, type_1_subtype_2_type});
+	auto extended = extend_types_model(base, known_types,
+		{type_1_subtype_1_type, type_1_subtype_2_type, type_1_subtype_3_type},
+		{type_1_subtype_3_type});
+	auto created = make_types_model(known_types,
+		{type_1_subtype_1_type, type_1_subtype_2_type, type_1_subtype_3_type},
+		{type_1_subtype_1_type, type_1_subtype_2_type, type_1_subtype_3_type});
+
+	QCOMPARE(extended.available_types(), created.available_types());
+	QCOMPARE(extended.mapped_dependencies(), created.mapped_dependencies());
+	QCOMPARE(extended.ambiguous_types(), created.ambiguous_types());
+}
+
+void types_model_test::should_throw_when_extended_with_unresolvable_dependency()
+{
+	auto base = make_types_model(known_types, {type_1_subtype_1_type}, {type_1_subtype_1_type});
+
+	expect<exception::unresolvable_dependencies>({"set_type_1_subtype_2"}, [&]{
+		extend_types_model(base, known_types, {type_1_subtype_1_type, type_1_subtype_3_type}, {type_1_subtype_3_type});
+	});
+}
+
+void types_model_test::should_reduce_to_the_same_model_as_created_with_types_left()
+{
+	auto base = make_types_model(known_types,
+		{type_1_subtype_1_type, type_1_subtype_2_type, type_1_subtype_3_type},
+		{type_1_subtype_1_type, type_1_subtype_2_type, type_1_subtype_3_type});
+	auto reduced = reduce_types_model(base, {type_1_subtype_1_type, type_1_subtype_2_type}, {type_1_subtype_1_type, type_1_subtype_2_type});
+	auto created = make_types_model(known_types, {type_1_subtype_1_type, type_1_subtype_2_type}, {type_1_subtype_1_type, type_1_subtype_2_type});
+
+	QCOMPARE(reduced.available_types(), created.available_types());
+	QCOMPARE(reduced.mapped_dependencies(), created.mapped_dependencies());
+	QCOMPARE(reduced.ambiguous_types(), created.ambiguous_types());
+}
+
+void types_model_test::should_throw_when_reduced_type_is_required()
+{
+	auto base = make_types_model(known_types,
+		{type_1_subtype_1_type, type_1_subtype_2_type, type_1_subtype_3_type},
+		{type_1_subtype_1_type, type_1_subtype_2_type, type_1_subtype_3_type});
+
+	expect<exception::unresolvable_dependencies>({"set_type_1_subtype_2"}, [&]{
+		reduce_types_model(base, {type_1_subtype_1_type, type_1_subtype_3_type}, {type_1_subtype_1_type, type_1_subtype_3_type});
+	});
+}
+
 QTEST_APPLESS_MAIN(types_model_test)
 #include "types-model-test.moc"
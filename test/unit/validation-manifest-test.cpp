@@ -0,0 +1,151 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../mocks/mocked-provider.h"
+#include "expect.h"
+#include "utils.h"
+
+#include <injeqt/exception/unresolvable-dependencies.h>
+
+#include "internal/injector-core.h"
+#include "internal/validation-manifest.h"
+
+#include <QtTest/QtTest>
+
+using namespace injeqt::internal;
+using namespace injeqt::v1;
+
+class service : public QObject
+{
+	Q_OBJECT
+};
+
+class other_service : public QObject
+{
+	Q_OBJECT
+};
+
+class service_user : public QObject
+{
+	Q_OBJECT
+
+public slots:
+	INJEQT_SET void set_service(service *) {}
+
+};
+
+// setter that service_user had in earlier build of application
+class old_service_user : public QObject
+{
+	Q_OBJECT
+
+public slots:
+	INJEQT_SET void set_service(other_service *) {}
+
+};
+
+class validation_manifest_test : public QObject
+{
+	Q_OBJECT
+
+public:
+	validation_manifest_test();
+
+private:
+	types_by_name _known_types;
+
+	providers make_providers() const;
+	std::vector<type_dependencies> make_dependencies(setter_method setter) const;
+
+private slots:
+	void should_return_the_same_manifest_for_the_same_setters();
+	void should_return_other_manifest_for_changed_setter_signature();
+	void should_return_other_manifest_for_changed_setter_qualifier();
+	void should_validate_when_setter_signature_changed();
+
+};
+
+validation_manifest_test::validation_manifest_test() :
+	_known_types{
+		make_type<service>(),
+		make_type<service_user>()
+	}
+{
+}
+
+providers validation_manifest_test::make_providers() const
+{
+	auto configuration = std::vector<std::unique_ptr<provider>>{};
+	configuration.push_back(make_mocked_provider<service_user>());
+	return providers{std::move(configuration)};
+}
+
+std::vector<type_dependencies> validation_manifest_test::make_dependencies(setter_method setter) const
+{
+	return std::vector<type_dependencies>{
+		type_dependencies{make_type<service_user>(), dependencies{dependency{std::move(setter)}}}
+	};
+}
+
+void validation_manifest_test::should_return_the_same_manifest_for_the_same_setters()
+{
+	auto manifest_1 = make_validation_manifest(make_providers(), make_dependencies(make_test_setter_method<service_user, service>("set_service(service*)")), std::vector<type>{});
+	auto manifest_2 = make_validation_manifest(make_providers(), make_dependencies(make_test_setter_method<service_user, service>("set_service(service*)")), std::vector<type>{});
+
+	QCOMPARE(manifest_1, manifest_2);
+}
+
+void validation_manifest_test::should_return_other_manifest_for_changed_setter_signature()
+{
+	auto current = make_validation_manifest(make_providers(), make_dependencies(make_test_setter_method<service_user, service>("set_service(service*)")), std::vector<type>{});
+	auto old = make_validation_manifest(make_providers(), make_dependencies(make_test_setter_method<old_service_user, other_service>("set_service(other_service*)")), std::vector<type>{});
+
+	QVERIFY(current != old);
+}
+
+void validation_manifest_test::should_return_other_manifest_for_changed_setter_qualifier()
+{
+	auto meta_method = get_method<service_user>("set_service(service*)");
+	auto unqualified = make_validation_manifest(make_providers(), make_dependencies(setter_method{make_type<service>(), meta_method}), std::vector<type>{});
+	auto qualified = make_validation_manifest(make_providers(), make_dependencies(setter_method{make_type<service>(), meta_method, "primary"}), std::vector<type>{});
+
+	QVERIFY(unqualified != qualified);
+}
+
+void validation_manifest_test::should_validate_when_setter_signature_changed()
+{
+	// service is not provided, so only validation can find that set_service(service*) is unresolvable
+	auto current = make_validation_manifest(make_providers(), make_dependencies(make_test_setter_method<service_user, service>("set_service(service*)")), std::vector<type>{});
+	auto old = make_validation_manifest(make_providers(), make_dependencies(make_test_setter_method<old_service_user, other_service>("set_service(other_service*)")), std::vector<type>{});
+
+	auto configuration = std::vector<std::unique_ptr<provider>>{};
+	configuration.push_back(make_mocked_provider<service_user>());
+	auto core = injector_core{std::vector<injector_core *>{}, _known_types, std::move(configuration), current};
+	QCOMPARE(core.validation_manifest(), current);
+
+	expect<injeqt::exception::unresolvable_dependencies>({"service"}, [&]{
+		auto old_configuration = std::vector<std::unique_ptr<provider>>{};
+		old_configuration.push_back(make_mocked_provider<service_user>());
+		auto old_core = injector_core{std::vector<injector_core *>{}, _known_types, std::move(old_configuration), old};
+	});
+}
+
+QTEST_APPLESS_MAIN(validation_manifest_test)
+#include "validation-manifest-test.moc"
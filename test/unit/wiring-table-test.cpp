@@ -0,0 +1,230 @@
+/*
+ * %injeqt copyright begin%
+ * Copyright 2026 Rafał Malinowski (rafal.przemyslaw.malinowski@gmail.com)
+ * %injeqt copyright end%
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "expect.h"
+#include "utils.h"
+
+#include <injeqt/exception/invalid-action.h>
+
+#include "internal/wiring-table.h"
+
+#include <QtTest/QtTest>
+#include <algorithm>
+
+using namespace injeqt::internal;
+using namespace injeqt::v1;
+
+class injected_type : public QObject
+{
+	Q_OBJECT
+};
+
+class base_type : public QObject
+{
+	Q_OBJECT
+
+public slots:
+	INJEQT_INIT void base_init() {}
+	INJEQT_SET void set_base(injected_type *) {}
+
+};
+
+class test_type : public base_type
+{
+	Q_OBJECT
+	INJEQT_NAMED(set_injected, "primary")
+
+public:
+	Q_INVOKABLE test_type(int) {}
+	Q_INVOKABLE test_type() {}
+
+public slots:
+	INJEQT_SET void set_injected(injected_type *) {}
+	INJEQT_INIT void init() {}
+	INJEQT_DONE void done() {}
+	INJEQT_RESET void reset() {}
+	void untagged(int) {}
+
+};
+
+class injection_constructor_type : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE injection_constructor_type(QObject *parent) : QObject{parent} {}
+	Q_INVOKABLE injection_constructor_type(injected_type *) {}
+
+};
+
+class invalid_done_type : public QObject
+{
+	Q_OBJECT
+
+public:
+	Q_INVOKABLE invalid_done_type(int) {}
+
+public slots:
+	INJEQT_INIT void init() {}
+	INJEQT_DONE void done(int) {}
+
+};
+
+class wiring_table_test : public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void should_contain_setters_with_inherited_ones();
+	void should_contain_qualifiers_of_setters();
+	void should_contain_actions_with_inherited_ones_in_order();
+	void should_contain_default_constructor();
+	void should_contain_injection_constructor();
+	void should_contain_methods_without_parameters_as_factory_candidates();
+	void should_throw_only_for_list_with_invalid_action();
+	void should_return_the_same_table_for_the_same_type();
+	void should_rebuild_table_of_removed_type();
+	void should_keep_tables_separate_for_each_cache();
+	void should_build_added_tables_once();
+
+};
+
+void wiring_table_test::should_contain_setters_with_inherited_ones()
+{
+	auto table = wiring_table{make_type<test_type>()};
+
+	QVERIFY(table.setters().size() == 2);
+	QCOMPARE(table.setters()[0].methodSignature(), QByteArray{"set_base(injected_type*)"});
+	QCOMPARE(table.setters()[1].methodSignature(), QByteArray{"set_injected(injected_type*)"});
+}
+
+void wiring_table_test::should_contain_qualifiers_of_setters()
+{
+	auto table = wiring_table{make_type<test_type>()};
+
+	QVERIFY(table.setter_qualifiers().size() == 2);
+	QCOMPARE(table.setter_qualifiers()[0], std::string{});
+	QCOMPARE(table.setter_qualifiers()[1], std::string{"primary"});
+}
+
+void wiring_table_test::should_contain_actions_with_inherited_ones_in_order()
+{
+	auto table = wiring_table{make_type<test_type>()};
+
+	QVERIFY(table.init_actions().size() == 2);
+	QCOMPARE(table.init_actions()[0].object_type(), make_type<base_type>());
+	QCOMPARE(table.init_actions()[1].object_type(), make_type<test_type>());
+	QVERIFY(table.done_actions().size() == 1);
+	QVERIFY(table.reset_actions().size() == 1);
+}
+
+void wiring_table_test::should_contain_default_constructor()
+{
+	QCOMPARE(wiring_table{make_type<test_type>()}.default_constructor().methodSignature(), QByteArray{"test_type()"});
+	QVERIFY(!wiring_table{make_type<invalid_done_type>()}.default_constructor().isValid());
+}
+
+void wiring_table_test::should_contain_injection_constructor()
+{
+	auto table = wiring_table{make_type<injection_constructor_type>()};
+
+	QCOMPARE(table.injection_constructor().methodSignature(), QByteArray{"injection_constructor_type(injected_type*)"});
+	QCOMPARE(table.injection_constructor_index(), 1);
+	QVERIFY(!table.default_constructor().isValid());
+	QVERIFY(!wiring_table{make_type<test_type>()}.injection_constructor().isValid());
+	QCOMPARE(wiring_table{make_type<test_type>()}.injection_constructor_index(), -1);
+}
+
+void wiring_table_test::should_contain_methods_without_parameters_as_factory_candidates()
+{
+	auto table = wiring_table{make_type<test_type>()};
+
+	for (auto &&method : table.factory_candidates())
+		QCOMPARE(method.parameterCount(), 0);
+	QVERIFY(std::any_of(std::begin(table.factory_candidates()), std::end(table.factory_candidates()),
+		[](const QMetaMethod &m){ return m.methodSignature() == "done()"; }));
+	QVERIFY(std::none_of(std::begin(table.factory_candidates()), std::end(table.factory_candidates()),
+		[](const QMetaMethod &m){ return m.methodSignature() == "untagged(int)"; }));
+}
+
+void wiring_table_test::should_throw_only_for_list_with_invalid_action()
+{
+	auto table = wiring_table{make_type<invalid_done_type>()};
+
+	QVERIFY(table.init_actions().size() == 1);
+	expect<injeqt::exception::invalid_action>({"done(int)"}, [&]{
+		table.done_actions();
+	});
+}
+
+void wiring_table_test::should_return_the_same_table_for_the_same_type()
+{
+	auto tables = wiring_tables{};
+
+	QCOMPARE(&tables.table_of(make_type<test_type>()), &tables.table_of(make_type<test_type>()));
+	QVERIFY(&tables.table_of(make_type<test_type>()) != &tables.table_of(make_type<base_type>()));
+	QVERIFY(tables.table_of(make_type<test_type>()).for_type() == make_type<test_type>());
+	QVERIFY(tables.size() == 2);
+}
+
+void wiring_table_test::should_rebuild_table_of_removed_type()
+{
+	auto tables = wiring_tables{};
+	tables.table_of(make_type<test_type>());
+	tables.table_of(make_type<base_type>());
+
+	tables.remove(std::vector<type>{make_type<test_type>(), make_type<injected_type>()});
+
+	QVERIFY(tables.size() == 1);
+	QVERIFY(tables.table_of(make_type<test_type>()).setters().size() == 2);
+	QVERIFY(tables.size() == 2);
+}
+
+void wiring_table_test::should_keep_tables_separate_for_each_cache()
+{
+	auto tables_1 = wiring_tables{};
+	auto tables_2 = wiring_tables{};
+
+	QVERIFY(&tables_1.table_of(make_type<test_type>()) != &tables_2.table_of(make_type<test_type>()));
+	tables_1.remove(std::vector<type>{make_type<test_type>()});
+	QVERIFY(tables_1.size() == 0);
+	QVERIFY(tables_2.size() == 1);
+}
+
+void wiring_table_test::should_build_added_tables_once()
+{
+	auto tables = wiring_tables{std::vector<type>{make_type<test_type>(), make_type<test_type>()}};
+	auto &table = tables.at(make_type<test_type>());
+
+	QVERIFY(tables.size() == 1);
+	QVERIFY(tables.find(make_type<base_type>()) == nullptr);
+
+	auto added = tables.add(std::vector<type>{make_type<test_type>(), make_type<base_type>()});
+
+	QVERIFY(added == std::vector<type>{make_type<base_type>()});
+	QVERIFY(tables.size() == 2);
+	QCOMPARE(&table, &tables.at(make_type<test_type>()));
+	QCOMPARE(&table, tables.find(make_type<test_type>()));
+	QCOMPARE(&table, &tables.table_of(make_type<test_type>()));
+	QVERIFY(tables.at(make_type<base_type>()).for_type() == make_type<base_type>());
+}
+
+QTEST_APPLESS_MAIN(wiring_table_test)
+#include "wiring-table-test.moc"